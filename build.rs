@@ -23,6 +23,7 @@ fn main() {
                 "SIMSIMD_TARGET_GENOA",
                 "SIMSIMD_TARGET_ICE",
                 "SIMSIMD_TARGET_SKYLAKE",
+                "SIMSIMD_TARGET_ALDER",
                 "SIMSIMD_TARGET_HASWELL",
             ],
         };
@@ -50,4 +51,5 @@ fn main() {
     println!("cargo:rerun-if-changed=include/simsimd/probability.h");
     println!("cargo:rerun-if-changed=include/simsimd/binary.h");
     println!("cargo:rerun-if-changed=include/simsimd/types.h");
+    println!("cargo:rerun-if-changed=include/simsimd/elementwise.h");
 }
@@ -17,12 +17,24 @@
 #if !defined(SIMSIMD_TARGET_NEON) && (defined(__APPLE__) || defined(__linux__))
 #define SIMSIMD_TARGET_NEON 1
 #endif
+#if !defined(SIMSIMD_TARGET_NEON_F16) && (defined(__APPLE__) || defined(__linux__))
+#define SIMSIMD_TARGET_NEON_F16 1
+#endif
+#if !defined(SIMSIMD_TARGET_NEON_BF16) && (defined(__APPLE__) || defined(__linux__))
+#define SIMSIMD_TARGET_NEON_BF16 1
+#endif
+#if !defined(SIMSIMD_TARGET_NEON_I8) && (defined(__APPLE__) || defined(__linux__))
+#define SIMSIMD_TARGET_NEON_I8 1
+#endif
 #if !defined(SIMSIMD_TARGET_SVE) && (defined(__linux__))
 #define SIMSIMD_TARGET_SVE 1
 #endif
 #if !defined(SIMSIMD_TARGET_HASWELL) && (defined(_MSC_VER) || defined(__APPLE__) || defined(__linux__))
 #define SIMSIMD_TARGET_HASWELL 1
 #endif
+#if !defined(SIMSIMD_TARGET_ALDER) && (defined(__linux__))
+#define SIMSIMD_TARGET_ALDER 1
+#endif
 #if !defined(SIMSIMD_TARGET_SKYLAKE) && (defined(_MSC_VER) || defined(__linux__))
 #define SIMSIMD_TARGET_SKYLAKE 1
 #endif
@@ -70,6 +82,7 @@ simsimd_capability_t simsimd_capabilities(void) {
     }
 
 // Dot products
+SIMSIMD_METRIC_DECLARATION(dot, i8, i8)
 SIMSIMD_METRIC_DECLARATION(dot, f16, f16)
 SIMSIMD_METRIC_DECLARATION(dot, bf16, bf16)
 SIMSIMD_METRIC_DECLARATION(dot, f32, f32)
@@ -109,9 +122,173 @@ SIMSIMD_METRIC_DECLARATION(js, bf16, bf16)
 SIMSIMD_METRIC_DECLARATION(js, f32, f32)
 SIMSIMD_METRIC_DECLARATION(js, f64, f64)
 
+// Element-wise operations resolve their kernels the same way, but leave the output untouched on failure,
+// as there is no sensible value to signal the error within a vector of integers.
+#define SIMSIMD_WSUM_DECLARATION(extension)                                                                            \
+    SIMSIMD_DYNAMIC void simsimd_wsum_##extension(simsimd_##extension##_t const* a,                                    \
+                                                  simsimd_##extension##_t const* b, simsimd_size_t n,                  \
+                                                  simsimd_distance_t alpha, simsimd_distance_t beta,                   \
+                                                  simsimd_##extension##_t* result) {                                   \
+        static simsimd_metric_punned_t kernel = 0;                                                                     \
+        if (kernel == 0) {                                                                                             \
+            simsimd_capability_t used_capability;                                                                      \
+            simsimd_find_metric_punned(simsimd_metric_wsum_k, simsimd_datatype_##extension##_k,                        \
+                                       simsimd_capabilities(), simsimd_cap_any_k,                                      \
+                                       &kernel, &used_capability);                                                     \
+            if (!kernel)                                                                                               \
+                return;                                                                                                \
+        }                                                                                                              \
+        ((simsimd_kernel_wsum_punned_t)kernel)(a, b, n, alpha, beta, result);                                          \
+    }
+
+#define SIMSIMD_FMA_DECLARATION(extension)                                                                             \
+    SIMSIMD_DYNAMIC void simsimd_fma_##extension(                                                                      \
+        simsimd_##extension##_t const* a, simsimd_##extension##_t const* b, simsimd_##extension##_t const* c,          \
+        simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_##extension##_t* result) {        \
+        static simsimd_metric_punned_t kernel = 0;                                                                     \
+        if (kernel == 0) {                                                                                             \
+            simsimd_capability_t used_capability;                                                                      \
+            simsimd_find_metric_punned(simsimd_metric_fma_k, simsimd_datatype_##extension##_k,                         \
+                                       simsimd_capabilities(), simsimd_cap_any_k,                                      \
+                                       &kernel, &used_capability);                                                     \
+            if (!kernel)                                                                                               \
+                return;                                                                                                \
+        }                                                                                                              \
+        ((simsimd_kernel_fma_punned_t)kernel)(a, b, c, n, alpha, beta, result);                                        \
+    }
+
+#define SIMSIMD_SCALE_DECLARATION(extension)                                                                           \
+    SIMSIMD_DYNAMIC void simsimd_scale_##extension(simsimd_##extension##_t const* a, simsimd_size_t n,                 \
+                                                   simsimd_distance_t alpha, simsimd_distance_t beta,                  \
+                                                   simsimd_##extension##_t* result) {                                  \
+        static simsimd_metric_punned_t kernel = 0;                                                                     \
+        if (kernel == 0) {                                                                                             \
+            simsimd_capability_t used_capability;                                                                      \
+            simsimd_find_metric_punned(simsimd_metric_scale_k, simsimd_datatype_##extension##_k,                       \
+                                       simsimd_capabilities(), simsimd_cap_any_k,                                      \
+                                       &kernel, &used_capability);                                                     \
+            if (!kernel)                                                                                               \
+                return;                                                                                                \
+        }                                                                                                              \
+        ((simsimd_kernel_scale_punned_t)kernel)(a, n, alpha, beta, result);                                            \
+    }
+
+#define SIMSIMD_SCALE_TO_DECLARATION(input, output)                                                                    \
+    SIMSIMD_DYNAMIC void simsimd_scale_##input##_to_##output(simsimd_##input##_t const* a, simsimd_size_t n,           \
+                                                             simsimd_distance_t alpha, simsimd_distance_t beta,        \
+                                                             simsimd_##output##_t* result) {                           \
+        static simsimd_kernel_scale_punned_t kernel = 0;                                                               \
+        if (kernel == 0) {                                                                                             \
+            simsimd_capability_t used_capability;                                                                      \
+            simsimd_find_scale_punned(simsimd_datatype_##input##_k, simsimd_datatype_##output##_k,                     \
+                                      simsimd_capabilities(), simsimd_cap_any_k, &kernel, &used_capability);           \
+            if (!kernel)                                                                                               \
+                return;                                                                                                \
+        }                                                                                                              \
+        kernel(a, n, alpha, beta, result);                                                                             \
+    }
+
+#define SIMSIMD_AFFINE_DECLARATION(input, output)                                                                      \
+    SIMSIMD_DYNAMIC void simsimd_affine_##input##_to_##output(simsimd_##input##_t const* a, simsimd_size_t n,          \
+                                                              simsimd_f32_t const* alphas, simsimd_f32_t const* betas, \
+                                                              simsimd_##output##_t* result) {                          \
+        static simsimd_kernel_affine_punned_t kernel = 0;                                                              \
+        if (kernel == 0) {                                                                                             \
+            simsimd_capability_t used_capability;                                                                      \
+            simsimd_find_affine_punned(simsimd_datatype_##input##_k, simsimd_datatype_##output##_k,                    \
+                                       simsimd_capabilities(), simsimd_cap_any_k, &kernel, &used_capability);          \
+            if (!kernel)                                                                                               \
+                return;                                                                                                \
+        }                                                                                                              \
+        kernel(a, n, alphas, betas, result);                                                                           \
+    }
+
+#define SIMSIMD_ASSIGN_DECLARATION(name, extension)                                                                    \
+    SIMSIMD_DYNAMIC void simsimd_assign_##name##_##extension(                                                          \
+        simsimd_##extension##_t const* a, simsimd_size_t count, simsimd_##extension##_t const* centroids,              \
+        simsimd_size_t k, simsimd_size_t n, simsimd_size_t* assignments, simsimd_distance_t* distances) {              \
+        static simsimd_kernel_assign_punned_t kernel = 0;                                                              \
+        if (kernel == 0) {                                                                                             \
+            simsimd_capability_t used_capability;                                                                      \
+            simsimd_find_assign_punned(simsimd_metric_##name##_k, simsimd_datatype_##extension##_k,                    \
+                                       simsimd_capabilities(), simsimd_cap_any_k, &kernel, &used_capability);          \
+            if (!kernel)                                                                                               \
+                return;                                                                                                \
+        }                                                                                                              \
+        kernel(a, count, centroids, k, n, assignments, distances);                                                     \
+    }
+
+#define SIMSIMD_PACKED_DECLARATION(name, extension)                                                                    \
+    SIMSIMD_DYNAMIC void simsimd_packed_##name##_##extension(                                                          \
+        simsimd_##extension##_t const* a, simsimd_size_t a_count, simsimd_##extension##_t const* packed,               \
+        simsimd_size_t count, simsimd_size_t n, simsimd_distance_t* results) {                                         \
+        static simsimd_kernel_packed_punned_t kernel = 0;                                                              \
+        if (kernel == 0) {                                                                                             \
+            simsimd_capability_t used_capability;                                                                      \
+            simsimd_find_packed_punned(simsimd_metric_##name##_k, simsimd_datatype_##extension##_k,                    \
+                                       simsimd_capabilities(), simsimd_cap_any_k, &kernel, &used_capability);          \
+            if (!kernel)                                                                                               \
+                return;                                                                                                \
+        }                                                                                                              \
+        kernel(a, a_count, packed, count, n, results);                                                                 \
+    }
+
+// Element-wise operations
+SIMSIMD_WSUM_DECLARATION(i8)
+SIMSIMD_WSUM_DECLARATION(f16)
+SIMSIMD_WSUM_DECLARATION(bf16)
+SIMSIMD_WSUM_DECLARATION(f32)
+SIMSIMD_WSUM_DECLARATION(f64)
+SIMSIMD_FMA_DECLARATION(i8)
+SIMSIMD_FMA_DECLARATION(f16)
+SIMSIMD_FMA_DECLARATION(bf16)
+SIMSIMD_FMA_DECLARATION(f32)
+SIMSIMD_FMA_DECLARATION(f64)
+SIMSIMD_SCALE_DECLARATION(i8)
+SIMSIMD_SCALE_DECLARATION(f16)
+SIMSIMD_SCALE_DECLARATION(bf16)
+SIMSIMD_SCALE_DECLARATION(f32)
+SIMSIMD_SCALE_DECLARATION(f64)
+SIMSIMD_SCALE_TO_DECLARATION(f32, f16)
+SIMSIMD_SCALE_TO_DECLARATION(f32, bf16)
+SIMSIMD_SCALE_TO_DECLARATION(f16, f32)
+SIMSIMD_SCALE_TO_DECLARATION(bf16, f32)
+SIMSIMD_SCALE_TO_DECLARATION(f32, i8)
+SIMSIMD_SCALE_TO_DECLARATION(i8, f32)
+SIMSIMD_AFFINE_DECLARATION(f32, i8)
+SIMSIMD_AFFINE_DECLARATION(i8, f32)
+
+// Nearest-centroid assignment
+SIMSIMD_ASSIGN_DECLARATION(l2sq, f32)
+SIMSIMD_ASSIGN_DECLARATION(dot, f32)
+SIMSIMD_ASSIGN_DECLARATION(cos, f32)
+
+// Distances to rows packed into panels
+SIMSIMD_PACKED_DECLARATION(l2sq, f32)
+SIMSIMD_PACKED_DECLARATION(dot, f32)
+SIMSIMD_PACKED_DECLARATION(cos, f32)
+
+// Fused L2 normalization
+SIMSIMD_DYNAMIC void simsimd_normalize_f32(simsimd_f32_t const* a, simsimd_size_t count, simsimd_size_t n,
+                                           simsimd_f32_t* result) {
+    static simsimd_kernel_normalize_punned_t kernel = 0;
+    if (kernel == 0) {
+        simsimd_capability_t used_capability;
+        simsimd_find_normalize_punned(simsimd_datatype_f32_k, simsimd_capabilities(), simsimd_cap_any_k, &kernel,
+                                      &used_capability);
+        if (!kernel)
+            return;
+    }
+    kernel(a, count, n, result);
+}
+
 SIMSIMD_DYNAMIC int simsimd_uses_neon(void) { return (simsimd_capabilities() & simsimd_cap_neon_k) != 0; }
+SIMSIMD_DYNAMIC int simsimd_uses_neon_f16(void) { return (simsimd_capabilities() & simsimd_cap_neon_f16_k) != 0; }
+SIMSIMD_DYNAMIC int simsimd_uses_neon_bf16(void) { return (simsimd_capabilities() & simsimd_cap_neon_bf16_k) != 0; }
+SIMSIMD_DYNAMIC int simsimd_uses_neon_i8(void) { return (simsimd_capabilities() & simsimd_cap_neon_i8_k) != 0; }
 SIMSIMD_DYNAMIC int simsimd_uses_sve(void) { return (simsimd_capabilities() & simsimd_cap_sve_k) != 0; }
 SIMSIMD_DYNAMIC int simsimd_uses_haswell(void) { return (simsimd_capabilities() & simsimd_cap_haswell_k) != 0; }
+SIMSIMD_DYNAMIC int simsimd_uses_alder(void) { return (simsimd_capabilities() & simsimd_cap_alder_k) != 0; }
 SIMSIMD_DYNAMIC int simsimd_uses_skylake(void) { return (simsimd_capabilities() & simsimd_cap_skylake_k) != 0; }
 SIMSIMD_DYNAMIC int simsimd_uses_ice(void) { return (simsimd_capabilities() & simsimd_cap_ice_k) != 0; }
 SIMSIMD_DYNAMIC int simsimd_uses_genoa(void) { return (simsimd_capabilities() & simsimd_cap_genoa_k) != 0; }
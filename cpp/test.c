@@ -4,13 +4,19 @@
  */
 
 #include <assert.h> // `assert`
+#include <float.h>  // `DBL_MAX`
 #include <math.h>   // `sqrtf`
 #include <stdio.h>  // `printf`
+#include <stdlib.h> // `malloc`, `free`
+#include <string.h> // `memcpy`, `memset`
 
 #define SIMSIMD_NATIVE_F16 0
 #define SIMSIMD_NATIVE_BF16 0
 #define SIMSIMD_RSQRT(x) (1 / sqrtf(x))
 #define SIMSIMD_LOG(x) (logf(x))
+#include <simsimd/dataset.h>
+#include <simsimd/index.h>
+#include <simsimd/parallel.h>
 #include <simsimd/simsimd.h>
 
 /**
@@ -27,8 +33,12 @@ void print_capabilities(void) {
     printf("\n");
     printf("Compile-time settings:\n");
     printf("- Arm NEON support enabled: %s\n", flags[SIMSIMD_TARGET_NEON]);
+    printf("- Arm NEON F16 support enabled: %s\n", flags[SIMSIMD_TARGET_NEON_F16]);
+    printf("- Arm NEON BF16 support enabled: %s\n", flags[SIMSIMD_TARGET_NEON_BF16]);
+    printf("- Arm NEON I8 support enabled: %s\n", flags[SIMSIMD_TARGET_NEON_I8]);
     printf("- Arm SVE support enabled: %s\n", flags[SIMSIMD_TARGET_SVE]);
     printf("- x86 Haswell support enabled: %s\n", flags[SIMSIMD_TARGET_HASWELL]);
+    printf("- x86 Alder Lake support enabled: %s\n", flags[SIMSIMD_TARGET_ALDER]);
     printf("- x86 Skylake support enabled: %s\n", flags[SIMSIMD_TARGET_SKYLAKE]);
     printf("- x86 Ice Lake support enabled: %s\n", flags[SIMSIMD_TARGET_ICE]);
     printf("- x86 Genoa support enabled: %s\n", flags[SIMSIMD_TARGET_GENOA]);
@@ -36,8 +46,13 @@ void print_capabilities(void) {
     printf("\n");
     printf("Run-time settings:\n");
     printf("- Arm NEON support enabled: %s\n", flags[(runtime_caps & simsimd_cap_neon_k) != 0]);
+    printf("- Arm NEON F16 support enabled: %s\n", flags[(runtime_caps & simsimd_cap_neon_f16_k) != 0]);
+    printf("- Arm NEON BF16 support enabled: %s\n", flags[(runtime_caps & simsimd_cap_neon_bf16_k) != 0]);
+    printf("- Arm NEON I8 support enabled: %s\n", flags[(runtime_caps & simsimd_cap_neon_i8_k) != 0]);
+    printf("- Arm NEON I8MM support enabled: %s\n", flags[(runtime_caps & simsimd_cap_neon_i8mm_k) != 0]);
     printf("- Arm SVE support enabled: %s\n", flags[(runtime_caps & simsimd_cap_sve_k) != 0]);
     printf("- x86 Haswell support enabled: %s\n", flags[(runtime_caps & simsimd_cap_haswell_k) != 0]);
+    printf("- x86 Alder Lake support enabled: %s\n", flags[(runtime_caps & simsimd_cap_alder_k) != 0]);
     printf("- x86 Skylake support enabled: %s\n", flags[(runtime_caps & simsimd_cap_skylake_k) != 0]);
     printf("- x86 Ice Lake support enabled: %s\n", flags[(runtime_caps & simsimd_cap_ice_k) != 0]);
     printf("- x86 Genoa support enabled: %s\n", flags[(runtime_caps & simsimd_cap_genoa_k) != 0]);
@@ -45,6 +60,44 @@ void print_capabilities(void) {
     printf("\n");
 }
 
+/**
+ *  @brief  Fills `x` with reproducible pseudo-random values in [-1, 1), to compare kernels with serial references.
+ */
+void fill_random_f32(simsimd_f32_t* x, simsimd_size_t n, simsimd_u32_t seed) {
+    for (simsimd_size_t i = 0; i != n; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        x[i] = (simsimd_f32_t)(seed >> 8) / (1 << 23) - 1;
+    }
+}
+
+/**
+ *  @brief  Checks if `a` is within `tolerance` of `b`, relative to the magnitude of `b`, if it exceeds one.
+ */
+int is_close(simsimd_distance_t a, simsimd_distance_t b, simsimd_distance_t tolerance) {
+    simsimd_distance_t magnitude = fabs(b) > 1 ? fabs(b) : 1;
+    return fabs(a - b) <= tolerance * magnitude;
+}
+
+/**
+ *  @brief  Exports the `k` nearest of the `count` rows allowed by the bitmap, scoring them with a serial kernel,
+ *          as the exact reference for the search routines and indexes.
+ *  @return The number of exported rows.
+ */
+simsimd_size_t exact_search_f32(simsimd_metric_punned_t kernel, simsimd_f32_t const* query, simsimd_f32_t const* base,
+                                simsimd_size_t count, simsimd_size_t n, simsimd_b8_t const* allowed, simsimd_size_t k,
+                                simsimd_size_t* ids, simsimd_distance_t* distances) {
+    simsimd_size_t size = 0;
+    for (simsimd_size_t i = 0; i != count; ++i) {
+        simsimd_distance_t distance;
+        if (allowed && !(allowed[i / 8] & (1 << (i % 8))))
+            continue;
+        kernel(query, base + i * n, n, &distance);
+        simsimd_topk_push(distances, ids, k, &size, distance, i);
+    }
+    simsimd_topk_sort(distances, ids, size);
+    return size;
+}
+
 /**
  *  @brief  A trivial test that checks if the utility functions return the expected values.
  */
@@ -52,16 +105,24 @@ void test_utilities(void) {
     simsimd_capability_t capabilities = simsimd_capabilities();
 
     int uses_neon = simsimd_uses_neon();
+    int uses_neon_f16 = simsimd_uses_neon_f16();
+    int uses_neon_bf16 = simsimd_uses_neon_bf16();
+    int uses_neon_i8 = simsimd_uses_neon_i8();
     int uses_sve = simsimd_uses_sve();
     int uses_haswell = simsimd_uses_haswell();
+    int uses_alder = simsimd_uses_alder();
     int uses_skylake = simsimd_uses_skylake();
     int uses_ice = simsimd_uses_ice();
     int uses_sapphire = simsimd_uses_sapphire();
     int uses_genoa = simsimd_uses_genoa();
 
     assert(uses_neon == ((capabilities & simsimd_cap_neon_k) != 0));
+    assert(uses_neon_f16 == ((capabilities & simsimd_cap_neon_f16_k) != 0));
+    assert(uses_neon_bf16 == ((capabilities & simsimd_cap_neon_bf16_k) != 0));
+    assert(uses_neon_i8 == ((capabilities & simsimd_cap_neon_i8_k) != 0));
     assert(uses_sve == ((capabilities & simsimd_cap_sve_k) != 0));
     assert(uses_haswell == ((capabilities & simsimd_cap_haswell_k) != 0));
+    assert(uses_alder == ((capabilities & simsimd_cap_alder_k) != 0));
     assert(uses_skylake == ((capabilities & simsimd_cap_skylake_k) != 0));
     assert(uses_ice == ((capabilities & simsimd_cap_ice_k) != 0));
     assert(uses_sapphire == ((capabilities & simsimd_cap_sapphire_k) != 0));
@@ -88,6 +149,26 @@ void test_distance_from_itself(void) {
     simsimd_cos_f32(f32s, f32s, 1536, &distance);
     simsimd_cos_f64(f64s, f64s, 1536, &distance);
 
+    // Cosine distance between vectors with precomputed norms
+    simsimd_distance_t norms[2] = {1, 1}, distances[2];
+    simsimd_cos_prenormed_i8(i8s, i8s, 1536, 1, 1, &distance);
+    simsimd_cos_prenormed_f16(f16s, f16s, 1536, 1, 1, &distance);
+    simsimd_cos_prenormed_bf16(bf16s, bf16s, 1536, 1, 1, &distance);
+    simsimd_cos_prenormed_f32(f32s, f32s, 1536, 1, 1, &distance);
+    simsimd_cos_prenormed_f64(f64s, f64s, 1536, 1, 1, &distance);
+    simsimd_cos_prenormed_batch_f32(f32s, f32s, 2, 768, 1, norms, distances);
+
+    // Euclidean distance between vectors with precomputed norms
+    simsimd_norms_i8(i8s, 2, 768, norms);
+    simsimd_norms_f16(f16s, 2, 768, norms);
+    simsimd_norms_bf16(bf16s, 2, 768, norms);
+    simsimd_norms_f64(f64s, 2, 768, norms);
+    simsimd_norms_squared_f32(f32s, 2, 768, norms);
+    simsimd_norms_f32(f32s, 2, 768, norms);
+    simsimd_l2sq_prenormed_f32(f32s, f32s, 1536, norms[0], norms[0], &distance);
+    simsimd_l2sq_prenormed_batch_f32(f32s, f32s, 2, 768, norms[0], norms, distances);
+    simsimd_l2sq_prenormed_cdist_f32(f32s, 1, norms, f32s, 2, norms, 768, distances);
+
     // Euclidean distance between two vectors
     simsimd_l2sq_i8(i8s, i8s, 1536, &distance);
     simsimd_l2sq_f16(f16s, f16s, 1536, &distance);
@@ -96,6 +177,7 @@ void test_distance_from_itself(void) {
     simsimd_l2sq_f64(f64s, f64s, 1536, &distance);
 
     // Inner product between two vectors
+    simsimd_dot_i8(i8s, i8s, 1536, &distance);
     simsimd_dot_f16(f16s, f16s, 1536, &distance);
     simsimd_dot_bf16(bf16s, bf16s, 1536, &distance);
     simsimd_dot_f32(f32s, f32s, 1536, &distance);
@@ -131,6 +213,1251 @@ void test_distance_from_itself(void) {
     simsimd_kl_bf16(bf16s, bf16s, 1536, &distance);
     simsimd_kl_f32(f32s, f32s, 1536, &distance);
     simsimd_kl_f64(f64s, f64s, 1536, &distance);
+
+    // Element-wise operations, applied in-place
+    simsimd_wsum_i8(i8s, i8s, 1536, 0.5, 0.5, i8s);
+    simsimd_wsum_f16(f16s, f16s, 1536, 0.5, 0.5, f16s);
+    simsimd_wsum_bf16(bf16s, bf16s, 1536, 0.5, 0.5, bf16s);
+    simsimd_wsum_f32(f32s, f32s, 1536, 0.5, 0.5, f32s);
+    simsimd_wsum_f64(f64s, f64s, 1536, 0.5, 0.5, f64s);
+    simsimd_fma_f32(f32s, f32s, f32s, 1536, 1, 0, f32s);
+    simsimd_fma_f64(f64s, f64s, f64s, 1536, 1, 0, f64s);
+    simsimd_scale_i8(i8s, 1536, 1, 0, i8s);
+    simsimd_scale_f32(f32s, 1536, 1, 0, f32s);
+
+    // L2 normalization, in-place and into a different type
+    simsimd_normalize_f32(f32s, 2, 768, f32s);
+    simsimd_normalize_bf16(bf16s, 2, 768, bf16s);
+    simsimd_normalize_f32_to_f16(f32s, 2, 768, f16s);
+    simsimd_normalize_f16_to_f32(f16s, 2, 768, f32s);
+
+    // Scalar quantization, per-dimension and per-vector
+    simsimd_f32_t mins[768], maxs[768], scales[768], offsets[768], encode_scales[768], encode_offsets[768];
+    simsimd_f32_t buffer[2];
+    simsimd_i8_affine_t headers[2];
+    simsimd_quantize_minmax_f32(f32s, 2, 768, mins, maxs);
+    simsimd_quantize_percentiles_f32(f32s, 2, 768, 0.01, buffer, mins, maxs);
+    simsimd_quantize_ranges_f32(mins, maxs, 768, scales, offsets, encode_scales, encode_offsets);
+    simsimd_affine_f32_to_i8(f32s, 768, encode_scales, encode_offsets, i8s);
+    simsimd_affine_i8_to_f32(i8s, 768, scales, offsets, f32s);
+    simsimd_quantize_vector_f32(f32s, 768, i8s, &headers[0]);
+    simsimd_quantize_vector_f32(f32s + 768, 768, i8s + 768, &headers[1]);
+    simsimd_dot_i8_affine(i8s, i8s + 768, 768, &headers[0], &headers[1], &distance);
+    simsimd_l2sq_i8_affine(i8s, i8s + 768, 768, &headers[0], &headers[1], &distance);
+    simsimd_dequantize_vector_f32(i8s, 768, &headers[0], f32s);
+
+    // Scoring a query against scattered rows
+    simsimd_u32_t ids[3] = {1, 0, 1};
+    simsimd_distance_t gathered[3];
+    simsimd_gather_cos_f32(f32s, f32s, 768 * sizeof(simsimd_f32_t), ids, 3, 768, gathered);
+    simsimd_gather_l2sq_i8(i8s, i8s, 768, ids, 3, 768, gathered);
+    simsimd_gather_dot_bf16(bf16s, bf16s, 768 * sizeof(simsimd_bf16_t), ids, 3, 768, gathered);
+    simsimd_gather_hamming_b8(b8s, b8s, 96, ids, 3, 96, gathered);
+
+    // Filtered scans and top-k selection over contiguous rows
+    simsimd_b8_t allowed = 0x02;
+    simsimd_size_t rows[2];
+    simsimd_distance_t nearest[2];
+    simsimd_l2sq_filtered_f32(f32s, f32s, 2, 768, &allowed, rows, nearest);
+    simsimd_cos_topk_f32(f32s, f32s, 2, 768, NULL, 2, rows, nearest);
+    simsimd_hamming_topk_b8(b8s, b8s, 2, 96, &allowed, 1, rows, nearest);
+    simsimd_size_t found;
+    simsimd_cos_range_f32(f32s, f32s, 2, 768, NULL, 0.1, 0, 2, rows, nearest, &found);
+    simsimd_jaccard_range_b8(b8s, b8s, 2, 96, &allowed, 0.5, 0, 1, rows, nearest, &found);
+
+    // Flat index with tombstone deletions
+    simsimd_flat_index_t index;
+    int initialized = simsimd_flat_index_init(&index, simsimd_metric_l2sq_k, simsimd_datatype_f32_k, 768);
+    int added = initialized && simsimd_flat_index_add(&index, f32s, 2);
+    assert(initialized && added);
+    simsimd_flat_index_remove(&index, 0);
+    found = simsimd_flat_index_search(&index, f32s, 1, 2, rows, nearest);
+    assert(found == 1 && rows[0] == 1);
+    found = simsimd_flat_index_search_partitioned(&index, f32s, 1, 2, rows, nearest);
+    assert(found == 1 && rows[0] == 1);
+    simsimd_flat_index_free(&index);
+
+    // Fused assignment of vectors to their nearest centroids
+    simsimd_size_t clusters[2];
+    simsimd_assign_l2sq_f32(f32s, 2, f32s, 2, 768, clusters, nearest);
+    simsimd_assign_dot_f32(f32s, 2, f32s, 1, 768, clusters, NULL);
+
+    // Distances to rows packed into panels of interleaved dimensions
+    simsimd_f32_t packed[SIMSIMD_PANEL_ROWS * 8];
+    simsimd_f32_t rows_to_pack[2 * 8] = {1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0};
+    simsimd_size_t packed_bytes = simsimd_pack_bytes_f32(2, 8);
+    assert(packed_bytes == sizeof(packed));
+    simsimd_pack_f32(rows_to_pack, 2, 8, packed);
+    simsimd_packed_dot_f32(rows_to_pack, 1, packed, 2, 8, nearest);
+    assert(nearest[0] == 1 && nearest[1] == 0);
+    simsimd_packed_l2sq_f32(f32s, 1, packed, 2, 8, nearest);
+
+    // K-means clustering of half-precision vectors into single-precision centroids
+    int clustered = simsimd_kmeans_f16(simsimd_metric_l2sq_k, f16s, 2, 768, 2, 4, f32s, clusters);
+    assert(clustered);
+    clustered = simsimd_kmeans_minibatch_bf16(simsimd_metric_cos_k, bf16s, 2, 768, 1, 4, 1, f32s, clusters);
+    assert(clustered);
+
+    // Inverted file index over two lists
+    simsimd_ivf_index_t ivf;
+    initialized = simsimd_ivf_index_init(&ivf, simsimd_metric_l2sq_k, simsimd_datatype_f32_k, 768, 2);
+    assert(initialized);
+    int trained = simsimd_ivf_index_train(&ivf, f32s, 2, 4);
+    added = trained && simsimd_ivf_index_add(&ivf, f32s, 2);
+    assert(trained && added);
+    found = simsimd_ivf_index_search(&ivf, f32s, 1, 1, 1, rows, nearest);
+    assert(found);
+    simsimd_ivf_index_free(&ivf);
+
+    // Graph index with concurrent insertions
+    simsimd_hnsw_index_t hnsw;
+    initialized = simsimd_hnsw_index_init(&hnsw, simsimd_metric_cos_k, simsimd_datatype_f16_k, 768, 2, 4, 8);
+    assert(initialized);
+    added = simsimd_hnsw_index_add(&hnsw, f16s, 2);
+    int overflowed = !simsimd_hnsw_index_add(&hnsw, f16s, 1);
+    assert(added && overflowed);
+    found = simsimd_hnsw_index_search(&hnsw, f16s, 1, 4, 2, rows, nearest);
+    assert(found);
+    simsimd_hnsw_index_free(&hnsw);
+
+    // Zero-copy views over on-disk datasets, with every row prefixed by its dimensionality
+    simsimd_u32_t fvecs[6] = {2, 0, 0, 2, 0, 0};
+    simsimd_dataset_t dataset;
+    int opened = simsimd_dataset_view(&dataset, simsimd_dataset_fvecs_k, fvecs, sizeof(fvecs));
+    void const* row = simsimd_dataset_row(&dataset, 1);
+    assert(opened && dataset.count == 2);
+    assert(row == fvecs + 4 && dataset.datatype == simsimd_datatype_f32_k);
+    opened = simsimd_dataset_open(&dataset, "missing.fbin", simsimd_dataset_unknown_k);
+    assert(!opened);
+    found = simsimd_dataset_stream_search("missing.fbin", simsimd_dataset_unknown_k, simsimd_metric_l2sq_k, f32s, 1, 2,
+                                          0, rows, nearest);
+    assert(!found);
+
+    // Tiled distance matrices and top-k scans on a work-stealing pool
+    simsimd_pool_t pool;
+    simsimd_distance_t matrix[4];
+    initialized = simsimd_pool_init(&pool, 2);
+    assert(initialized);
+    int computed = simsimd_cdist_parallel(simsimd_metric_dot_k, simsimd_datatype_f32_k, simsimd_cap_any_k, f32s, 2,
+                                          f32s, 2, 768, matrix, simsimd_pool_run, &pool);
+    assert(computed);
+    found = simsimd_topk_parallel(simsimd_metric_l2sq_k, simsimd_datatype_f32_k, simsimd_cap_any_k, f32s, 2, f32s, 2,
+                                  768, 1, rows, nearest, simsimd_pool_run, &pool);
+    assert(found == 1);
+    computed = simsimd_cdist_parallel(simsimd_metric_dot_k, simsimd_datatype_f32c_k, simsimd_cap_any_k, f32s, 1, f32s,
+                                      1, 384, matrix, NULL, NULL);
+    assert(!computed);
+    computed = simsimd_pdist_parallel(simsimd_metric_cos_k, simsimd_datatype_f32_k, simsimd_cap_any_k, rows_to_pack,
+                                      2, 8, matrix, 1, simsimd_pool_run, &pool);
+    assert(computed && matrix[0] == 0 && matrix[1] == 1 && matrix[2] == 1 && matrix[3] == 0);
+    simsimd_pool_free(&pool);
+}
+
+/**
+ *  @brief  Compares the cosine distances between vectors with subnormal squared norms with the serial kernel,
+ *          as the reciprocal square root estimates of such norms are infinite and need an exact fallback.
+ */
+void test_cos_near_zero(void) {
+    simsimd_f32_t a[16], rows[3 * 16], packed[SIMSIMD_PANEL_ROWS * 16];
+    simsimd_distance_t distances[3], expected;
+    fill_random_f32(a, 16, 55);
+    fill_random_f32(rows + 2 * 16, 16, 56);
+
+    // At this scale the products are rounded to a few bits, so only the (anti-)parallel rows are exact
+    for (simsimd_size_t i = 0; i != 16; ++i)
+        a[i] *= 1e-22f, rows[i] = a[i], rows[16 + i] = -a[i];
+    for (simsimd_size_t j = 0; j != 2; ++j) {
+        simsimd_cos_f32(a, rows + j * 16, 16, &distances[j]);
+        simsimd_cos_f32_serial(a, rows + j * 16, 16, &expected);
+        assert(is_close(distances[j], expected, 1e-5) && is_close(distances[j], j ? 2 : 0, 1e-5));
+    }
+
+    // A bit larger, the vectors keep enough precision to compare with a regular row, including the packed kernels,
+    // that use their own vectorized reciprocal square roots
+    for (simsimd_size_t i = 0; i != 16; ++i)
+        a[i] *= 100, rows[i] = a[i], rows[16 + i] = -a[i];
+    assert(simsimd_pack_bytes_f32(3, 16) == sizeof(packed));
+    simsimd_pack_f32(rows, 3, 16, packed);
+    simsimd_packed_cos_f32(a, 1, packed, 3, 16, distances);
+    for (simsimd_size_t j = 0; j != 3; ++j) {
+        simsimd_distance_t distance;
+        simsimd_cos_f32(a, rows + j * 16, 16, &distance);
+        simsimd_cos_f32_serial(a, rows + j * 16, 16, &expected);
+        assert(is_close(distance, expected, 1e-4) && is_close(distances[j], expected, 1e-4));
+    }
+}
+
+/**
+ *  @brief  Checks that a backend-specific `kernel` matches the `serial` one on the same inputs.
+ */
+void assert_same_distance(simsimd_metric_punned_t kernel, simsimd_metric_punned_t serial, void const* a,
+                          void const* b, simsimd_size_t n, simsimd_distance_t tolerance) {
+    simsimd_distance_t result, expected;
+    kernel(a, b, n, &result);
+    serial(a, b, n, &expected);
+    assert(is_close(result, expected, tolerance));
+}
+
+/**
+ *  @brief  Compares the kernels of the compiled backends, which the dispatch may skip over on this machine,
+ *          with the serial kernels, on lengths that aren't multiples of any register width.
+ */
+void test_backends(void) {
+    simsimd_f32_t a[1001], b[1001];
+    simsimd_bf16_t a_bf16[1001], b_bf16[1001];
+    simsimd_i8_t a_i8[1001], b_i8[1001];
+    simsimd_b8_t ones_b8[1001], zeros_b8[1001];
+    fill_random_f32(a, 1001, 61), fill_random_f32(b, 1001, 62);
+    simsimd_scale_f32_to_bf16_serial(a, 1001, 1, 0, a_bf16), simsimd_scale_f32_to_bf16_serial(b, 1001, 1, 0, b_bf16);
+    simsimd_scale_f32_to_i8_serial(a, 1001, 127, 0, a_i8), simsimd_scale_f32_to_i8_serial(b, 1001, 127, 0, b_i8);
+    // The largest absolute difference of two bytes must not wrap around
+    a_i8[0] = -128, b_i8[0] = 127;
+    // Every byte differs in all 8 bits, so the population counts overflow any 8-bit accumulator
+    memset(ones_b8, 0xFF, sizeof(ones_b8)), memset(zeros_b8, 0, sizeof(zeros_b8));
+
+#if SIMSIMD_TARGET_SVE
+    assert_same_distance((simsimd_metric_punned_t)&simsimd_dot_i8_sve, (simsimd_metric_punned_t)&simsimd_dot_i8_serial,
+                         a_i8, b_i8, 1001, 0);
+    assert_same_distance((simsimd_metric_punned_t)&simsimd_l2sq_i8_sve,
+                         (simsimd_metric_punned_t)&simsimd_l2sq_i8_serial, a_i8, b_i8, 1001, 0);
+    assert_same_distance((simsimd_metric_punned_t)&simsimd_cos_i8_sve, (simsimd_metric_punned_t)&simsimd_cos_i8_serial,
+                         a_i8, b_i8, 1001, 1e-5);
+    assert_same_distance((simsimd_metric_punned_t)&simsimd_hamming_b8_sve,
+                         (simsimd_metric_punned_t)&simsimd_hamming_b8_serial, ones_b8, zeros_b8, 1001, 0);
+    assert_same_distance((simsimd_metric_punned_t)&simsimd_hamming_b8_sve,
+                         (simsimd_metric_punned_t)&simsimd_hamming_b8_serial, a_i8, b_i8, 1001, 0);
+    assert_same_distance((simsimd_metric_punned_t)&simsimd_jaccard_b8_sve,
+                         (simsimd_metric_punned_t)&simsimd_jaccard_b8_serial, a_i8, b_i8, 1001, 1e-6);
+    assert_same_distance((simsimd_metric_punned_t)&simsimd_jaccard_b8_sve,
+                         (simsimd_metric_punned_t)&simsimd_jaccard_b8_serial, ones_b8, a_i8, 1001, 1e-6);
+#if SIMSIMD_TARGET_NEON_BF16
+    // The `bf16` dot-products round their pairwise sums differently from the serial `f32` accumulation
+    assert_same_distance((simsimd_metric_punned_t)&simsimd_dot_bf16_sve,
+                         (simsimd_metric_punned_t)&simsimd_dot_bf16_serial, a_bf16, b_bf16, 1001, 1e-3);
+    assert_same_distance((simsimd_metric_punned_t)&simsimd_cos_bf16_sve,
+                         (simsimd_metric_punned_t)&simsimd_cos_bf16_serial, a_bf16, b_bf16, 1001, 1e-3);
+    assert_same_distance((simsimd_metric_punned_t)&simsimd_l2sq_bf16_sve,
+                         (simsimd_metric_punned_t)&simsimd_l2sq_bf16_serial, a_bf16, b_bf16, 1001, 1e-4);
+#endif
+#endif
+
+#if SIMSIMD_TARGET_ALDER
+    assert_same_distance((simsimd_metric_punned_t)&simsimd_dot_i8_alder,
+                         (simsimd_metric_punned_t)&simsimd_dot_i8_serial, a_i8, b_i8, 1001, 0);
+    assert_same_distance((simsimd_metric_punned_t)&simsimd_l2sq_i8_alder,
+                         (simsimd_metric_punned_t)&simsimd_l2sq_i8_serial, a_i8, b_i8, 1001, 0);
+    assert_same_distance((simsimd_metric_punned_t)&simsimd_cos_i8_alder,
+                         (simsimd_metric_punned_t)&simsimd_cos_i8_serial, a_i8, b_i8, 1001, 1e-5);
+    assert_same_distance((simsimd_metric_punned_t)&simsimd_cos_i8_alder,
+                         (simsimd_metric_punned_t)&simsimd_cos_i8_serial, a_i8, a_i8, 1001, 1e-5);
+#endif
+
+#if SIMSIMD_TARGET_GENOA
+    // Divergences are defined for probability distributions, so the inputs are normalized absolute values
+    simsimd_f32_t sum_a = 0, sum_b = 0;
+    for (simsimd_size_t i = 0; i != 1001; ++i)
+        a[i] = fabsf(a[i]) + 1e-3f, b[i] = fabsf(b[i]) + 1e-3f, sum_a += a[i], sum_b += b[i];
+    simsimd_scale_f32_to_bf16_serial(a, 1001, 1 / sum_a, 0, a_bf16);
+    simsimd_scale_f32_to_bf16_serial(b, 1001, 1 / sum_b, 0, b_bf16);
+    assert_same_distance((simsimd_metric_punned_t)&simsimd_kl_bf16_genoa,
+                         (simsimd_metric_punned_t)&simsimd_kl_bf16_serial, a_bf16, b_bf16, 1001, 1e-3);
+    assert_same_distance((simsimd_metric_punned_t)&simsimd_js_bf16_genoa,
+                         (simsimd_metric_punned_t)&simsimd_js_bf16_serial, a_bf16, b_bf16, 1001, 1e-3);
+    assert_same_distance((simsimd_metric_punned_t)&simsimd_kl_bf16_genoa,
+                         (simsimd_metric_punned_t)&simsimd_kl_bf16_serial, a_bf16, a_bf16, 1001, 1e-4);
+    // Identical distributions, including a single-element one, diverge by exactly zero, never by a negative value
+    simsimd_distance_t divergence;
+    simsimd_js_bf16_genoa(a_bf16, a_bf16, 1001, &divergence);
+    assert(divergence >= 0 && divergence < 1e-4);
+    for (simsimd_size_t n = 1; n != 17; ++n) {
+        simsimd_js_bf16_genoa(a_bf16 + 100, a_bf16 + 100, n, &divergence);
+        assert(divergence >= 0 && divergence < 1e-4);
+    }
+#endif
+}
+
+/**
+ *  @brief  Compares the weighted sums, FMAs and scaling of vectors, which aren't multiples of the register widths,
+ *          with the serial kernels, converting the half-precision outputs back to `f32`. The `i8` outputs must match
+ *          exactly, so their multipliers are powers of two, producing rounding ties that must break away from zero.
+ */
+void test_elementwise(void) {
+    simsimd_f32_t a[37], b[37], c[37], result[37], expected[37];
+    simsimd_f64_t a_f64[37], b_f64[37], c_f64[37], result_f64[37], expected_f64[37];
+    simsimd_f16_t a_f16[37], b_f16[37], c_f16[37], result_f16[37], expected_f16[37];
+    simsimd_bf16_t a_bf16[37], b_bf16[37], c_bf16[37], result_bf16[37], expected_bf16[37];
+    simsimd_i8_t a_i8[37], b_i8[37], c_i8[37], result_i8[37], expected_i8[37];
+    fill_random_f32(a, 37, 58), fill_random_f32(b, 37, 59), fill_random_f32(c, 37, 60);
+    for (simsimd_size_t i = 0; i != 37; ++i)
+        a_f64[i] = a[i], b_f64[i] = b[i], c_f64[i] = c[i];
+    simsimd_scale_f32_to_f16_serial(a, 37, 1, 0, a_f16), simsimd_scale_f32_to_f16_serial(b, 37, 1, 0, b_f16);
+    simsimd_scale_f32_to_f16_serial(c, 37, 1, 0, c_f16);
+    simsimd_scale_f32_to_bf16_serial(a, 37, 1, 0, a_bf16), simsimd_scale_f32_to_bf16_serial(b, 37, 1, 0, b_bf16);
+    simsimd_scale_f32_to_bf16_serial(c, 37, 1, 0, c_bf16);
+    simsimd_scale_f32_to_i8_serial(a, 37, 100, 0, a_i8), simsimd_scale_f32_to_i8_serial(b, 37, 100, 0, b_i8);
+    simsimd_scale_f32_to_i8_serial(c, 37, 100, 0, c_i8);
+
+    for (int operation = 0; operation != 3; ++operation) {
+        simsimd_distance_t const alpha = 0.7, beta = -1.3, alpha_i8 = 0.5, beta_i8 = -1.25;
+        if (operation == 0) {
+            simsimd_wsum_f32(a, b, 37, alpha, beta, result), simsimd_wsum_f32_serial(a, b, 37, alpha, beta, expected);
+            simsimd_wsum_f64(a_f64, b_f64, 37, alpha, beta, result_f64);
+            simsimd_wsum_f64_serial(a_f64, b_f64, 37, alpha, beta, expected_f64);
+            simsimd_wsum_f16(a_f16, b_f16, 37, alpha, beta, result_f16);
+            simsimd_wsum_f16_serial(a_f16, b_f16, 37, alpha, beta, expected_f16);
+            simsimd_wsum_bf16(a_bf16, b_bf16, 37, alpha, beta, result_bf16);
+            simsimd_wsum_bf16_serial(a_bf16, b_bf16, 37, alpha, beta, expected_bf16);
+            simsimd_wsum_i8(a_i8, b_i8, 37, alpha_i8, beta_i8, result_i8);
+            simsimd_wsum_i8_serial(a_i8, b_i8, 37, alpha_i8, beta_i8, expected_i8);
+        }
+        else if (operation == 1) {
+            simsimd_fma_f32(a, b, c, 37, alpha, beta, result);
+            simsimd_fma_f32_serial(a, b, c, 37, alpha, beta, expected);
+            simsimd_fma_f64(a_f64, b_f64, c_f64, 37, alpha, beta, result_f64);
+            simsimd_fma_f64_serial(a_f64, b_f64, c_f64, 37, alpha, beta, expected_f64);
+            simsimd_fma_f16(a_f16, b_f16, c_f16, 37, alpha, beta, result_f16);
+            simsimd_fma_f16_serial(a_f16, b_f16, c_f16, 37, alpha, beta, expected_f16);
+            simsimd_fma_bf16(a_bf16, b_bf16, c_bf16, 37, alpha, beta, result_bf16);
+            simsimd_fma_bf16_serial(a_bf16, b_bf16, c_bf16, 37, alpha, beta, expected_bf16);
+            // Products of two codes need a smaller multiplier to stay in range
+            simsimd_fma_i8(a_i8, b_i8, c_i8, 37, alpha_i8 / 16, beta_i8, result_i8);
+            simsimd_fma_i8_serial(a_i8, b_i8, c_i8, 37, alpha_i8 / 16, beta_i8, expected_i8);
+        }
+        else {
+            simsimd_scale_f32(a, 37, alpha, beta, result), simsimd_scale_f32_serial(a, 37, alpha, beta, expected);
+            simsimd_scale_f64(a_f64, 37, alpha, beta, result_f64);
+            simsimd_scale_f64_serial(a_f64, 37, alpha, beta, expected_f64);
+            simsimd_scale_f16(a_f16, 37, alpha, beta, result_f16);
+            simsimd_scale_f16_serial(a_f16, 37, alpha, beta, expected_f16);
+            simsimd_scale_bf16(a_bf16, 37, alpha, beta, result_bf16);
+            simsimd_scale_bf16_serial(a_bf16, 37, alpha, beta, expected_bf16);
+            simsimd_scale_i8(a_i8, 37, alpha_i8, beta_i8, result_i8);
+            simsimd_scale_i8_serial(a_i8, 37, alpha_i8, beta_i8, expected_i8);
+        }
+        for (simsimd_size_t i = 0; i != 37; ++i) {
+            assert(is_close(result[i], expected[i], 1e-6) && is_close(result_f64[i], expected_f64[i], 1e-12));
+            assert(result_i8[i] == expected_i8[i]);
+        }
+        simsimd_scale_f16_to_f32_serial(result_f16, 37, 1, 0, result);
+        simsimd_scale_f16_to_f32_serial(expected_f16, 37, 1, 0, expected);
+        for (simsimd_size_t i = 0; i != 37; ++i)
+            assert(is_close(result[i], expected[i], 1e-3));
+        // Truncating the mantissa may lose one more bit
+        simsimd_scale_bf16_to_f32_serial(result_bf16, 37, 1, 0, result);
+        simsimd_scale_bf16_to_f32_serial(expected_bf16, 37, 1, 0, expected);
+        for (simsimd_size_t i = 0; i != 37; ++i)
+            assert(is_close(result[i], expected[i], 1e-2));
+    }
+
+    // Exact ties, saturated values and values just below a half, spanning more than one register
+    simsimd_f32_t const ties[19] = {0.5f, 1.5f, 2.5f, -0.5f, -1.5f, -2.5f, 126.5f, -127.5f, 127.5f, -128.5f,
+                                    200.f, -200.f, 0.499f, -0.499f, 3.5f, -3.5f, 0.f, -0.f, 64.5f};
+    simsimd_i8_t const rounded[19] = {1, 2, 3, -1, -2, -3, 127, -128, 127, -128, 127, -128, 0, 0, 4, -4, 0, 0, 65};
+    simsimd_scale_f32_to_i8(ties, 19, 1, 0, result_i8);
+    simsimd_scale_f32_to_i8_serial(ties, 19, 1, 0, expected_i8);
+    for (simsimd_size_t i = 0; i != 19; ++i)
+        assert(result_i8[i] == rounded[i] && expected_i8[i] == rounded[i]);
+}
+
+/**
+ *  @brief  Normalizes a few rows, including a zero one, and compares them with the rows divided by their norms.
+ */
+void test_normalize(void) {
+    simsimd_f32_t a[3 * 37], result[3 * 37], expected[3 * 37], converted[3 * 37];
+    simsimd_f16_t result_f16[3 * 37];
+    simsimd_bf16_t result_bf16[3 * 37];
+    fill_random_f32(a, 3 * 37, 59);
+    memset(a + 37, 0, 37 * sizeof(simsimd_f32_t));
+    for (simsimd_size_t row = 0; row != 3; ++row) {
+        simsimd_f64_t norm_squared = 0;
+        for (simsimd_size_t i = 0; i != 37; ++i)
+            norm_squared += (simsimd_f64_t)a[row * 37 + i] * a[row * 37 + i];
+        for (simsimd_size_t i = 0; i != 37; ++i)
+            expected[row * 37 + i] = norm_squared ? (simsimd_f32_t)(a[row * 37 + i] / sqrt(norm_squared)) : 0;
+    }
+
+    simsimd_normalize_f32(a, 3, 37, result);
+    for (simsimd_size_t i = 0; i != 3 * 37; ++i)
+        assert(is_close(result[i], expected[i], 1e-5));
+
+    // Every compiled fused kernel must match, exporting exact zeros for the zero row
+    simsimd_kernel_normalize_punned_t const kernels[] = {
+        (simsimd_kernel_normalize_punned_t)&simsimd_normalize_f32_serial,
+#if SIMSIMD_TARGET_NEON
+        (simsimd_kernel_normalize_punned_t)&simsimd_normalize_f32_neon,
+#endif
+#if SIMSIMD_TARGET_HASWELL
+        (simsimd_kernel_normalize_punned_t)&simsimd_normalize_f32_haswell,
+#endif
+#if SIMSIMD_TARGET_SKYLAKE
+        (simsimd_kernel_normalize_punned_t)&simsimd_normalize_f32_skylake,
+#endif
+    };
+    for (simsimd_size_t k = 0; k != sizeof(kernels) / sizeof(kernels[0]); ++k) {
+        kernels[k](a, 3, 37, result);
+        for (simsimd_size_t i = 0; i != 3 * 37; ++i)
+            assert(is_close(result[i], expected[i], 1e-6) && (i / 37 != 1 || result[i] == 0));
+    }
+
+    // Half-precision outputs are compared in `f32`, and normalized once more on the way back
+    simsimd_normalize_f32_to_f16(a, 3, 37, result_f16);
+    simsimd_scale_f16_to_f32_serial(result_f16, 3 * 37, 1, 0, converted);
+    for (simsimd_size_t i = 0; i != 3 * 37; ++i)
+        assert(is_close(converted[i], expected[i], 1e-3));
+    simsimd_normalize_f16_to_f32(result_f16, 3, 37, result);
+    for (simsimd_size_t i = 0; i != 3 * 37; ++i)
+        assert(is_close(result[i], expected[i], 2e-3));
+    simsimd_normalize_f32_to_bf16(a, 3, 37, result_bf16);
+    simsimd_scale_bf16_to_f32_serial(result_bf16, 3 * 37, 1, 0, converted);
+    for (simsimd_size_t i = 0; i != 3 * 37; ++i)
+        assert(is_close(converted[i], expected[i], 1e-2));
+    simsimd_normalize_bf16_to_f32(result_bf16, 3, 37, result);
+    for (simsimd_size_t i = 0; i != 3 * 37; ++i)
+        assert(is_close(result[i], expected[i], 2e-2));
+
+    // In-place normalization must match the out-of-place one
+    memcpy(result, a, sizeof(a));
+    simsimd_normalize_f32(result, 3, 37, result);
+    for (simsimd_size_t i = 0; i != 3 * 37; ++i)
+        assert(is_close(result[i], expected[i], 1e-5));
+}
+
+/**
+ *  @brief  Compares the cached norms and the distances computed from them with the serial kernels,
+ *          for every pair of queries and rows, including a zero query and a zero row.
+ */
+void test_prenormed(void) {
+    simsimd_f32_t a[2 * 37], b[4 * 37];
+    simsimd_f64_t a_f64[2 * 37], b_f64[4 * 37];
+    simsimd_i8_t a_i8[2 * 37], b_i8[4 * 37];
+    simsimd_distance_t a_norms[2], b_norms[4], squared[4], matrix[2 * 4], batch[4], distance, expected;
+    fill_random_f32(a, 2 * 37, 67), fill_random_f32(b, 4 * 37, 68);
+    memset(a + 37, 0, 37 * sizeof(simsimd_f32_t)), memset(b + 2 * 37, 0, 37 * sizeof(simsimd_f32_t));
+    memcpy(b + 3 * 37, a, 37 * sizeof(simsimd_f32_t)); // Identical to the first query, to check the cancellation
+    for (simsimd_size_t i = 0; i != 2 * 37; ++i)
+        a_f64[i] = a[i];
+    for (simsimd_size_t i = 0; i != 4 * 37; ++i)
+        b_f64[i] = b[i];
+    simsimd_scale_f32_to_i8_serial(a, 2 * 37, 100, 0, a_i8), simsimd_scale_f32_to_i8_serial(b, 4 * 37, 100, 0, b_i8);
+
+    // Norms are the square roots of the squared norms, which are the dot-products of the rows with themselves
+    simsimd_norms_f32(b, 4, 37, b_norms);
+    simsimd_norms_squared_f32(b, 4, 37, squared);
+    for (simsimd_size_t j = 0; j != 4; ++j) {
+        simsimd_dot_f32_serial(b + j * 37, b + j * 37, 37, &expected);
+        assert(is_close(squared[j], expected, 1e-6) && is_close(b_norms[j], sqrt(expected), 1e-6));
+    }
+    assert(b_norms[2] == 0 && squared[2] == 0);
+
+    // Single pairs, batches, and matrices must agree with each other and with the regular kernels
+    simsimd_norms_f32(a, 2, 37, a_norms);
+    for (int metric = 0; metric != 2; ++metric) {
+        if (metric == 0)
+            simsimd_cos_prenormed_cdist_f32(a, 2, a_norms, b, 4, b_norms, 37, matrix);
+        else
+            simsimd_l2sq_prenormed_cdist_f32(a, 2, a_norms, b, 4, b_norms, 37, matrix);
+        for (simsimd_size_t i = 0; i != 2; ++i) {
+            if (metric == 0)
+                simsimd_cos_prenormed_batch_f32(a + i * 37, b, 4, 37, a_norms[i], b_norms, batch);
+            else
+                simsimd_l2sq_prenormed_batch_f32(a + i * 37, b, 4, 37, a_norms[i], b_norms, batch);
+            for (simsimd_size_t j = 0; j != 4; ++j) {
+                simsimd_f32_t const *query = a + i * 37, *row = b + j * 37;
+                if (metric == 0) {
+                    simsimd_cos_prenormed_f32(query, row, 37, a_norms[i], b_norms[j], &distance);
+                    simsimd_cos_f32_serial(query, row, 37, &expected);
+                }
+                else {
+                    simsimd_l2sq_prenormed_f32(query, row, 37, a_norms[i], b_norms[j], &distance);
+                    simsimd_l2sq_f32_serial(query, row, 37, &expected);
+                }
+                assert(distance == batch[j] && distance == matrix[i * 4 + j]);
+                assert(is_close(distance, expected, 1e-5) && distance >= 0);
+            }
+        }
+    }
+
+    // Double-precision and integer rows have exact norms, but the serial cosine uses the approximate reciprocal root
+    simsimd_norms_f64(a_f64, 2, 37, a_norms), simsimd_norms_f64(b_f64, 4, 37, b_norms);
+    for (simsimd_size_t i = 0; i != 2; ++i)
+        for (simsimd_size_t j = 0; j != 4; ++j) {
+            simsimd_cos_prenormed_f64(a_f64 + i * 37, b_f64 + j * 37, 37, a_norms[i], b_norms[j], &distance);
+            simsimd_cos_f64_serial(a_f64 + i * 37, b_f64 + j * 37, 37, &expected);
+            assert(is_close(distance, expected, 1e-6));
+            simsimd_l2sq_prenormed_f64(a_f64 + i * 37, b_f64 + j * 37, 37, a_norms[i], b_norms[j], &distance);
+            simsimd_l2sq_f64_serial(a_f64 + i * 37, b_f64 + j * 37, 37, &expected);
+            assert(is_close(distance, expected, 1e-12));
+        }
+    simsimd_norms_i8(a_i8, 2, 37, a_norms), simsimd_norms_i8(b_i8, 4, 37, b_norms);
+    for (simsimd_size_t i = 0; i != 2; ++i)
+        for (simsimd_size_t j = 0; j != 4; ++j) {
+            simsimd_cos_prenormed_i8(a_i8 + i * 37, b_i8 + j * 37, 37, a_norms[i], b_norms[j], &distance);
+            simsimd_cos_i8_serial(a_i8 + i * 37, b_i8 + j * 37, 37, &expected);
+            assert(is_close(distance, expected, 1e-6));
+            simsimd_l2sq_prenormed_i8(a_i8 + i * 37, b_i8 + j * 37, 37, a_norms[i], b_norms[j], &distance);
+            simsimd_l2sq_i8_serial(a_i8 + i * 37, b_i8 + j * 37, 37, &expected);
+            assert(is_close(distance, expected, 1e-9));
+        }
+}
+
+/**
+ *  @brief  Compares every compiled packed kernel with the serial pairwise kernels, using more queries than
+ *          a micro-kernel handles at once, several panels with a partial last one, and an odd dimensionality.
+ */
+void test_packed(void) {
+    enum { queries = 7, rows = 37, dims = 37 };
+    simsimd_f32_t a[queries * dims], b[rows * dims], packed[3 * SIMSIMD_PANEL_ROWS * dims];
+    simsimd_distance_t results[queries * rows], expected;
+    fill_random_f32(a, queries * dims, 74), fill_random_f32(b, rows * dims, 75);
+    memset(b + 20 * dims, 0, dims * sizeof(simsimd_f32_t)); // A zero row in the middle of the second panel
+    memcpy(b + 36 * dims, a, dims * sizeof(simsimd_f32_t)); // The first query, as the last row of the last panel
+    assert(simsimd_pack_bytes_f32(rows, dims) == sizeof(packed));
+    simsimd_pack_f32(b, rows, dims, packed);
+
+    struct {
+        simsimd_metric_kind_t metric;
+        simsimd_kernel_packed_punned_t kernel;
+    } const kernels[] = {
+        {simsimd_metric_l2sq_k, (simsimd_kernel_packed_punned_t)&simsimd_packed_l2sq_f32_serial},
+        {simsimd_metric_dot_k, (simsimd_kernel_packed_punned_t)&simsimd_packed_dot_f32_serial},
+        {simsimd_metric_cos_k, (simsimd_kernel_packed_punned_t)&simsimd_packed_cos_f32_serial},
+#if SIMSIMD_TARGET_NEON
+        {simsimd_metric_l2sq_k, (simsimd_kernel_packed_punned_t)&simsimd_packed_l2sq_f32_neon},
+        {simsimd_metric_dot_k, (simsimd_kernel_packed_punned_t)&simsimd_packed_dot_f32_neon},
+        {simsimd_metric_cos_k, (simsimd_kernel_packed_punned_t)&simsimd_packed_cos_f32_neon},
+#endif
+#if SIMSIMD_TARGET_HASWELL
+        {simsimd_metric_l2sq_k, (simsimd_kernel_packed_punned_t)&simsimd_packed_l2sq_f32_haswell},
+        {simsimd_metric_dot_k, (simsimd_kernel_packed_punned_t)&simsimd_packed_dot_f32_haswell},
+        {simsimd_metric_cos_k, (simsimd_kernel_packed_punned_t)&simsimd_packed_cos_f32_haswell},
+#endif
+#if SIMSIMD_TARGET_SKYLAKE
+        {simsimd_metric_l2sq_k, (simsimd_kernel_packed_punned_t)&simsimd_packed_l2sq_f32_skylake},
+        {simsimd_metric_dot_k, (simsimd_kernel_packed_punned_t)&simsimd_packed_dot_f32_skylake},
+        {simsimd_metric_cos_k, (simsimd_kernel_packed_punned_t)&simsimd_packed_cos_f32_skylake},
+#endif
+    };
+    for (simsimd_size_t k = 0; k != sizeof(kernels) / sizeof(kernels[0]); ++k) {
+        for (simsimd_size_t i = 0; i != queries * rows; ++i)
+            results[i] = -42;
+        kernels[k].kernel(a, queries, packed, rows, dims, results);
+        for (simsimd_size_t i = 0; i != queries; ++i)
+            for (simsimd_size_t j = 0; j != rows; ++j) {
+                simsimd_f32_t const *query = a + i * dims, *row = b + j * dims;
+                switch (kernels[k].metric) {
+                case simsimd_metric_l2sq_k: simsimd_l2sq_f32_serial(query, row, dims, &expected); break;
+                case simsimd_metric_dot_k: simsimd_dot_f32_serial(query, row, dims, &expected); break;
+                default: simsimd_cos_f32_serial(query, row, dims, &expected); break;
+                }
+                assert(is_close(results[i * rows + j], expected, 1e-5));
+            }
+    }
+
+    // The dispatched kernels must agree with the serial ones as well
+    simsimd_packed_cos_f32(a, queries, packed, rows, dims, results);
+    for (simsimd_size_t j = 0; j != rows; ++j) {
+        simsimd_cos_f32_serial(a, b + j * dims, dims, &expected);
+        assert(is_close(results[j], expected, 1e-5));
+    }
+    simsimd_packed_l2sq_f32(a + (queries - 1) * dims, 1, packed, rows, dims, results);
+    for (simsimd_size_t j = 0; j != rows; ++j) {
+        simsimd_l2sq_f32_serial(a + (queries - 1) * dims, b + j * dims, dims, &expected);
+        assert(is_close(results[j], expected, 1e-5));
+    }
+}
+
+/**
+ *  @brief  Compares the tiled distance matrices and the chunked top-k scans, executed by a pool of several threads,
+ *          with the serial kernels and the single-threaded top-k selections. The top-k base is larger than a chunk
+ *          of `SIMSIMD_PARALLEL_TILE * SIMSIMD_PARALLEL_TILE` rows, so the candidates of several chunks are merged.
+ */
+void test_parallel(void) {
+    enum { a_count = 50, b_count = 300, dims = 37, queries = 3, k = 10, top_dims = 8 };
+    simsimd_size_t const count = 2 * SIMSIMD_PARALLEL_TILE * SIMSIMD_PARALLEL_TILE + 123;
+    simsimd_f32_t a[a_count * dims], b[b_count * dims], top_queries[queries * top_dims];
+    simsimd_f32_t* base = (simsimd_f32_t*)malloc(count * top_dims * sizeof(simsimd_f32_t));
+    simsimd_distance_t* matrix = (simsimd_distance_t*)malloc(a_count * b_count * sizeof(simsimd_distance_t));
+    simsimd_size_t ids[queries * k], expected_ids[k], a_tile, b_tile;
+    simsimd_distance_t distances[queries * k], expected_distances[k], expected;
+    simsimd_pool_t pool;
+    assert(base && matrix);
+    int initialized = simsimd_pool_init(&pool, 3);
+    assert(initialized);
+    fill_random_f32(a, a_count * dims, 72), fill_random_f32(b, b_count * dims, 73);
+    fill_random_f32(top_queries, queries * top_dims, 76), fill_random_f32(base, count * top_dims, 77);
+    memset(b + 100 * dims, 0, dims * sizeof(simsimd_f32_t)); // A zero row for the cosine distance
+
+    // The matrices are split into many tiles, each filling a different part of the output
+    simsimd_cdist_tiles(dims * sizeof(simsimd_f32_t), a_count, b_count, &a_tile, &b_tile);
+    assert(a_tile < a_count && b_tile < b_count);
+    simsimd_metric_kind_t const metrics[3] = {simsimd_metric_l2sq_k, simsimd_metric_cos_k, simsimd_metric_dot_k};
+    simsimd_metric_punned_t const serial[3] = {(simsimd_metric_punned_t)&simsimd_l2sq_f32_serial,
+                                               (simsimd_metric_punned_t)&simsimd_cos_f32_serial,
+                                               (simsimd_metric_punned_t)&simsimd_dot_f32_serial};
+    for (simsimd_size_t m = 0; m != 3; ++m) {
+        for (simsimd_size_t i = 0; i != a_count * b_count; ++i)
+            matrix[i] = -42;
+        int computed = simsimd_cdist_parallel(metrics[m], simsimd_datatype_f32_k, simsimd_cap_any_k, a, a_count, b,
+                                              b_count, dims, matrix, simsimd_pool_run, &pool);
+        assert(computed);
+        for (simsimd_size_t i = 0; i != a_count; ++i)
+            for (simsimd_size_t j = 0; j != b_count; ++j) {
+                serial[m](a + i * dims, b + j * dims, dims, &expected);
+                assert(is_close(matrix[i * b_count + j], expected, 1e-5));
+            }
+    }
+
+    // Every query is scanned in several chunks, merged into the same results as a single-threaded selection
+    simsimd_size_t found = simsimd_topk_parallel(simsimd_metric_l2sq_k, simsimd_datatype_f32_k, simsimd_cap_any_k,
+                                                 top_queries, queries, base, count, top_dims, k, ids, distances,
+                                                 simsimd_pool_run, &pool);
+    assert(found == k);
+    for (simsimd_size_t q = 0; q != queries; ++q) {
+        found = simsimd_l2sq_topk_f32(top_queries + q * top_dims, base, count, top_dims, NULL, k, expected_ids,
+                                      expected_distances);
+        assert(found == k);
+        for (simsimd_size_t j = 0; j != k; ++j) {
+            assert(ids[q * k + j] == expected_ids[j] && distances[q * k + j] == expected_distances[j]);
+            simsimd_l2sq_f32_serial(top_queries + q * top_dims, base + ids[q * k + j] * top_dims, top_dims, &expected);
+            assert(is_close(distances[q * k + j], expected, 1e-5));
+        }
+    }
+    found = simsimd_topk_parallel(simsimd_metric_cos_k, simsimd_datatype_f32_k, simsimd_cap_any_k, top_queries,
+                                  queries, base, count, top_dims, k, ids, distances, simsimd_pool_run, &pool);
+    assert(found == k);
+    for (simsimd_size_t q = 0; q != queries; ++q) {
+        found = simsimd_cos_topk_f32(top_queries + q * top_dims, base, count, top_dims, NULL, k, expected_ids,
+                                     expected_distances);
+        assert(found == k);
+        for (simsimd_size_t j = 0; j != k; ++j)
+            assert(ids[q * k + j] == expected_ids[j] && distances[q * k + j] == expected_distances[j]);
+    }
+
+    // Inner products are selected from the largest, and no other row has a larger one than the last selected
+    found = simsimd_topk_parallel(simsimd_metric_dot_k, simsimd_datatype_f32_k, simsimd_cap_any_k, top_queries,
+                                  queries, base, count, top_dims, k, ids, distances, simsimd_pool_run, &pool);
+    assert(found == k);
+    for (simsimd_size_t q = 0; q != queries; ++q) {
+        for (simsimd_size_t j = 1; j != k; ++j)
+            assert(distances[q * k + j - 1] >= distances[q * k + j]);
+        for (simsimd_size_t i = 0; i != count; ++i) {
+            int selected = 0;
+            for (simsimd_size_t j = 0; j != k; ++j)
+                selected |= ids[q * k + j] == i;
+            simsimd_dot_f32_serial(top_queries + q * top_dims, base + i * top_dims, top_dims, &expected);
+            assert(selected || expected <= distances[q * k + k - 1] + 1e-5);
+        }
+    }
+
+    simsimd_pool_free(&pool);
+    free(matrix), free(base);
+}
+
+/**
+ *  @brief  Compares the symmetric distance matrices, split into many square tiles, with the serial kernels,
+ *          checking that the lower triangle is either mirrored or left untouched.
+ */
+void test_pdist(void) {
+    enum { count = 61, dims = 37 };
+    simsimd_f32_t a[count * dims];
+    simsimd_distance_t matrix[count * count], expected;
+    simsimd_size_t a_tile, tile;
+    simsimd_pool_t pool;
+    int initialized = simsimd_pool_init(&pool, 3);
+    assert(initialized);
+    fill_random_f32(a, count * dims, 78);
+    memset(a + 7 * dims, 0, dims * sizeof(simsimd_f32_t));  // A zero row for the cosine distance
+    memcpy(a + 50 * dims, a, dims * sizeof(simsimd_f32_t)); // A duplicate row in a different tile
+
+    // Several tiles per row of tiles, so tasks are mapped back to the tiles of the upper triangle by a search
+    simsimd_cdist_tiles(dims * sizeof(simsimd_f32_t), count, count, &a_tile, &tile);
+    assert(tile * 2 < count);
+    simsimd_metric_kind_t const metrics[2] = {simsimd_metric_cos_k, simsimd_metric_l2sq_k};
+    simsimd_metric_punned_t const serial[2] = {(simsimd_metric_punned_t)&simsimd_cos_f32_serial,
+                                               (simsimd_metric_punned_t)&simsimd_l2sq_f32_serial};
+    for (simsimd_size_t m = 0; m != 2; ++m)
+        for (int mirror = 0; mirror != 2; ++mirror) {
+            for (simsimd_size_t i = 0; i != count * count; ++i)
+                matrix[i] = -42;
+            int computed = simsimd_pdist_parallel(metrics[m], simsimd_datatype_f32_k, simsimd_cap_any_k, a, count,
+                                                  dims, matrix, mirror, simsimd_pool_run, &pool);
+            assert(computed);
+            for (simsimd_size_t i = 0; i != count; ++i)
+                for (simsimd_size_t j = 0; j != count; ++j) {
+                    simsimd_distance_t const distance = matrix[i * count + j];
+                    if (j < i && !mirror) {
+                        assert(distance == -42);
+                        continue;
+                    }
+                    serial[m](a + i * dims, a + j * dims, dims, &expected);
+                    assert(is_close(distance, expected, 1e-5) && (j >= i || distance == matrix[j * count + i]));
+                }
+            assert(matrix[50] < 1e-5 && (m == 1 || matrix[7 * count + 7] == 1));
+        }
+
+    // The upper triangle matches the full matrix computed by the tiled many-to-many driver
+    simsimd_distance_t full[count * count];
+    int computed = simsimd_cdist_parallel(simsimd_metric_cos_k, simsimd_datatype_f32_k, simsimd_cap_any_k, a, count,
+                                          a, count, dims, full, simsimd_pool_run, &pool);
+    assert(computed);
+    computed = simsimd_pdist_parallel(simsimd_metric_cos_k, simsimd_datatype_f32_k, simsimd_cap_any_k, a, count, dims,
+                                      matrix, 1, simsimd_pool_run, &pool);
+    assert(computed);
+    for (simsimd_size_t i = 0; i != count * count; ++i)
+        assert(is_close(matrix[i], full[i], 1e-5));
+    simsimd_pool_free(&pool);
+}
+
+/**
+ *  @brief  Compares the distances between quantized vectors with the distances between the decoded vectors,
+ *          and the per-dimension encoders and decoders with their serial versions.
+ */
+void test_quantization(void) {
+    simsimd_f32_t vectors[2 * 100], decoded[2 * 100], reference[100];
+    simsimd_f32_t mins[100], maxs[100], scales[100], offsets[100], encode_scales[100], encode_offsets[100];
+    simsimd_i8_t codes[2 * 100], reference_codes[100];
+    simsimd_i8_affine_t headers[2];
+    simsimd_distance_t distance, expected;
+    fill_random_f32(vectors, 2 * 100, 60);
+
+    // Per-vector quantization keeps every element within one step from the original,
+    // and every backend must produce the same codes as the serial encoder
+    for (simsimd_size_t i = 0; i != 2; ++i) {
+        simsimd_f32_t const* vector = vectors + i * 100;
+        simsimd_quantize_vector_f32(vector, 100, codes + i * 100, &headers[i]);
+        simsimd_dequantize_vector_f32(codes + i * 100, 100, &headers[i], decoded + i * 100);
+        for (simsimd_size_t j = 0; j != 100; ++j)
+            assert(fabs(decoded[i * 100 + j] - vector[j]) <= headers[i].scale);
+
+        simsimd_distance_t alpha = 1.0 / headers[i].scale;
+        simsimd_distance_t beta = -(simsimd_distance_t)headers[i].offset / headers[i].scale;
+        simsimd_scale_f32_to_i8_serial(vector, 100, alpha, beta, reference_codes);
+        assert(memcmp(codes + i * 100, reference_codes, 100) == 0);
+#if SIMSIMD_TARGET_NEON
+        simsimd_scale_f32_to_i8_neon(vector, 100, alpha, beta, codes + i * 100);
+        assert(memcmp(codes + i * 100, reference_codes, 100) == 0);
+#endif
+#if SIMSIMD_TARGET_HASWELL
+        simsimd_scale_f32_to_i8_haswell(vector, 100, alpha, beta, codes + i * 100);
+        assert(memcmp(codes + i * 100, reference_codes, 100) == 0);
+#endif
+    }
+    simsimd_dot_i8_affine(codes, codes + 100, 100, &headers[0], &headers[1], &distance);
+    simsimd_dot_f32_serial(decoded, decoded + 100, 100, &expected);
+    assert(is_close(distance, expected, 1e-3));
+    simsimd_l2sq_i8_affine(codes, codes + 100, 100, &headers[0], &headers[1], &distance);
+    simsimd_l2sq_f32_serial(decoded, decoded + 100, 100, &expected);
+    assert(is_close(distance, expected, 1e-3));
+
+    // Per-dimension quantization must produce the same codes as the serial encoder
+    simsimd_quantize_minmax_f32(vectors, 2, 100, mins, maxs);
+    simsimd_quantize_ranges_f32(mins, maxs, 100, scales, offsets, encode_scales, encode_offsets);
+    simsimd_affine_f32_to_i8(vectors, 100, encode_scales, encode_offsets, codes);
+    simsimd_affine_f32_to_i8_serial(vectors, 100, encode_scales, encode_offsets, reference_codes);
+    for (simsimd_size_t j = 0; j != 100; ++j)
+        assert(codes[j] == reference_codes[j]);
+    simsimd_affine_i8_to_f32(codes, 100, scales, offsets, decoded);
+    simsimd_affine_i8_to_f32_serial(codes, 100, scales, offsets, reference);
+    for (simsimd_size_t j = 0; j != 100; ++j)
+        assert(is_close(decoded[j], reference[j], 1e-6) && fabs(decoded[j] - vectors[j]) <= scales[j]);
+}
+
+/**
+ *  @brief  Compares the distances to gathered rows with the distances to the same rows, computed one by one.
+ */
+void test_gather(void) {
+    simsimd_f32_t query[40], base[8 * 40];
+    simsimd_i8_t query_i8[40], base_i8[8 * 40];
+    simsimd_bf16_t query_bf16[40], base_bf16[8 * 40];
+    simsimd_u32_t ids[6] = {5, 0, 7, 5, 2, 3};
+    simsimd_distance_t gathered[6], expected;
+    fill_random_f32(query, 40, 61);
+    fill_random_f32(base, 8 * 40, 62);
+    simsimd_scale_f32_to_i8_serial(query, 40, 100, 0, query_i8);
+    simsimd_scale_f32_to_i8_serial(base, 8 * 40, 100, 0, base_i8);
+    simsimd_scale_f32_to_bf16_serial(query, 40, 1, 0, query_bf16);
+    simsimd_scale_f32_to_bf16_serial(base, 8 * 40, 1, 0, base_bf16);
+
+    simsimd_gather_cos_f32(query, base, 40 * sizeof(simsimd_f32_t), ids, 6, 40, gathered);
+    for (simsimd_size_t i = 0; i != 6; ++i) {
+        simsimd_cos_f32_serial(query, base + ids[i] * 40, 40, &expected);
+        assert(is_close(gathered[i], expected, 1e-4));
+    }
+    simsimd_gather_l2sq_i8(query_i8, base_i8, 40, ids, 6, 40, gathered);
+    for (simsimd_size_t i = 0; i != 6; ++i) {
+        simsimd_l2sq_i8_serial(query_i8, base_i8 + ids[i] * 40, 40, &expected);
+        assert(gathered[i] == expected);
+    }
+    simsimd_gather_dot_bf16(query_bf16, base_bf16, 40 * sizeof(simsimd_bf16_t), ids, 6, 40, gathered);
+    for (simsimd_size_t i = 0; i != 6; ++i) {
+        simsimd_dot_bf16_serial(query_bf16, base_bf16 + ids[i] * 40, 40, &expected);
+        assert(is_close(gathered[i], expected, 1e-3));
+    }
+    simsimd_gather_hamming_b8((simsimd_b8_t const*)query_i8, base_i8, 40, ids, 6, 40, gathered);
+    for (simsimd_size_t i = 0; i != 6; ++i) {
+        simsimd_hamming_b8_serial((simsimd_b8_t const*)query_i8, (simsimd_b8_t const*)(base_i8 + ids[i] * 40), 40,
+                                  &expected);
+        assert(gathered[i] == expected);
+    }
+}
+
+/**
+ *  @brief  Compares the filtered scans and the top-k selections over 100 rows, spanning two bitmap words,
+ *          with the serial kernels applied to every allowed row.
+ */
+void test_filtered(void) {
+    simsimd_f32_t query[16], base[100 * 16];
+    simsimd_b8_t allowed[13] = {0};
+    simsimd_size_t ids[100], allowed_count = 0;
+    simsimd_distance_t distances[100], expected[100];
+    fill_random_f32(query, 16, 63);
+    fill_random_f32(base, 100 * 16, 64);
+    for (simsimd_size_t i = 0; i != 100; ++i)
+        if (i % 3 != 0 || i == 99)
+            allowed[i / 8] |= (simsimd_b8_t)(1 << (i % 8)), ++allowed_count;
+
+    // Filtered scans export the allowed rows in ascending order
+    simsimd_size_t found = simsimd_l2sq_filtered_f32(query, base, 100, 16, allowed, ids, distances);
+    assert(found == allowed_count);
+    for (simsimd_size_t i = 0, j = 0; i != 100; ++i) {
+        simsimd_l2sq_f32_serial(query, base + i * 16, 16, &expected[i]);
+        if (!(allowed[i / 8] & (1 << (i % 8))))
+            continue;
+        assert(ids[j] == i && is_close(distances[j], expected[i], 1e-4));
+        ++j;
+    }
+
+    // Top-k selections export the nearest allowed rows, and no other allowed row is closer than the last one
+    found = simsimd_l2sq_topk_f32(query, base, 100, 16, allowed, 5, ids, distances);
+    assert(found == 5);
+    for (simsimd_size_t j = 0; j != 5; ++j) {
+        assert(allowed[ids[j] / 8] & (1 << (ids[j] % 8)));
+        assert(is_close(distances[j], expected[ids[j]], 1e-4) && (!j || distances[j - 1] <= distances[j]));
+    }
+    for (simsimd_size_t i = 0; i != 100; ++i) {
+        int selected = 0;
+        for (simsimd_size_t j = 0; j != 5; ++j)
+            selected |= ids[j] == i;
+        if (!selected && (allowed[i / 8] & (1 << (i % 8))))
+            assert(expected[i] >= distances[4] - 1e-4);
+    }
+    found = simsimd_l2sq_topk_f32(query, base, 100, 16, NULL, 200, ids, distances);
+    assert(found == 100);
+}
+
+/**
+ *  @brief  Compares the range searches over 100 rows with the serial kernels applied to every allowed row,
+ *          first into a buffer too small for all matches, and then into one grown to the reported count.
+ */
+void test_range(void) {
+    simsimd_f32_t query[16], base[100 * 16];
+    simsimd_b8_t allowed[13] = {0};
+    simsimd_size_t ids[100], small_ids[5], expected_count = 0;
+    simsimd_distance_t distances[100], small_distances[5], expected[100], sorted[100];
+    fill_random_f32(query, 16, 65);
+    fill_random_f32(base, 100 * 16, 66);
+    for (simsimd_size_t i = 0; i != 100; ++i)
+        if (i % 4 != 1)
+            allowed[i / 8] |= (simsimd_b8_t)(1 << (i % 8));
+
+    // Place the radius halfway between two neighboring distances, to keep rounding errors away from the boundary
+    for (simsimd_size_t i = 0; i != 100; ++i) {
+        simsimd_l2sq_f32_serial(query, base + i * 16, 16, &expected[i]);
+        simsimd_size_t j = i;
+        for (; j && sorted[j - 1] > expected[i]; --j)
+            sorted[j] = sorted[j - 1];
+        sorted[j] = expected[i];
+    }
+    simsimd_distance_t const radius = (sorted[40] + sorted[41]) / 2;
+    for (simsimd_size_t i = 0; i != 100; ++i)
+        expected_count += expected[i] <= radius && (allowed[i / 8] & (1 << (i % 8)));
+    assert(expected_count > 5);
+
+    // Resuming from the returned row, 5 matches at a time, must export all matches in order, exactly once
+    simsimd_size_t found = 0, next = 0;
+    while (next != 100) {
+        simsimd_size_t exported;
+        next = simsimd_l2sq_range_f32(query, base, 100, 16, allowed, radius, next, 5, small_ids, small_distances,
+                                      &exported);
+        assert(exported <= 5 && (next == 100 || exported == 5));
+        for (simsimd_size_t j = 0; j != exported; ++j)
+            ids[found + j] = small_ids[j], distances[found + j] = small_distances[j];
+        found += exported;
+        assert(found <= expected_count);
+    }
+    assert(found == expected_count);
+    for (simsimd_size_t i = 0, j = 0; i != 100; ++i) {
+        if (expected[i] > radius || !(allowed[i / 8] & (1 << (i % 8))))
+            continue;
+        assert(ids[j] == i && is_close(distances[j], expected[i], 1e-4));
+        ++j;
+    }
+
+    // Starting in the middle of a bitmap word skips the rows before it, and a large enough buffer finishes the scan
+    simsimd_size_t tail_ids[100], exported, first_tail = 0;
+    simsimd_distance_t tail_distances[100];
+    while (first_tail != expected_count && ids[first_tail] < 70)
+        ++first_tail;
+    next = simsimd_l2sq_range_f32(query, base, 100, 16, allowed, radius, 70, 100, tail_ids, tail_distances, &exported);
+    assert(next == 100 && exported == expected_count - first_tail);
+    for (simsimd_size_t j = 0; j != exported; ++j)
+        assert(tail_ids[j] == ids[first_tail + j] && tail_distances[j] == distances[first_tail + j]);
+}
+
+/**
+ *  @brief  Writes `bytes` of `data` into a new file at `path`, replacing any previous contents.
+ */
+void write_file(char const* path, void const* data, simsimd_size_t bytes) {
+    FILE* file = fopen(path, "wb");
+    assert(file);
+    simsimd_size_t written = fwrite(data, 1, bytes, file);
+    int closed = fclose(file) == 0;
+    assert(written == bytes && closed);
+}
+
+/**
+ *  @brief  Builds a `.npy` file of the given format `version` with the `dictionary` header, followed by `rows`.
+ *  @return The total number of bytes.
+ */
+simsimd_size_t make_npy(simsimd_b8_t* file, int version, char const* dictionary, void const* rows,
+                        simsimd_size_t rows_bytes) {
+    simsimd_size_t const length = strlen(dictionary), prefix = version == 1 ? 10 : 12;
+    memcpy(file, "\x93NUMPY", 6), file[6] = (simsimd_b8_t)version, file[7] = 0;
+    for (simsimd_size_t i = 0; i != prefix - 8; ++i)
+        file[8 + i] = (simsimd_b8_t)(length >> (8 * i));
+    memcpy(file + prefix, dictionary, length);
+    memcpy(file + prefix + length, rows, rows_bytes);
+    return prefix + length + rows_bytes;
+}
+
+/**
+ *  @brief  Parses the headers of every supported dataset format, from memory and from temporary files, checking
+ *          the shapes, strides, and row pointers, and compares the chunked streaming search with the exact search.
+ */
+void test_datasets(void) {
+    simsimd_f32_t values[100 * 5];
+    simsimd_b8_t file[100 * 6 * 4], bytes[4 * 6];
+    simsimd_u32_t header[2] = {3, 5};
+    simsimd_dataset_t dataset;
+    fill_random_f32(values, 100 * 5, 69);
+    for (simsimd_size_t i = 0; i != sizeof(bytes); ++i)
+        bytes[i] = (simsimd_b8_t)(i * 11);
+
+    // NumPy headers of both versions, with 2-dimensional and 1-dimensional shapes
+    simsimd_size_t size = make_npy(file, 1, "{'descr': '<f4', 'fortran_order': False, 'shape': (3, 5), }\n", values,
+                                   3 * 5 * sizeof(simsimd_f32_t));
+    int opened = simsimd_dataset_view(&dataset, simsimd_dataset_npy_k, file, size);
+    assert(opened && dataset.count == 3 && dataset.dimensions == 5 && dataset.stride == 20);
+    assert(dataset.datatype == simsimd_datatype_f32_k && simsimd_dataset_row(&dataset, 2) == file + size - 20);
+    assert(memcmp(simsimd_dataset_row(&dataset, 0), values, 3 * 5 * sizeof(simsimd_f32_t)) == 0);
+    size = make_npy(file, 2, "{'descr': '|i1', 'fortran_order': False, 'shape': (4, 6), }\n", bytes, sizeof(bytes));
+    opened = simsimd_dataset_view(&dataset, simsimd_dataset_npy_k, file, size);
+    assert(opened && dataset.count == 4 && dataset.dimensions == 6 && dataset.stride == 6);
+    assert(dataset.datatype == simsimd_datatype_i8_k && simsimd_dataset_row(&dataset, 1) == file + size - 18);
+    size = make_npy(file, 1, "{'descr': '<f8', 'fortran_order': False, 'shape': (3,), }\n", bytes, sizeof(bytes));
+    opened = simsimd_dataset_view(&dataset, simsimd_dataset_npy_k, file, size);
+    assert(opened && dataset.count == 1 && dataset.dimensions == 3 && dataset.stride == 24);
+    assert(dataset.datatype == simsimd_datatype_f64_k);
+
+    // Fortran-ordered, big-endian, higher-dimensional, and truncated arrays are rejected
+    size = make_npy(file, 1, "{'descr': '<f4', 'fortran_order': True, 'shape': (3, 5), }\n", values, 60);
+    opened = simsimd_dataset_view(&dataset, simsimd_dataset_npy_k, file, size);
+    assert(!opened);
+    size = make_npy(file, 1, "{'descr': '>f4', 'fortran_order': False, 'shape': (3, 5), }\n", values, 60);
+    opened = simsimd_dataset_view(&dataset, simsimd_dataset_npy_k, file, size);
+    assert(!opened);
+    size = make_npy(file, 1, "{'descr': '<f4', 'fortran_order': False, 'shape': (1, 3, 5), }\n", values, 60);
+    opened = simsimd_dataset_view(&dataset, simsimd_dataset_npy_k, file, size);
+    assert(!opened);
+    size = make_npy(file, 2, "{'descr': '<f4', 'fortran_order': False, 'shape': (3, 5), }\n", values, 56);
+    opened = simsimd_dataset_view(&dataset, simsimd_dataset_npy_k, file, size);
+    assert(!opened);
+
+    // Memory-mapped files of every format, with the format inferred from the extension
+    memcpy(file, header, sizeof(header)), memcpy(file + 8, values, 3 * 5 * sizeof(simsimd_f32_t));
+    write_file("simsimd_test.fbin", file, 8 + 3 * 5 * sizeof(simsimd_f32_t));
+    opened = simsimd_dataset_open(&dataset, "simsimd_test.fbin", simsimd_dataset_unknown_k);
+    assert(opened && dataset.count == 3 && dataset.dimensions == 5 && dataset.stride == 20);
+    assert(dataset.datatype == simsimd_datatype_f32_k && dataset.scalar_bytes == 4);
+    for (simsimd_size_t i = 0; i != 3; ++i)
+        assert(simsimd_dataset_row(&dataset, i) == (simsimd_b8_t const*)dataset.mapping + 8 + i * 20);
+    assert(memcmp(simsimd_dataset_row(&dataset, 1), values + 5, 5 * sizeof(simsimd_f32_t)) == 0);
+    simsimd_dataset_close(&dataset);
+
+    for (simsimd_size_t i = 0; i != 4; ++i) {
+        simsimd_u32_t const dimensions = 6;
+        memcpy(file + i * 10, &dimensions, 4), memcpy(file + i * 10 + 4, bytes + i * 6, 6);
+    }
+    write_file("simsimd_test.bvecs", file, 4 * 10);
+    opened = simsimd_dataset_open(&dataset, "simsimd_test.bvecs", simsimd_dataset_unknown_k);
+    assert(opened && dataset.count == 4 && dataset.dimensions == 6 && dataset.stride == 10);
+    assert(dataset.datatype == simsimd_datatype_unknown_k && dataset.scalar_bytes == 1);
+    for (simsimd_size_t i = 0; i != 4; ++i)
+        assert(simsimd_dataset_row(&dataset, i) == (simsimd_b8_t const*)dataset.mapping + 4 + i * 10);
+    assert(memcmp(simsimd_dataset_row(&dataset, 3), bytes + 18, 6) == 0);
+    simsimd_dataset_close(&dataset);
+
+    for (simsimd_u32_t i = 0; i != 5; ++i) {
+        simsimd_u32_t const row[3] = {2, i, 100 + i};
+        memcpy(file + i * 12, row, sizeof(row));
+    }
+    write_file("simsimd_test.ivecs", file, 5 * 12);
+    opened = simsimd_dataset_open(&dataset, "simsimd_test.ivecs", simsimd_dataset_unknown_k);
+    assert(opened && dataset.count == 5 && dataset.dimensions == 2 && dataset.stride == 12);
+    assert(dataset.datatype == simsimd_datatype_unknown_k && dataset.scalar_bytes == 4);
+    for (simsimd_size_t i = 0; i != 5; ++i) {
+        simsimd_u32_t ground_truth[2];
+        memcpy(ground_truth, simsimd_dataset_row(&dataset, i), sizeof(ground_truth));
+        assert(ground_truth[0] == i && ground_truth[1] == 100 + i);
+    }
+    simsimd_dataset_close(&dataset);
+
+    // Streaming searches over `.fvecs` rows read in small chunks, the last of which misses the header of a next row
+    for (simsimd_size_t i = 0; i != 100; ++i) {
+        simsimd_u32_t const dimensions = 5;
+        memcpy(file + i * 24, &dimensions, 4), memcpy(file + i * 24 + 4, values + i * 5, 20);
+    }
+    write_file("simsimd_test.fvecs", file, 100 * 24);
+    simsimd_f32_t const* queries = values + 40 * 5; // Rows of the dataset, so every query finds itself first
+    simsimd_size_t ids[3 * 7], expected_ids[7];
+    simsimd_distance_t distances[3 * 7], expected_distances[7];
+    simsimd_size_t const chunk_sizes[3] = {7 * 24 + 5, 1, 0};
+    simsimd_metric_kind_t const metrics[2] = {simsimd_metric_l2sq_k, simsimd_metric_cos_k};
+    for (simsimd_size_t m = 0; m != 2; ++m) {
+        simsimd_metric_punned_t kernel = simsimd_metric_punned(metrics[m], simsimd_datatype_f32_k, simsimd_cap_any_k);
+        for (simsimd_size_t c = 0; c != 3; ++c) {
+            int searched = simsimd_dataset_stream_search("simsimd_test.fvecs", simsimd_dataset_unknown_k, metrics[m],
+                                                         queries, 3, 7, chunk_sizes[c], ids, distances);
+            assert(searched);
+            for (simsimd_size_t q = 0; q != 3; ++q) {
+                simsimd_size_t found = exact_search_f32(kernel, queries + q * 5, values, 100, 5, NULL, 7, expected_ids,
+                                                        expected_distances);
+                assert(found == 7 && ids[q * 7] == 40 + q);
+                for (simsimd_size_t j = 0; j != 7; ++j)
+                    assert(ids[q * 7 + j] == expected_ids[j] && distances[q * 7 + j] == expected_distances[j]);
+            }
+        }
+    }
+
+    // Fewer rows than requested neighbors are padded
+    write_file("simsimd_test.fvecs", file, 5 * 24);
+    int searched = simsimd_dataset_stream_search("simsimd_test.fvecs", simsimd_dataset_fvecs_k, simsimd_metric_l2sq_k,
+                                             queries, 1, 7, 24, ids, distances);
+    assert(searched && ids[4] < 5 && ids[5] == (simsimd_size_t)-1 && distances[6] == DBL_MAX);
+    remove("simsimd_test.fbin"), remove("simsimd_test.bvecs"), remove("simsimd_test.ivecs");
+    remove("simsimd_test.fvecs");
+}
+
+/**
+ *  @brief  Compares the searches in a flat index, grown over two additions and with some rows removed,
+ *          with the exact search over the remaining rows.
+ */
+void test_flat_index(void) {
+    simsimd_f32_t vectors[130 * 16], queries[3 * 16];
+    simsimd_b8_t alive[17];
+    simsimd_size_t ids[3 * 4], expected_ids[4];
+    simsimd_distance_t distances[3 * 4], expected_distances[4];
+    fill_random_f32(vectors, 130 * 16, 65);
+    fill_random_f32(queries, 3 * 16, 66);
+    memset(alive, 0xFF, sizeof(alive));
+    alive[7 / 8] &= (simsimd_b8_t)~(1 << 7), alive[64 / 8] &= (simsimd_b8_t)~(1 << 0);
+    alive[129 / 8] &= (simsimd_b8_t)~(1 << 1);
+    // The first two queries match the removed rows, which must not be found
+    memcpy(queries, vectors + 7 * 16, 16 * sizeof(simsimd_f32_t));
+    memcpy(queries + 16, vectors + 64 * 16, 16 * sizeof(simsimd_f32_t));
+
+    simsimd_flat_index_t index;
+    int initialized = simsimd_flat_index_init(&index, simsimd_metric_l2sq_k, simsimd_datatype_f32_k, 16);
+    int added = initialized && simsimd_flat_index_add(&index, vectors, 100);
+    added = added && simsimd_flat_index_add(&index, vectors + 100 * 16, 30);
+    assert(initialized && added && index.count == 130);
+    int removed = simsimd_flat_index_remove(&index, 7) && simsimd_flat_index_remove(&index, 64) &&
+                  simsimd_flat_index_remove(&index, 129);
+    int removed_twice = simsimd_flat_index_remove(&index, 7) || simsimd_flat_index_remove(&index, 130);
+    assert(removed && !removed_twice && index.removed == 3);
+
+    for (int partitioned = 0; partitioned != 2; ++partitioned) {
+        simsimd_size_t found = partitioned
+                                   ? simsimd_flat_index_search_partitioned(&index, queries, 3, 4, ids, distances)
+                                   : simsimd_flat_index_search(&index, queries, 3, 4, ids, distances);
+        assert(found == 4);
+        for (simsimd_size_t q = 0; q != 3; ++q) {
+            exact_search_f32((simsimd_metric_punned_t)&simsimd_l2sq_f32_serial, queries + q * 16, vectors, 130, 16,
+                             alive, 4, expected_ids, expected_distances);
+            for (simsimd_size_t j = 0; j != 4; ++j) {
+                assert(ids[q * 4 + j] == expected_ids[j]);
+                assert(is_close(distances[q * 4 + j], expected_distances[j], 1e-4));
+            }
+        }
+    }
+    simsimd_flat_index_free(&index);
+
+    // Like the other indexes, the slots beyond the number of rows are padded with invalid identifiers
+    initialized = simsimd_flat_index_init(&index, simsimd_metric_l2sq_k, simsimd_datatype_f32_k, 16);
+    added = initialized && simsimd_flat_index_add(&index, vectors, 3);
+    assert(initialized && added);
+    for (int partitioned = 0; partitioned != 2; ++partitioned) {
+        simsimd_size_t found = partitioned
+                                   ? simsimd_flat_index_search_partitioned(&index, queries, 1, 4, ids, distances)
+                                   : simsimd_flat_index_search(&index, queries, 1, 4, ids, distances);
+        assert(found == 3 && ids[2] < 3 && ids[3] == (simsimd_size_t)-1 && distances[3] == DBL_MAX);
+    }
+    simsimd_flat_index_free(&index);
+}
+
+/**
+ *  @brief  Checks that probing all lists of an inverted file index has a recall of one, compared to the exact
+ *          search, and that probing a single list finds the stored vectors themselves.
+ */
+void test_ivf_index(void) {
+    simsimd_f32_t vectors[200 * 16], queries[5 * 16];
+    simsimd_size_t ids[5 * 5], expected_ids[5];
+    simsimd_distance_t distances[5 * 5], expected_distances[5];
+    fill_random_f32(vectors, 200 * 16, 67);
+    fill_random_f32(queries, 5 * 16, 68);
+
+    simsimd_ivf_index_t index;
+    int initialized = simsimd_ivf_index_init(&index, simsimd_metric_l2sq_k, simsimd_datatype_f32_k, 16, 4);
+    int trained = initialized && simsimd_ivf_index_train(&index, vectors, 200, 10);
+    int added = trained && simsimd_ivf_index_add(&index, vectors, 130);
+    added = added && simsimd_ivf_index_add(&index, vectors + 130 * 16, 70);
+    assert(initialized && trained && added && index.count == 200);
+    for (simsimd_size_t l = 0, stored = 0; l != 4; ++l) {
+        stored += index.lists[l].count;
+        assert(index.lists[l].count <= index.lists[l].capacity && (l != 3 || stored == 200));
+    }
+
+    int searched = simsimd_ivf_index_search(&index, queries, 5, 4, 5, ids, distances);
+    assert(searched);
+    for (simsimd_size_t q = 0; q != 5; ++q) {
+        exact_search_f32((simsimd_metric_punned_t)&simsimd_l2sq_f32_serial, queries + q * 16, vectors, 200, 16, NULL,
+                         5, expected_ids, expected_distances);
+        for (simsimd_size_t j = 0; j != 5; ++j) {
+            assert(ids[q * 5 + j] == expected_ids[j]);
+            assert(is_close(distances[q * 5 + j], expected_distances[j], 1e-4));
+        }
+    }
+    searched = simsimd_ivf_index_search(&index, vectors + 42 * 16, 1, 1, 1, ids, distances);
+    assert(searched && ids[0] == 42 && distances[0] == 0);
+    // A single list is smaller than the whole index, so the remaining slots are padded
+    simsimd_size_t many_ids[200];
+    simsimd_distance_t many_distances[200];
+    searched = simsimd_ivf_index_search(&index, vectors + 42 * 16, 1, 1, 200, many_ids, many_distances);
+    assert(searched && many_ids[0] == 42 && many_ids[199] == (simsimd_size_t)-1 && many_distances[199] == DBL_MAX);
+    simsimd_ivf_index_free(&index);
+}
+
+/**
+ *  @brief  Checks that searching a small graph with a beam as wide as the index has a recall of one, compared to
+ *          the exact search, and that every indexed vector finds itself.
+ */
+void test_hnsw_index(void) {
+    simsimd_f32_t vectors[200 * 16], queries[5 * 16];
+    simsimd_size_t ids[5 * 5], expected_ids[5];
+    simsimd_distance_t distances[5 * 5], expected_distances[5];
+    fill_random_f32(vectors, 200 * 16, 75);
+    fill_random_f32(queries, 5 * 16, 76);
+
+    simsimd_hnsw_index_t index;
+    int initialized = simsimd_hnsw_index_init(&index, simsimd_metric_l2sq_k, simsimd_datatype_f32_k, 16, 200, 4, 32);
+    int added = initialized && simsimd_hnsw_index_add(&index, vectors, 120);
+    added = added && simsimd_hnsw_index_add(&index, vectors + 120 * 16, 80);
+    assert(initialized && added && index.count == 200 && index.max_level > 0);
+
+    int searched = simsimd_hnsw_index_search(&index, queries, 5, 200, 5, ids, distances);
+    assert(searched);
+    for (simsimd_size_t q = 0; q != 5; ++q) {
+        exact_search_f32((simsimd_metric_punned_t)&simsimd_l2sq_f32_serial, queries + q * 16, vectors, 200, 16, NULL,
+                         5, expected_ids, expected_distances);
+        for (simsimd_size_t j = 0; j != 5; ++j) {
+            assert(ids[q * 5 + j] == expected_ids[j]);
+            assert(is_close(distances[q * 5 + j], expected_distances[j], 1e-4));
+        }
+    }
+    for (simsimd_size_t i = 0; i != 200; ++i) {
+        searched = simsimd_hnsw_index_search(&index, vectors + i * 16, 1, 200, 1, ids, distances);
+        assert(searched && ids[0] == i && distances[0] == 0);
+    }
+    simsimd_hnsw_index_free(&index);
+}
+
+/**
+ *  @brief  Clusters three well-separated groups of vectors, checking that every group gets its own centroid,
+ *          equal to the mean of the group, for both single- and half-precision inputs.
+ */
+void test_kmeans(void) {
+    simsimd_f32_t vectors[150 * 16], centroids[3 * 16];
+    simsimd_f16_t vectors_f16[150 * 16];
+    simsimd_size_t assignments[150];
+    fill_random_f32(vectors, 150 * 16, 69);
+    for (simsimd_size_t i = 0; i != 150 * 16; ++i)
+        vectors[i] = vectors[i] * 0.1f + (simsimd_f32_t)(i / (50 * 16)) * 10 - 10;
+    simsimd_scale_f32_to_f16_serial(vectors, 150 * 16, 1, 0, vectors_f16);
+
+    for (int half = 0; half != 2; ++half) {
+        int clustered = half ? simsimd_kmeans_f16(simsimd_metric_l2sq_k, vectors_f16, 150, 16, 3, 10, centroids,
+                                                  assignments)
+                             : simsimd_kmeans_f32(simsimd_metric_l2sq_k, vectors, 150, 16, 3, 10, centroids,
+                                                  assignments);
+        assert(clustered);
+        assert(assignments[0] != assignments[50] && assignments[50] != assignments[100] &&
+               assignments[0] != assignments[100]);
+        for (simsimd_size_t group = 0; group != 3; ++group) {
+            simsimd_size_t const c = assignments[group * 50];
+            for (simsimd_size_t j = 0; j != 16; ++j) {
+                simsimd_f64_t mean = 0;
+                for (simsimd_size_t i = group * 50; i != group * 50 + 50; ++i) {
+                    assert(assignments[i] == c);
+                    mean += vectors[i * 16 + j];
+                }
+                assert(is_close(centroids[c * 16 + j], mean / 50, half ? 1e-2 : 1e-4));
+            }
+        }
+    }
+
+    // Mini-batch updates only approximate the means, but must keep the groups apart
+    int clustered = simsimd_kmeans_minibatch_f32(simsimd_metric_l2sq_k, vectors, 150, 16, 3, 20, 32, centroids,
+                                                 assignments);
+    assert(clustered && assignments[0] != assignments[100]);
+    for (simsimd_size_t i = 0; i != 150; ++i)
+        assert(assignments[i] == assignments[i / 50 * 50] && (i < 50 || assignments[i] != assignments[i - 50]));
+}
+
+/**
+ *  @brief  Compares the fused nearest-centroid assignments with the serial kernels applied to every centroid,
+ *          on dimensions and centroid counts, that aren't multiples of the register widths.
+ */
+void test_assign(void) {
+    simsimd_f32_t vectors[70 * 19], centroids[13 * 19];
+    simsimd_size_t assignments[70];
+    simsimd_distance_t distances[70], expected[13];
+    fill_random_f32(vectors, 70 * 19, 70);
+    fill_random_f32(centroids, 13 * 19, 71);
+
+    for (int metric = 0; metric != 3; ++metric) {
+        if (metric == 0)
+            simsimd_assign_l2sq_f32(vectors, 70, centroids, 13, 19, assignments, distances);
+        else if (metric == 1)
+            simsimd_assign_cos_f32(vectors, 70, centroids, 13, 19, assignments, distances);
+        else
+            simsimd_assign_dot_f32(vectors, 70, centroids, 13, 19, assignments, distances);
+        for (simsimd_size_t i = 0; i != 70; ++i) {
+            // The inner products are negated, so that the nearest centroid always has the smallest score
+            simsimd_distance_t best = DBL_MAX;
+            for (simsimd_size_t c = 0; c != 13; ++c) {
+                if (metric == 0)
+                    simsimd_l2sq_f32_serial(vectors + i * 19, centroids + c * 19, 19, &expected[c]);
+                else if (metric == 1)
+                    simsimd_cos_f32_serial(vectors + i * 19, centroids + c * 19, 19, &expected[c]);
+                else
+                    simsimd_dot_f32_serial(vectors + i * 19, centroids + c * 19, 19, &expected[c]), expected[c] *= -1;
+                best = expected[c] < best ? expected[c] : best;
+            }
+            simsimd_distance_t const score = metric == 2 ? -distances[i] : distances[i];
+            assert(assignments[i] < 13 && is_close(expected[assignments[i]], best, 1e-4));
+            assert(is_close(score, expected[assignments[i]], 1e-4));
+        }
+    }
 }
 
 int main(int argc, char** argv) {
@@ -138,5 +1465,23 @@ int main(int argc, char** argv) {
     print_capabilities();
     test_utilities();
     test_distance_from_itself();
+    test_cos_near_zero();
+    test_backends();
+    test_elementwise();
+    test_normalize();
+    test_prenormed();
+    test_packed();
+    test_parallel();
+    test_pdist();
+    test_quantization();
+    test_gather();
+    test_filtered();
+    test_range();
+    test_datasets();
+    test_flat_index();
+    test_ivf_index();
+    test_hnsw_index();
+    test_kmeans();
+    test_assign();
     return 0;
 }
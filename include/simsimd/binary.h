@@ -123,29 +123,38 @@ SIMSIMD_PUBLIC void simsimd_jaccard_b8_neon(simsimd_b8_t const* a, simsimd_b8_t
 SIMSIMD_PUBLIC void simsimd_hamming_b8_sve(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t n_words,
                                            simsimd_distance_t* result) {
     simsimd_size_t i = 0;
-    simsimd_i32_t differences = 0;
+    // Horizontal `svaddv_u8` sums would overflow on 256-bit and wider registers, so instead of reducing
+    // on every iteration, we accumulate the per-byte population counts into 32-bit lanes with `svdot_u32`.
+    svuint8_t const ones_vec = svdup_n_u8(1);
+    svuint32_t differences_vec = svdup_n_u32(0);
     do {
         svbool_t pg_vec = svwhilelt_b8((unsigned int)i, (unsigned int)n_words);
         svuint8_t a_vec = svld1_u8(pg_vec, a + i);
         svuint8_t b_vec = svld1_u8(pg_vec, b + i);
-        differences += svaddv_u8(svptrue_b8(), svcnt_u8_x(svptrue_b8(), sveor_u8_m(svptrue_b8(), a_vec, b_vec)));
+        svuint8_t xor_popcount_vec = svcnt_u8_x(svptrue_b8(), sveor_u8_x(svptrue_b8(), a_vec, b_vec));
+        differences_vec = svdot_u32(differences_vec, xor_popcount_vec, ones_vec);
         i += svcntb();
     } while (i < n_words);
-    *result = differences;
+    *result = svaddv_u32(svptrue_b32(), differences_vec);
 }
 
 SIMSIMD_PUBLIC void simsimd_jaccard_b8_sve(simsimd_b8_t const* a, simsimd_b8_t const* b, simsimd_size_t n_words,
                                            simsimd_distance_t* result) {
     simsimd_size_t i = 0;
-    simsimd_i32_t intersection = 0, union_ = 0;
+    svuint8_t const ones_vec = svdup_n_u8(1);
+    svuint32_t intersection_vec = svdup_n_u32(0), union_vec = svdup_n_u32(0);
     do {
         svbool_t pg_vec = svwhilelt_b8((unsigned int)i, (unsigned int)n_words);
         svuint8_t a_vec = svld1_u8(pg_vec, a + i);
         svuint8_t b_vec = svld1_u8(pg_vec, b + i);
-        intersection += svaddv_u8(svptrue_b8(), svcnt_u8_x(svptrue_b8(), svand_u8_m(svptrue_b8(), a_vec, b_vec)));
-        union_ += svaddv_u8(svptrue_b8(), svcnt_u8_x(svptrue_b8(), svorr_u8_m(svptrue_b8(), a_vec, b_vec)));
+        svuint8_t and_popcount_vec = svcnt_u8_x(svptrue_b8(), svand_u8_x(svptrue_b8(), a_vec, b_vec));
+        svuint8_t or_popcount_vec = svcnt_u8_x(svptrue_b8(), svorr_u8_x(svptrue_b8(), a_vec, b_vec));
+        intersection_vec = svdot_u32(intersection_vec, and_popcount_vec, ones_vec);
+        union_vec = svdot_u32(union_vec, or_popcount_vec, ones_vec);
         i += svcntb();
     } while (i < n_words);
+    simsimd_i64_t intersection = svaddv_u32(svptrue_b32(), intersection_vec);
+    simsimd_i64_t union_ = svaddv_u32(svptrue_b32(), union_vec);
     *result = (union_ != 0) ? 1 - (simsimd_f32_t)intersection / (simsimd_f32_t)union_ : 0;
 }
 
@@ -0,0 +1,502 @@
+/**
+ *  @file       dataset.h
+ *  @brief      Memory-mapped readers for the common vector search dataset formats.
+ *  @date       October 17, 2026
+ *
+ *  Contains:
+ *  - `.fvecs`, `.bvecs`, `.ivecs` files of the TEXMEX corpus, with every row prefixed by its dimensionality
+ *  - `.fbin`, `.u8bin`, `.i8bin` files of the Big-ANN benchmarks, with a single header for all rows
+ *  - `.npy` files of NumPy, with 1- or 2-dimensional C-ordered little-endian arrays
+ *  - Streaming exact search over files, overlapping chunked reads with scoring
+ *
+ *  The files are mapped read-only and never copied, so datasets larger than RAM can be scanned, with the page cache
+ *  managing the I/O. The rows are exposed as a pointer and a stride, to be passed to the stride-aware kernels, like
+ *  `simsimd_gather_*`, or directly to the batch and top-k kernels, if the rows are contiguous.
+ *  Like `index.h`, this header talks to the operating system, and has to be included explicitly.
+ *  In strict ISO C mode glibc hides `madvise`, so access hints are only applied if `_DEFAULT_SOURCE` is defined.
+ *  If compiled with OpenMP, streaming searches read the next chunk on one thread, while others score the current one.
+ */
+#ifndef SIMSIMD_DATASET_H
+#define SIMSIMD_DATASET_H
+
+#include "simsimd.h"
+
+#include <float.h>  // `DBL_MAX`
+#include <stdio.h>  // `fopen`, `fread`
+#include <stdlib.h> // `malloc`, `free`
+#include <string.h> // `memcpy`, `memcmp`, `strcmp`, `strstr`
+
+#if defined(_WIN32)
+#include <windows.h> // `CreateFileMappingA`, `MapViewOfFile`
+#else
+#include <fcntl.h>    // `open`
+#include <sys/mman.h> // `mmap`, `munmap`, `madvise`
+#include <sys/stat.h> // `fstat`
+#include <unistd.h>   // `close`, `sysconf`
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *  @brief  On-disk layouts of the supported datasets.
+ */
+typedef enum {
+    simsimd_dataset_unknown_k = 0, ///< Infer from the file extension
+    simsimd_dataset_fvecs_k,       ///< Rows of `i32` dimensionality followed by `f32` scalars
+    simsimd_dataset_bvecs_k,       ///< Rows of `i32` dimensionality followed by `u8` scalars
+    simsimd_dataset_ivecs_k,       ///< Rows of `i32` dimensionality followed by `i32` scalars, often ground-truth IDs
+    simsimd_dataset_fbin_k,        ///< `u32` rows count and dimensionality, followed by `f32` scalars
+    simsimd_dataset_u8bin_k,       ///< `u32` rows count and dimensionality, followed by `u8` scalars
+    simsimd_dataset_i8bin_k,       ///< `u32` rows count and dimensionality, followed by `i8` scalars
+    simsimd_dataset_npy_k,         ///< NumPy array with a textual header
+} simsimd_dataset_format_t;
+
+/**
+ *  @brief  Access patterns, that the operating system can use to schedule read-ahead and eviction.
+ */
+typedef enum {
+    simsimd_dataset_sequential_k = 0, ///< Rows will be scanned in order, and can be dropped soon after
+    simsimd_dataset_random_k,         ///< Rows will be accessed in arbitrary order, so read-ahead is wasteful
+    simsimd_dataset_willneed_k,       ///< Rows will be accessed soon, and should be prefetched
+    simsimd_dataset_dontneed_k,       ///< Rows won't be accessed soon, and their pages can be evicted
+} simsimd_dataset_advice_t;
+
+/**
+ *  @brief  Read-only view of a dataset, either memory-mapped with `simsimd_dataset_open`,
+ *          or parsed from memory with `simsimd_dataset_view`.
+ */
+typedef struct simsimd_dataset_t {
+    simsimd_b8_t const* rows;    ///< First scalar of the first row
+    simsimd_size_t count;        ///< Number of rows
+    simsimd_size_t dimensions;   ///< Number of scalars in every row
+    simsimd_size_t stride;       ///< Number of bytes between the starts of consecutive rows
+    simsimd_size_t scalar_bytes; ///< Size of every scalar in bytes
+    /// Type of scalars, or `simsimd_datatype_unknown_k` for `u8` and `i32`, that have no kernels
+    simsimd_datatype_t datatype;
+    void* mapping;                ///< Start of the mapped file, or NULL if the view doesn't own a mapping
+    simsimd_size_t mapping_bytes; ///< Size of the mapped file
+} simsimd_dataset_t;
+
+/**
+ *  @brief  Infers the dataset format from the extension of the given path.
+ */
+SIMSIMD_PUBLIC simsimd_dataset_format_t simsimd_dataset_format(char const* path) {
+    char const* extension = strrchr(path, '.');
+    if (!extension)
+        return simsimd_dataset_unknown_k;
+    if (strcmp(extension, ".fvecs") == 0)
+        return simsimd_dataset_fvecs_k;
+    if (strcmp(extension, ".bvecs") == 0)
+        return simsimd_dataset_bvecs_k;
+    if (strcmp(extension, ".ivecs") == 0)
+        return simsimd_dataset_ivecs_k;
+    if (strcmp(extension, ".fbin") == 0)
+        return simsimd_dataset_fbin_k;
+    if (strcmp(extension, ".u8bin") == 0)
+        return simsimd_dataset_u8bin_k;
+    if (strcmp(extension, ".i8bin") == 0)
+        return simsimd_dataset_i8bin_k;
+    if (strcmp(extension, ".npy") == 0)
+        return simsimd_dataset_npy_k;
+    return simsimd_dataset_unknown_k;
+}
+
+/**
+ *  @brief  Reads a little-endian unsigned integer of `bytes` width, that may be unaligned.
+ */
+SIMSIMD_INTERNAL simsimd_size_t simsimd_dataset_load_uint(simsimd_b8_t const* data, simsimd_size_t bytes) {
+    simsimd_size_t value = 0;
+    for (simsimd_size_t i = 0; i != bytes; ++i)
+        value |= (simsimd_size_t)data[i] << (8 * i);
+    return value;
+}
+
+/**
+ *  @brief  Parses the textual dictionary of a `.npy` header, like `{'descr': '<f4', 'fortran_order': False,
+ *          'shape': (1000, 128), }`, into the scalar type and the shape of a C-ordered array.
+ *  @return Non-zero on success, zero for big-endian, Fortran-ordered, or higher-dimensional arrays.
+ */
+SIMSIMD_PUBLIC int simsimd_dataset_parse_npy_header(char const* header, simsimd_size_t length,
+                                                    simsimd_dataset_t* dataset) {
+    char dictionary[1024];
+    if (length >= sizeof(dictionary))
+        return 0;
+    memcpy(dictionary, header, length);
+    dictionary[length] = 0;
+
+    // Only native little-endian or single-byte scalars are supported, like `<f4`, `<f2`, `|i1`, or `|u1`
+    char const* descr = strstr(dictionary, "'descr'");
+    char const* order = strstr(dictionary, "'fortran_order'");
+    char const* shape = strstr(dictionary, "'shape'");
+    if (!descr || !order || !shape)
+        return 0;
+    descr = strchr(descr + 7, '\'');
+    order = strchr(order + 15, ':');
+    shape = strchr(shape + 7, '(');
+    if (!descr || !order || !shape)
+        return 0;
+    char endianness = descr[1], kind = descr[2], width = descr[3];
+    if (endianness != '<' && endianness != '|' && endianness != '=')
+        return 0;
+    if (kind == 'f' && width == '8')
+        dataset->datatype = simsimd_datatype_f64_k, dataset->scalar_bytes = 8;
+    else if (kind == 'f' && width == '4')
+        dataset->datatype = simsimd_datatype_f32_k, dataset->scalar_bytes = 4;
+    else if (kind == 'f' && width == '2')
+        dataset->datatype = simsimd_datatype_f16_k, dataset->scalar_bytes = 2;
+    else if (kind == 'i' && width == '1')
+        dataset->datatype = simsimd_datatype_i8_k, dataset->scalar_bytes = 1;
+    else if (kind == 'u' && width == '1')
+        dataset->datatype = simsimd_datatype_unknown_k, dataset->scalar_bytes = 1;
+    else if (kind == 'i' && width == '4')
+        dataset->datatype = simsimd_datatype_unknown_k, dataset->scalar_bytes = 4;
+    else
+        return 0;
+    if (descr[4] != '\'')
+        return 0;
+
+    // The order is a Python boolean literal, so skipping the spaces is enough
+    for (++order; *order == ' '; ++order)
+        ;
+    if (strncmp(order, "False", 5) != 0)
+        return 0;
+
+    // The shape is a tuple of up to two integers, with a trailing comma for single-element tuples
+    simsimd_size_t extents[2] = {1, 1}, rank = 0;
+    for (char const* cursor = shape + 1; *cursor != ')'; ++cursor) {
+        if (*cursor == 0)
+            return 0;
+        if (*cursor < '0' || *cursor > '9')
+            continue;
+        if (rank == 2)
+            return 0;
+        simsimd_size_t extent = 0;
+        for (; *cursor >= '0' && *cursor <= '9'; ++cursor)
+            extent = extent * 10 + (simsimd_size_t)(*cursor - '0');
+        extents[rank++] = extent;
+        --cursor;
+    }
+    // Scalars and 1-dimensional arrays are treated as a single row
+    dataset->count = rank == 2 ? extents[0] : 1;
+    dataset->dimensions = rank == 2 ? extents[1] : extents[0];
+    return 1;
+}
+
+/**
+ *  @brief  Interprets `bytes` of an already loaded or mapped file of the given `format`, without copying it.
+ *          For `.*vecs` files only the first row header is checked, to avoid touching every page of the file.
+ *  @return Non-zero on success, zero if the format is unknown or the contents are malformed.
+ */
+SIMSIMD_PUBLIC int simsimd_dataset_view(simsimd_dataset_t* dataset, simsimd_dataset_format_t format, void const* data,
+                                        simsimd_size_t bytes) {
+    simsimd_b8_t const* file = (simsimd_b8_t const*)data;
+    simsimd_size_t header_bytes = 0;
+    memset(dataset, 0, sizeof(simsimd_dataset_t));
+    switch (format) {
+    case simsimd_dataset_fvecs_k: dataset->datatype = simsimd_datatype_f32_k, dataset->scalar_bytes = 4; break;
+    case simsimd_dataset_bvecs_k: dataset->datatype = simsimd_datatype_unknown_k, dataset->scalar_bytes = 1; break;
+    case simsimd_dataset_ivecs_k: dataset->datatype = simsimd_datatype_unknown_k, dataset->scalar_bytes = 4; break;
+    case simsimd_dataset_fbin_k: dataset->datatype = simsimd_datatype_f32_k, dataset->scalar_bytes = 4; break;
+    case simsimd_dataset_u8bin_k: dataset->datatype = simsimd_datatype_unknown_k, dataset->scalar_bytes = 1; break;
+    case simsimd_dataset_i8bin_k: dataset->datatype = simsimd_datatype_i8_k, dataset->scalar_bytes = 1; break;
+    case simsimd_dataset_npy_k: break;
+    default: return 0;
+    }
+
+    switch (format) {
+    case simsimd_dataset_fvecs_k:
+    case simsimd_dataset_bvecs_k:
+    case simsimd_dataset_ivecs_k:
+        // Every row repeats the same 4-byte dimensionality header
+        if (bytes < 4)
+            return 0;
+        dataset->dimensions = simsimd_dataset_load_uint(file, 4);
+        dataset->stride = 4 + dataset->dimensions * dataset->scalar_bytes;
+        if (!dataset->dimensions || bytes % dataset->stride)
+            return 0;
+        dataset->count = bytes / dataset->stride;
+        dataset->rows = file + 4;
+        return 1;
+    case simsimd_dataset_fbin_k:
+    case simsimd_dataset_u8bin_k:
+    case simsimd_dataset_i8bin_k:
+        if (bytes < 8)
+            return 0;
+        dataset->count = simsimd_dataset_load_uint(file, 4);
+        dataset->dimensions = simsimd_dataset_load_uint(file + 4, 4);
+        header_bytes = 8;
+        break;
+    default:
+        // The magic string is followed by the format version, and the little-endian length of the header,
+        // which is 2 bytes wide in version 1.0, and 4 bytes wide in the later versions
+        if (bytes < 10 || memcmp(file, "\x93NUMPY", 6) != 0)
+            return 0;
+        header_bytes = file[6] == 1 ? 10 : 12;
+        if (bytes < header_bytes)
+            return 0;
+        simsimd_size_t dictionary_bytes = simsimd_dataset_load_uint(file + 8, header_bytes - 8);
+        if (bytes < header_bytes + dictionary_bytes ||
+            !simsimd_dataset_parse_npy_header((char const*)file + header_bytes, dictionary_bytes, dataset))
+            return 0;
+        header_bytes += dictionary_bytes;
+        break;
+    }
+
+    // Headered formats store the rows contiguously, right after the header
+    dataset->stride = dataset->dimensions * dataset->scalar_bytes;
+    if (!dataset->stride || bytes < header_bytes + dataset->count * dataset->stride)
+        return 0;
+    dataset->rows = file + header_bytes;
+    return 1;
+}
+
+/**
+ *  @brief  Memory-maps the file at the given `path` read-only, and parses it as a dataset of the given `format`,
+ *          or the format matching the file extension, if `simsimd_dataset_unknown_k` is passed.
+ *          Must be released with `simsimd_dataset_close`.
+ *  @return Non-zero on success, zero if the file can't be mapped, or its contents are malformed.
+ */
+SIMSIMD_PUBLIC int simsimd_dataset_open(simsimd_dataset_t* dataset, char const* path,
+                                        simsimd_dataset_format_t format) {
+    void* mapping = 0;
+    simsimd_size_t bytes = 0;
+    memset(dataset, 0, sizeof(simsimd_dataset_t));
+    if (format == simsimd_dataset_unknown_k)
+        format = simsimd_dataset_format(path);
+    if (format == simsimd_dataset_unknown_k)
+        return 0;
+
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return 0;
+    LARGE_INTEGER file_size;
+    HANDLE file_mapping = 0;
+    if (GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0)
+        file_mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (file_mapping) {
+        bytes = (simsimd_size_t)file_size.QuadPart;
+        mapping = MapViewOfFile(file_mapping, FILE_MAP_READ, 0, 0, 0);
+        // The view keeps the file alive, so both handles can be closed right away
+        CloseHandle(file_mapping);
+    }
+    CloseHandle(file);
+#else
+    int descriptor = open(path, O_RDONLY);
+    if (descriptor < 0)
+        return 0;
+    struct stat file_stat;
+    if (fstat(descriptor, &file_stat) == 0 && file_stat.st_size > 0) {
+        bytes = (simsimd_size_t)file_stat.st_size;
+        mapping = mmap(NULL, (size_t)bytes, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        if (mapping == MAP_FAILED)
+            mapping = 0;
+    }
+    // The mapping keeps the file alive, so the descriptor can be closed right away
+    close(descriptor);
+#endif
+    if (!mapping)
+        return 0;
+
+    if (!simsimd_dataset_view(dataset, format, mapping, bytes)) {
+#if defined(_WIN32)
+        UnmapViewOfFile(mapping);
+#else
+        munmap(mapping, (size_t)bytes);
+#endif
+        return 0;
+    }
+    dataset->mapping = mapping;
+    dataset->mapping_bytes = bytes;
+    return 1;
+}
+
+/**
+ *  @brief  Unmaps the file opened with `simsimd_dataset_open`. Does nothing for views created from memory.
+ */
+SIMSIMD_PUBLIC void simsimd_dataset_close(simsimd_dataset_t* dataset) {
+    if (dataset->mapping) {
+#if defined(_WIN32)
+        UnmapViewOfFile(dataset->mapping);
+#else
+        munmap(dataset->mapping, (size_t)dataset->mapping_bytes);
+#endif
+    }
+    memset(dataset, 0, sizeof(simsimd_dataset_t));
+}
+
+/**
+ *  @brief  Returns the pointer to the first scalar of the `i`-th row.
+ */
+SIMSIMD_PUBLIC void const* simsimd_dataset_row(simsimd_dataset_t const* dataset, simsimd_size_t i) {
+    return dataset->rows + i * dataset->stride;
+}
+
+/**
+ *  @brief  Hints the operating system about the upcoming access pattern to `count` rows starting from `first`,
+ *          like `simsimd_dataset_sequential_k` before a brute-force scan. Does nothing for views created from memory,
+ *          on Windows, or if `madvise` isn't available.
+ */
+SIMSIMD_PUBLIC void simsimd_dataset_advise(simsimd_dataset_t const* dataset, simsimd_dataset_advice_t advice,
+                                           simsimd_size_t first, simsimd_size_t count) {
+#if !defined(_WIN32) && defined(MADV_SEQUENTIAL)
+    if (!dataset->mapping || !count || first >= dataset->count)
+        return;
+    if (count > dataset->count - first)
+        count = dataset->count - first;
+
+    // The range must start on a page boundary, and it's fine to extend it over the preceding rows
+    simsimd_size_t const page = (simsimd_size_t)sysconf(_SC_PAGESIZE);
+    simsimd_b8_t const* mapping = (simsimd_b8_t const*)dataset->mapping;
+    simsimd_size_t begin = (simsimd_size_t)(dataset->rows - mapping) + first * dataset->stride;
+    simsimd_size_t end = begin + count * dataset->stride;
+    begin -= begin % page;
+    int hint = MADV_NORMAL;
+    switch (advice) {
+    case simsimd_dataset_sequential_k: hint = MADV_SEQUENTIAL; break;
+    case simsimd_dataset_random_k: hint = MADV_RANDOM; break;
+    case simsimd_dataset_willneed_k: hint = MADV_WILLNEED; break;
+    case simsimd_dataset_dontneed_k: hint = MADV_DONTNEED; break;
+    }
+    madvise((void*)(mapping + begin), (size_t)(end - begin), hint);
+#else
+    (void)dataset, (void)advice, (void)first, (void)count;
+#endif
+}
+
+/**
+ *  @brief  Default size of every chunk read by `simsimd_dataset_stream_search`, large enough to saturate NVMe
+ *          drives with sequential reads, but small enough for the double buffer to stay in memory.
+ */
+#ifndef SIMSIMD_DATASET_CHUNK_BYTES
+#define SIMSIMD_DATASET_CHUNK_BYTES (16 * 1024 * 1024)
+#endif
+
+/**
+ *  @brief  Reads the next `rows` consecutive rows of a dataset file into `buffer`.
+ *          The last row of `.*vecs` files isn't followed by another header, so it may be shorter than the stride.
+ */
+SIMSIMD_INTERNAL int simsimd_dataset_read_rows(FILE* file, void* buffer, simsimd_size_t rows, simsimd_size_t stride,
+                                               simsimd_size_t row_bytes) {
+    simsimd_size_t const needed = (rows - 1) * stride + row_bytes;
+    return fread(buffer, 1, (size_t)(rows * stride), file) >= needed;
+}
+
+/**
+ *  @brief  Exact k-nearest-neighbors search over a dataset file, that doesn't have to fit in memory. Instead of
+ *          faulting the pages of a mapping, the rows are read sequentially in chunks of `chunk_bytes` into a double
+ *          buffer, and every chunk is scored against all `queries_count` queries, while the next one is being read.
+ *
+ *  The queries must be contiguous and have the same type and dimensionality as the dataset. Every query keeps its
+ *  own top-k heap across chunks, so no partial results need merging. With OpenMP, one thread reads the next chunk,
+ *  while the others split the queries of the current chunk, so a single query still overlaps I/O with compute.
+ *
+ *  @param path The path to the dataset file.
+ *  @param format The format of the file, or `simsimd_dataset_unknown_k` to infer it from the extension.
+ *  @param metric The metric to rank the rows by, with the largest inner products ranked first for `dot`.
+ *  @param chunk_bytes The approximate size of every read, or zero for `SIMSIMD_DATASET_CHUNK_BYTES`.
+ *  @param ids The output array of `queries_count * k` row indices, padded with `(simsimd_size_t)-1`.
+ *  @param distances The output array of `queries_count * k` distances, sorted from the nearest.
+ *  @return Non-zero on success, zero if the file can't be read, or the metric isn't supported for its type.
+ */
+SIMSIMD_PUBLIC int simsimd_dataset_stream_search(char const* path, simsimd_dataset_format_t format,
+                                                 simsimd_metric_kind_t metric, void const* queries,
+                                                 simsimd_size_t queries_count, simsimd_size_t k,
+                                                 simsimd_size_t chunk_bytes, simsimd_size_t* ids,
+                                                 simsimd_distance_t* distances) {
+    // Map the file only to validate it and learn its layout, without touching the pages of the rows
+    simsimd_dataset_t dataset;
+    if (!simsimd_dataset_open(&dataset, path, format))
+        return 0;
+    simsimd_size_t const offset = (simsimd_size_t)(dataset.rows - (simsimd_b8_t const*)dataset.mapping);
+    simsimd_size_t const count = dataset.count, stride = dataset.stride, n = dataset.dimensions;
+    simsimd_size_t const row_bytes = n * dataset.scalar_bytes;
+    simsimd_metric_punned_t kernel = simsimd_metric_punned(metric, dataset.datatype, simsimd_cap_any_k);
+    simsimd_dataset_close(&dataset);
+    if (!kernel)
+        return 0;
+
+    simsimd_distance_t const sign = metric == simsimd_metric_dot_k ? -1 : 1;
+    simsimd_size_t chunk_rows = (chunk_bytes ? chunk_bytes : SIMSIMD_DATASET_CHUNK_BYTES) / stride;
+    if (chunk_rows > count)
+        chunk_rows = count;
+    if (!chunk_rows)
+        chunk_rows = 1;
+    simsimd_size_t const chunks = (count + chunk_rows - 1) / chunk_rows;
+    simsimd_size_t const buffer_bytes = chunk_rows * stride;
+    simsimd_b8_t* buffers = (simsimd_b8_t*)malloc(2 * buffer_bytes + 1);
+    simsimd_size_t* sizes = (simsimd_size_t*)calloc(queries_count + 1, sizeof(simsimd_size_t));
+    // Every chunk has its own failure flag, written by the reader before the barrier ending the previous chunk,
+    // so all threads agree on it, and keep passing through the same worksharing constructs after a failure
+    simsimd_b8_t* chunks_failed = (simsimd_b8_t*)calloc(chunks + 1, sizeof(simsimd_b8_t));
+    FILE* file = fopen(path, "rb");
+    int failed = !buffers || !sizes || !chunks_failed || !file || fseek(file, (long)offset, SEEK_SET) != 0;
+    if (!failed && chunks)
+        chunks_failed[0] = !simsimd_dataset_read_rows(file, buffers, chunk_rows, stride, row_bytes);
+
+    long long const queries_signed = (long long)queries_count;
+#if defined(_OPENMP)
+#pragma omp parallel if (!failed)
+#endif
+    if (!failed) {
+        for (simsimd_size_t c = 0; c < chunks; ++c) {
+            simsimd_b8_t const* current = buffers + (c % 2) * buffer_bytes;
+            simsimd_b8_t* next = buffers + ((c + 1) % 2) * buffer_bytes;
+            simsimd_size_t const first = c * chunk_rows;
+            simsimd_size_t const rows = count - first < chunk_rows ? count - first : chunk_rows;
+            simsimd_size_t const next_rows = count - first - rows < chunk_rows ? count - first - rows : chunk_rows;
+            int const skipped = chunks_failed[c];
+
+            // One thread reads ahead, while the rest start scoring, joining the barrier at the end of the loop.
+            // A failure is carried over to all following chunks, that are skipped without reading.
+#if defined(_OPENMP)
+#pragma omp single nowait
+#endif
+            if (skipped || (next_rows && !simsimd_dataset_read_rows(file, next, next_rows, stride, row_bytes)))
+                chunks_failed[c + 1] = 1;
+
+            long long const scored_queries = skipped ? 0 : queries_signed;
+#if defined(_OPENMP)
+#pragma omp for schedule(dynamic, 1)
+#endif
+            for (long long q = 0; q < scored_queries; ++q) {
+                void const* query = (simsimd_b8_t const*)queries + q * row_bytes;
+                simsimd_size_t* query_ids = ids + q * k;
+                simsimd_distance_t* query_distances = distances + q * k;
+                for (simsimd_size_t r = 0; r != rows; ++r) {
+                    simsimd_distance_t distance;
+                    kernel(query, current + r * stride, n, &distance);
+                    simsimd_topk_push(query_distances, query_ids, k, &sizes[q], sign * distance, first + r);
+                }
+            }
+        }
+    }
+    if (!failed && chunks)
+        failed = chunks_failed[chunks];
+
+    if (!failed) {
+        for (simsimd_size_t q = 0; q != queries_count; ++q) {
+            simsimd_size_t* query_ids = ids + q * k;
+            simsimd_distance_t* query_distances = distances + q * k;
+            simsimd_topk_sort(query_distances, query_ids, sizes[q]);
+            for (simsimd_size_t j = 0; j != sizes[q]; ++j)
+                query_distances[j] *= sign;
+            for (simsimd_size_t j = sizes[q]; j < k; ++j)
+                query_ids[j] = (simsimd_size_t)-1, query_distances[j] = sign * DBL_MAX;
+        }
+    }
+    if (file)
+        fclose(file);
+    free(buffers);
+    free(sizes);
+    free(chunks_failed);
+    return !failed;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SIMSIMD_DATASET_H
@@ -99,6 +99,9 @@ SIMSIMD_PUBLIC void simsimd_dot_f64_sve(simsimd_f64_t const* a, simsimd_f64_t co
 SIMSIMD_PUBLIC void simsimd_dot_f64c_sve(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n, simsimd_distance_t* results);
 SIMSIMD_PUBLIC void simsimd_vdot_f64c_sve(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n, simsimd_distance_t* results);
 
+SIMSIMD_PUBLIC void simsimd_dot_i8_sve(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_distance_t* result);
+SIMSIMD_PUBLIC void simsimd_dot_bf16_sve(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n, simsimd_distance_t* result);
+
 /*  SIMD-powered backends for AVX2 CPUs of Haswell generation and newer, using 32-bit arithmetic over 256-bit words.
  *  First demonstrated in 2011, at least one Haswell-based processor was still being sold in 2022 — the Pentium G3420.
  *  Practically all modern x86 CPUs support AVX2, FMA, and F16C, making it a perfect baseline for SIMD algorithms.
@@ -117,6 +120,12 @@ SIMSIMD_PUBLIC void simsimd_dot_bf16_haswell(simsimd_bf16_t const* a, simsimd_bf
 
 SIMSIMD_PUBLIC void simsimd_dot_i8_haswell(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_distance_t* result);
 
+/*  SIMD-powered backends for AVX-VNNI CPUs of Alder Lake generation and newer, using 32-bit integer arithmetic over 256-bit words.
+ *  Hybrid client chips, like Alder Lake and Arrow Lake, and E-core only servers, like Sierra Forest, don't support AVX512,
+ *  but have the VEX-encoded version of VNNI, capable of fusing four 8-bit multiplications and an addition per lane.
+ */
+SIMSIMD_PUBLIC void simsimd_dot_i8_alder(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_distance_t* result);
+
 /*  SIMD-powered backends for various generations of AVX512 CPUs.
  *  Skylake is handy, as it supports masked loads and other operations, avoiding the need for the tail loop.
  *  Ice Lake added VNNI, VPOPCNTDQ, IFMA, VBMI, VAES, GFNI, VBMI2, BITALG, VPCLMULQDQ, and other extensions for integral operations.
@@ -313,6 +322,7 @@ SIMSIMD_PUBLIC void simsimd_vdot_f32c_neon(simsimd_f32_t const* a, simsimd_f32_t
 #pragma clang attribute pop
 #pragma GCC pop_options
 
+#if SIMSIMD_TARGET_NEON_I8
 #pragma GCC push_options
 #pragma GCC target("arch=armv8.2-a+dotprod")
 #pragma clang attribute push(__attribute__((target("arch=armv8.2-a+dotprod"))), apply_to = function)
@@ -349,7 +359,9 @@ SIMSIMD_PUBLIC void simsimd_dot_i8_neon(simsimd_i8_t const* a, simsimd_i8_t cons
 
 #pragma clang attribute pop
 #pragma GCC pop_options
+#endif // SIMSIMD_TARGET_NEON_I8
 
+#if SIMSIMD_TARGET_NEON_F16
 #pragma GCC push_options
 #pragma GCC target("+simd+fp16")
 #pragma clang attribute push(__attribute__((target("+simd+fp16"))), apply_to = function)
@@ -466,6 +478,7 @@ SIMSIMD_PUBLIC void simsimd_vdot_f16c_neon(simsimd_f16_t const* a, simsimd_f16_t
 
 #pragma clang attribute pop
 #pragma GCC pop_options
+#endif // SIMSIMD_TARGET_NEON_F16
 
 #if SIMSIMD_TARGET_NEON_BF16_IMPLEMENTED
 #pragma GCC push_options
@@ -787,6 +800,52 @@ SIMSIMD_PUBLIC void simsimd_vdot_f16c_sve(simsimd_f16_t const* a, simsimd_f16_t
 
 #pragma clang attribute pop
 #pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("+sve")
+#pragma clang attribute push(__attribute__((target("+sve"))), apply_to = function)
+
+SIMSIMD_PUBLIC void simsimd_dot_i8_sve(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n,
+                                       simsimd_distance_t* result) {
+    simsimd_size_t i = 0;
+    svint32_t ab_vec = svdup_n_s32(0);
+    do {
+        svbool_t pg_vec = svwhilelt_b8((unsigned int)i, (unsigned int)n);
+        svint8_t a_vec = svld1_s8(pg_vec, a + i);
+        svint8_t b_vec = svld1_s8(pg_vec, b + i);
+        ab_vec = svdot_s32(ab_vec, a_vec, b_vec);
+        i += svcntb();
+    } while (i < n);
+    *result = svaddv_s32(svptrue_b32(), ab_vec);
+}
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+
+#if SIMSIMD_TARGET_NEON_BF16
+#pragma GCC push_options
+#pragma GCC target("+sve+bf16")
+#pragma clang attribute push(__attribute__((target("+sve+bf16"))), apply_to = function)
+
+SIMSIMD_PUBLIC void simsimd_dot_bf16_sve(simsimd_bf16_t const* a_enum, simsimd_bf16_t const* b_enum, simsimd_size_t n,
+                                         simsimd_distance_t* result) {
+    simsimd_size_t i = 0;
+    svfloat32_t ab_vec = svdup_n_f32(0.f);
+    simsimd_bf16_for_arm_simd_t const* a = (simsimd_bf16_for_arm_simd_t const*)(a_enum);
+    simsimd_bf16_for_arm_simd_t const* b = (simsimd_bf16_for_arm_simd_t const*)(b_enum);
+    do {
+        svbool_t pg_vec = svwhilelt_b16((unsigned int)i, (unsigned int)n);
+        svbfloat16_t a_vec = svld1_bf16(pg_vec, a + i);
+        svbfloat16_t b_vec = svld1_bf16(pg_vec, b + i);
+        ab_vec = svbfdot_f32(ab_vec, a_vec, b_vec);
+        i += svcnth();
+    } while (i < n);
+    *result = svaddv_f32(svptrue_b32(), ab_vec);
+}
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_NEON_BF16
 #endif // SIMSIMD_TARGET_SVE
 #endif // SIMSIMD_TARGET_ARM
 
@@ -1156,6 +1215,47 @@ SIMSIMD_PUBLIC void simsimd_dot_bf16_haswell(simsimd_bf16_t const* a, simsimd_bf
 #pragma GCC pop_options
 #endif // SIMSIMD_TARGET_HASWELL
 
+#if SIMSIMD_TARGET_ALDER
+#pragma GCC push_options
+#pragma GCC target("avx2", "avxvnni")
+#pragma clang attribute push(__attribute__((target("avx2,avxvnni"))), apply_to = function)
+
+SIMSIMD_PUBLIC void simsimd_dot_i8_alder(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n,
+                                         simsimd_distance_t* result) {
+
+    // The `_mm256_dpbusd_avx_epi32` intrinsic is asymmetric, multiplying unsigned bytes of the first argument
+    // by signed bytes of the second one. Flipping the sign bit of `a` maps it into the unsigned range,
+    // effectively computing (a + 128) * b, so we also accumulate the sum of `b` to subtract the bias at the end.
+    __m256i const sign_vec = _mm256_set1_epi8((char)0x80);
+    __m256i const ones_vec = _mm256_set1_epi8(1);
+    __m256i ab_biased_vec = _mm256_setzero_si256();
+    __m256i b_sum_vec = _mm256_setzero_si256();
+
+    simsimd_size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i a_vec = _mm256_loadu_si256((__m256i const*)(a + i));
+        __m256i b_vec = _mm256_loadu_si256((__m256i const*)(b + i));
+        ab_biased_vec = _mm256_dpbusd_avx_epi32(ab_biased_vec, _mm256_xor_si256(a_vec, sign_vec), b_vec);
+        b_sum_vec = _mm256_dpbusd_avx_epi32(b_sum_vec, ones_vec, b_vec);
+    }
+
+    // Remove the bias and reduce horizontally
+    __m256i ab_vec = _mm256_sub_epi32(ab_biased_vec, _mm256_slli_epi32(b_sum_vec, 7));
+    __m128i ab_sum = _mm_add_epi32(_mm256_castsi256_si128(ab_vec), _mm256_extracti128_si256(ab_vec, 1));
+    ab_sum = _mm_hadd_epi32(ab_sum, ab_sum);
+    ab_sum = _mm_hadd_epi32(ab_sum, ab_sum);
+
+    // Take care of the tail:
+    int ab = _mm_cvtsi128_si32(ab_sum);
+    for (; i < n; ++i)
+        ab += a[i] * b[i];
+    *result = ab;
+}
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_ALDER
+
 #if SIMSIMD_TARGET_SKYLAKE
 #pragma GCC push_options
 #pragma GCC target("avx512f", "avx512vl", "avx512bw", "bmi2")
@@ -0,0 +1,1050 @@
+/**
+ *  @file       elementwise.h
+ *  @brief      SIMD-accelerated mixed-precision element-wise operations.
+ *  @author     Ash Vardanian
+ *  @date       October 17, 2026
+ *
+ *  Contains following element-wise operations:
+ *  - Weighted Sum: result[i] = alpha * a[i] + beta * b[i]
+ *  - FMA or Fused-Multiply-Add: result[i] = alpha * a[i] * b[i] + beta * c[i]
+ *  - Scale and Shift: result[i] = alpha * a[i] + beta
+ *  - Scale and Cast: same as above, but changing the type, like `f32` to `f16` or back
+ *  - Affine Cast: result[i] = alphas[i] * a[i] + betas[i], for per-dimension `i8` quantization
+ *  - L2 Normalization: result[i] = a[i] / |a|, fusing the norm and the scaling of every row into one kernel
+ *
+ *  For datatypes:
+ *  - 64-bit IEEE floating point numbers
+ *  - 32-bit IEEE floating point numbers
+ *  - 16-bit IEEE floating point numbers
+ *  - 16-bit brain floating point numbers
+ *  - 8-bit signed integral numbers, rounded and saturated on output
+ *
+ *  For hardware architectures:
+ *  - Arm (NEON)
+ *  - x86 (AVX2, AVX512)
+ *
+ *  Unlike the distance functions, these produce vectors of the same type as the inputs,
+ *  except for the `simsimd_{scale,affine}_*_to_*` kernels, used to normalize and quantize embeddings.
+ *  All of the low-precision types are upcast to `f32` before the arithmetic, and the scaling
+ *  factors are always passed as `simsimd_distance_t`, to keep the signatures uniform.
+ *
+ *  x86 intrinsics: https://www.intel.com/content/www/us/en/docs/intrinsics-guide/
+ *  Arm intrinsics: https://developer.arm.com/architectures/instruction-sets/intrinsics/
+ */
+#ifndef SIMSIMD_ELEMENTWISE_H
+#define SIMSIMD_ELEMENTWISE_H
+
+#include "types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// clang-format off
+
+/*  Serial backends for all numeric types.
+ *  By default they use 32-bit arithmetic, unless the arguments themselves contain 64-bit floats.
+ */
+SIMSIMD_PUBLIC void simsimd_wsum_f64_serial(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f64_t* result);
+SIMSIMD_PUBLIC void simsimd_fma_f64_serial(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_f64_t const* c, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f64_t* result);
+SIMSIMD_PUBLIC void simsimd_scale_f64_serial(simsimd_f64_t const* a, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f64_t* result);
+SIMSIMD_PUBLIC void simsimd_wsum_f32_serial(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f32_t* result);
+SIMSIMD_PUBLIC void simsimd_fma_f32_serial(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_f32_t const* c, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f32_t* result);
+SIMSIMD_PUBLIC void simsimd_scale_f32_serial(simsimd_f32_t const* a, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f32_t* result);
+SIMSIMD_PUBLIC void simsimd_wsum_f16_serial(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f16_t* result);
+SIMSIMD_PUBLIC void simsimd_fma_f16_serial(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_f16_t const* c, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f16_t* result);
+SIMSIMD_PUBLIC void simsimd_scale_f16_serial(simsimd_f16_t const* a, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f16_t* result);
+SIMSIMD_PUBLIC void simsimd_wsum_bf16_serial(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_bf16_t* result);
+SIMSIMD_PUBLIC void simsimd_fma_bf16_serial(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_bf16_t const* c, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_bf16_t* result);
+SIMSIMD_PUBLIC void simsimd_scale_bf16_serial(simsimd_bf16_t const* a, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_bf16_t* result);
+SIMSIMD_PUBLIC void simsimd_wsum_i8_serial(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_i8_t* result);
+SIMSIMD_PUBLIC void simsimd_fma_i8_serial(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_i8_t const* c, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_i8_t* result);
+SIMSIMD_PUBLIC void simsimd_scale_i8_serial(simsimd_i8_t const* a, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_i8_t* result);
+SIMSIMD_PUBLIC void simsimd_scale_f32_to_f16_serial(simsimd_f32_t const* a, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f16_t* result);
+SIMSIMD_PUBLIC void simsimd_scale_f32_to_bf16_serial(simsimd_f32_t const* a, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_bf16_t* result);
+SIMSIMD_PUBLIC void simsimd_scale_f16_to_f32_serial(simsimd_f16_t const* a, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f32_t* result);
+SIMSIMD_PUBLIC void simsimd_scale_bf16_to_f32_serial(simsimd_bf16_t const* a, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f32_t* result);
+SIMSIMD_PUBLIC void simsimd_scale_f32_to_i8_serial(simsimd_f32_t const* a, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_i8_t* result);
+SIMSIMD_PUBLIC void simsimd_scale_i8_to_f32_serial(simsimd_i8_t const* a, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f32_t* result);
+SIMSIMD_PUBLIC void simsimd_affine_f32_to_i8_serial(simsimd_f32_t const* a, simsimd_size_t n, simsimd_f32_t const* alphas, simsimd_f32_t const* betas, simsimd_i8_t* result);
+SIMSIMD_PUBLIC void simsimd_affine_i8_to_f32_serial(simsimd_i8_t const* a, simsimd_size_t n, simsimd_f32_t const* alphas, simsimd_f32_t const* betas, simsimd_f32_t* result);
+SIMSIMD_PUBLIC void simsimd_normalize_f32_serial(simsimd_f32_t const* a, simsimd_size_t count, simsimd_size_t n, simsimd_f32_t* result);
+
+/*  SIMD-powered backends for Arm NEON, using 32-bit arithmetic over 128-bit words.
+ *  The `f16` variants also expect `FEAT_FP16` for the conversions.
+ */
+SIMSIMD_PUBLIC void simsimd_wsum_f32_neon(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f32_t* result);
+SIMSIMD_PUBLIC void simsimd_fma_f32_neon(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_f32_t const* c, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f32_t* result);
+SIMSIMD_PUBLIC void simsimd_scale_f32_neon(simsimd_f32_t const* a, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f32_t* result);
+SIMSIMD_PUBLIC void simsimd_scale_f32_to_i8_neon(simsimd_f32_t const* a, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_i8_t* result);
+SIMSIMD_PUBLIC void simsimd_scale_i8_to_f32_neon(simsimd_i8_t const* a, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f32_t* result);
+SIMSIMD_PUBLIC void simsimd_affine_f32_to_i8_neon(simsimd_f32_t const* a, simsimd_size_t n, simsimd_f32_t const* alphas, simsimd_f32_t const* betas, simsimd_i8_t* result);
+SIMSIMD_PUBLIC void simsimd_affine_i8_to_f32_neon(simsimd_i8_t const* a, simsimd_size_t n, simsimd_f32_t const* alphas, simsimd_f32_t const* betas, simsimd_f32_t* result);
+SIMSIMD_PUBLIC void simsimd_normalize_f32_neon(simsimd_f32_t const* a, simsimd_size_t count, simsimd_size_t n, simsimd_f32_t* result);
+SIMSIMD_PUBLIC void simsimd_wsum_f16_neon(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f16_t* result);
+SIMSIMD_PUBLIC void simsimd_fma_f16_neon(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_f16_t const* c, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f16_t* result);
+SIMSIMD_PUBLIC void simsimd_scale_f16_neon(simsimd_f16_t const* a, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f16_t* result);
+SIMSIMD_PUBLIC void simsimd_scale_f32_to_f16_neon(simsimd_f32_t const* a, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f16_t* result);
+SIMSIMD_PUBLIC void simsimd_scale_f16_to_f32_neon(simsimd_f16_t const* a, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f32_t* result);
+
+/*  SIMD-powered backends for AVX2 CPUs of Haswell generation and newer, using 32-bit arithmetic over 256-bit words.
+ *  Unlike the reductions, element-wise `f32` and `f64` kernels are included here, to guarantee fused
+ *  multiply-additions regardless of the compiler flags used to build the serial code.
+ */
+SIMSIMD_PUBLIC void simsimd_wsum_f64_haswell(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f64_t* result);
+SIMSIMD_PUBLIC void simsimd_fma_f64_haswell(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_f64_t const* c, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f64_t* result);
+SIMSIMD_PUBLIC void simsimd_scale_f64_haswell(simsimd_f64_t const* a, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f64_t* result);
+SIMSIMD_PUBLIC void simsimd_wsum_f32_haswell(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f32_t* result);
+SIMSIMD_PUBLIC void simsimd_fma_f32_haswell(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_f32_t const* c, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f32_t* result);
+SIMSIMD_PUBLIC void simsimd_scale_f32_haswell(simsimd_f32_t const* a, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f32_t* result);
+SIMSIMD_PUBLIC void simsimd_wsum_f16_haswell(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f16_t* result);
+SIMSIMD_PUBLIC void simsimd_fma_f16_haswell(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_f16_t const* c, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f16_t* result);
+SIMSIMD_PUBLIC void simsimd_scale_f16_haswell(simsimd_f16_t const* a, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f16_t* result);
+SIMSIMD_PUBLIC void simsimd_wsum_bf16_haswell(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_bf16_t* result);
+SIMSIMD_PUBLIC void simsimd_fma_bf16_haswell(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_bf16_t const* c, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_bf16_t* result);
+SIMSIMD_PUBLIC void simsimd_scale_bf16_haswell(simsimd_bf16_t const* a, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_bf16_t* result);
+SIMSIMD_PUBLIC void simsimd_wsum_i8_haswell(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_i8_t* result);
+SIMSIMD_PUBLIC void simsimd_fma_i8_haswell(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_i8_t const* c, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_i8_t* result);
+SIMSIMD_PUBLIC void simsimd_scale_i8_haswell(simsimd_i8_t const* a, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_i8_t* result);
+SIMSIMD_PUBLIC void simsimd_scale_f32_to_f16_haswell(simsimd_f32_t const* a, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f16_t* result);
+SIMSIMD_PUBLIC void simsimd_scale_f32_to_bf16_haswell(simsimd_f32_t const* a, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_bf16_t* result);
+SIMSIMD_PUBLIC void simsimd_scale_f16_to_f32_haswell(simsimd_f16_t const* a, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f32_t* result);
+SIMSIMD_PUBLIC void simsimd_scale_bf16_to_f32_haswell(simsimd_bf16_t const* a, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f32_t* result);
+SIMSIMD_PUBLIC void simsimd_scale_f32_to_i8_haswell(simsimd_f32_t const* a, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_i8_t* result);
+SIMSIMD_PUBLIC void simsimd_scale_i8_to_f32_haswell(simsimd_i8_t const* a, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f32_t* result);
+SIMSIMD_PUBLIC void simsimd_affine_f32_to_i8_haswell(simsimd_f32_t const* a, simsimd_size_t n, simsimd_f32_t const* alphas, simsimd_f32_t const* betas, simsimd_i8_t* result);
+SIMSIMD_PUBLIC void simsimd_affine_i8_to_f32_haswell(simsimd_i8_t const* a, simsimd_size_t n, simsimd_f32_t const* alphas, simsimd_f32_t const* betas, simsimd_f32_t* result);
+SIMSIMD_PUBLIC void simsimd_normalize_f32_haswell(simsimd_f32_t const* a, simsimd_size_t count, simsimd_size_t n, simsimd_f32_t* result);
+
+/*  SIMD-powered backends for AVX512 CPUs of Skylake generation and newer, using masked loads and stores
+ *  to avoid the serial tails.
+ */
+SIMSIMD_PUBLIC void simsimd_wsum_f64_skylake(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f64_t* result);
+SIMSIMD_PUBLIC void simsimd_fma_f64_skylake(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_f64_t const* c, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f64_t* result);
+SIMSIMD_PUBLIC void simsimd_scale_f64_skylake(simsimd_f64_t const* a, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f64_t* result);
+SIMSIMD_PUBLIC void simsimd_wsum_f32_skylake(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f32_t* result);
+SIMSIMD_PUBLIC void simsimd_fma_f32_skylake(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_f32_t const* c, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f32_t* result);
+SIMSIMD_PUBLIC void simsimd_scale_f32_skylake(simsimd_f32_t const* a, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f32_t* result);
+SIMSIMD_PUBLIC void simsimd_wsum_f16_skylake(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f16_t* result);
+SIMSIMD_PUBLIC void simsimd_fma_f16_skylake(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_f16_t const* c, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f16_t* result);
+SIMSIMD_PUBLIC void simsimd_scale_f16_skylake(simsimd_f16_t const* a, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f16_t* result);
+SIMSIMD_PUBLIC void simsimd_wsum_bf16_skylake(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_bf16_t* result);
+SIMSIMD_PUBLIC void simsimd_fma_bf16_skylake(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_bf16_t const* c, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_bf16_t* result);
+SIMSIMD_PUBLIC void simsimd_scale_bf16_skylake(simsimd_bf16_t const* a, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_bf16_t* result);
+SIMSIMD_PUBLIC void simsimd_wsum_i8_skylake(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_i8_t* result);
+SIMSIMD_PUBLIC void simsimd_fma_i8_skylake(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_i8_t const* c, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_i8_t* result);
+SIMSIMD_PUBLIC void simsimd_scale_i8_skylake(simsimd_i8_t const* a, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_i8_t* result);
+SIMSIMD_PUBLIC void simsimd_normalize_f32_skylake(simsimd_f32_t const* a, simsimd_size_t count, simsimd_size_t n, simsimd_f32_t* result);
+// clang-format on
+
+#define SIMSIMD_MAKE_WSUM(name, input_type, accumulator_type, load_and_convert, convert_and_store)                     \
+    SIMSIMD_PUBLIC void simsimd_wsum_##input_type##_##name(                                                            \
+        simsimd_##input_type##_t const* a, simsimd_##input_type##_t const* b, simsimd_size_t n,                        \
+        simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_##input_type##_t* result) {                         \
+        simsimd_##accumulator_type##_t alpha_cast = (simsimd_##accumulator_type##_t)alpha;                             \
+        simsimd_##accumulator_type##_t beta_cast = (simsimd_##accumulator_type##_t)beta;                               \
+        for (simsimd_size_t i = 0; i != n; ++i) {                                                                      \
+            simsimd_##accumulator_type##_t ai = load_and_convert(a[i]);                                                \
+            simsimd_##accumulator_type##_t bi = load_and_convert(b[i]);                                                \
+            result[i] = convert_and_store(alpha_cast * ai + beta_cast * bi);                                           \
+        }                                                                                                              \
+    }
+
+#define SIMSIMD_MAKE_FMA(name, input_type, accumulator_type, load_and_convert, convert_and_store)                      \
+    SIMSIMD_PUBLIC void simsimd_fma_##input_type##_##name(                                                             \
+        simsimd_##input_type##_t const* a, simsimd_##input_type##_t const* b, simsimd_##input_type##_t const* c,       \
+        simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_##input_type##_t* result) {       \
+        simsimd_##accumulator_type##_t alpha_cast = (simsimd_##accumulator_type##_t)alpha;                             \
+        simsimd_##accumulator_type##_t beta_cast = (simsimd_##accumulator_type##_t)beta;                               \
+        for (simsimd_size_t i = 0; i != n; ++i) {                                                                      \
+            simsimd_##accumulator_type##_t ai = load_and_convert(a[i]);                                                \
+            simsimd_##accumulator_type##_t bi = load_and_convert(b[i]);                                                \
+            simsimd_##accumulator_type##_t ci = load_and_convert(c[i]);                                                \
+            result[i] = convert_and_store(alpha_cast * ai * bi + beta_cast * ci);                                      \
+        }                                                                                                              \
+    }
+
+#define SIMSIMD_MAKE_SCALE(name, input_type, accumulator_type, load_and_convert, convert_and_store)                    \
+    SIMSIMD_PUBLIC void simsimd_scale_##input_type##_##name(simsimd_##input_type##_t const* a, simsimd_size_t n,       \
+                                                            simsimd_distance_t alpha, simsimd_distance_t beta,         \
+                                                            simsimd_##input_type##_t* result) {                        \
+        simsimd_##accumulator_type##_t alpha_cast = (simsimd_##accumulator_type##_t)alpha;                             \
+        simsimd_##accumulator_type##_t beta_cast = (simsimd_##accumulator_type##_t)beta;                               \
+        for (simsimd_size_t i = 0; i != n; ++i) {                                                                      \
+            simsimd_##accumulator_type##_t ai = load_and_convert(a[i]);                                                \
+            result[i] = convert_and_store(alpha_cast * ai + beta_cast);                                                \
+        }                                                                                                              \
+    }
+
+#define SIMSIMD_MAKE_SCALE_TO(name, input_type, output_type, load_and_convert, convert_and_store)                      \
+    SIMSIMD_PUBLIC void simsimd_scale_##input_type##_to_##output_type##_##name(                                        \
+        simsimd_##input_type##_t const* a, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta,        \
+        simsimd_##output_type##_t* result) {                                                                           \
+        simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha, beta_f32 = (simsimd_f32_t)beta;                                \
+        for (simsimd_size_t i = 0; i != n; ++i)                                                                        \
+            result[i] = convert_and_store(alpha_f32 * load_and_convert(a[i]) + beta_f32);                              \
+    }
+
+#define SIMSIMD_MAKE_AFFINE_TO(name, input_type, output_type, load_and_convert, convert_and_store)                     \
+    SIMSIMD_PUBLIC void simsimd_affine_##input_type##_to_##output_type##_##name(                                       \
+        simsimd_##input_type##_t const* a, simsimd_size_t n, simsimd_f32_t const* alphas, simsimd_f32_t const* betas,  \
+        simsimd_##output_type##_t* result) {                                                                           \
+        for (simsimd_size_t i = 0; i != n; ++i)                                                                        \
+            result[i] = convert_and_store(alphas[i] * load_and_convert(a[i]) + betas[i]);                              \
+    }
+
+SIMSIMD_MAKE_WSUM(serial, f64, f64, SIMSIMD_IDENTIFY, SIMSIMD_IDENTIFY)  // simsimd_wsum_f64_serial
+SIMSIMD_MAKE_FMA(serial, f64, f64, SIMSIMD_IDENTIFY, SIMSIMD_IDENTIFY)   // simsimd_fma_f64_serial
+SIMSIMD_MAKE_SCALE(serial, f64, f64, SIMSIMD_IDENTIFY, SIMSIMD_IDENTIFY) // simsimd_scale_f64_serial
+
+SIMSIMD_MAKE_WSUM(serial, f32, f32, SIMSIMD_IDENTIFY, SIMSIMD_IDENTIFY)  // simsimd_wsum_f32_serial
+SIMSIMD_MAKE_FMA(serial, f32, f32, SIMSIMD_IDENTIFY, SIMSIMD_IDENTIFY)   // simsimd_fma_f32_serial
+SIMSIMD_MAKE_SCALE(serial, f32, f32, SIMSIMD_IDENTIFY, SIMSIMD_IDENTIFY) // simsimd_scale_f32_serial
+
+SIMSIMD_MAKE_WSUM(serial, f16, f32, SIMSIMD_UNCOMPRESS_F16, SIMSIMD_COMPRESS_F16)  // simsimd_wsum_f16_serial
+SIMSIMD_MAKE_FMA(serial, f16, f32, SIMSIMD_UNCOMPRESS_F16, SIMSIMD_COMPRESS_F16)   // simsimd_fma_f16_serial
+SIMSIMD_MAKE_SCALE(serial, f16, f32, SIMSIMD_UNCOMPRESS_F16, SIMSIMD_COMPRESS_F16) // simsimd_scale_f16_serial
+
+SIMSIMD_MAKE_WSUM(serial, bf16, f32, SIMSIMD_UNCOMPRESS_BF16, SIMSIMD_COMPRESS_BF16)  // simsimd_wsum_bf16_serial
+SIMSIMD_MAKE_FMA(serial, bf16, f32, SIMSIMD_UNCOMPRESS_BF16, SIMSIMD_COMPRESS_BF16)   // simsimd_fma_bf16_serial
+SIMSIMD_MAKE_SCALE(serial, bf16, f32, SIMSIMD_UNCOMPRESS_BF16, SIMSIMD_COMPRESS_BF16) // simsimd_scale_bf16_serial
+
+SIMSIMD_MAKE_WSUM(serial, i8, f32, SIMSIMD_IDENTIFY, simsimd_saturate_i8)  // simsimd_wsum_i8_serial
+SIMSIMD_MAKE_FMA(serial, i8, f32, SIMSIMD_IDENTIFY, simsimd_saturate_i8)   // simsimd_fma_i8_serial
+SIMSIMD_MAKE_SCALE(serial, i8, f32, SIMSIMD_IDENTIFY, simsimd_saturate_i8) // simsimd_scale_i8_serial
+
+SIMSIMD_MAKE_SCALE_TO(serial, f32, f16, SIMSIMD_IDENTIFY, SIMSIMD_COMPRESS_F16)    // simsimd_scale_f32_to_f16_serial
+SIMSIMD_MAKE_SCALE_TO(serial, f32, bf16, SIMSIMD_IDENTIFY, SIMSIMD_COMPRESS_BF16)  // simsimd_scale_f32_to_bf16_serial
+SIMSIMD_MAKE_SCALE_TO(serial, f16, f32, SIMSIMD_UNCOMPRESS_F16, SIMSIMD_IDENTIFY)  // simsimd_scale_f16_to_f32_serial
+SIMSIMD_MAKE_SCALE_TO(serial, bf16, f32, SIMSIMD_UNCOMPRESS_BF16, SIMSIMD_IDENTIFY) // simsimd_scale_bf16_to_f32_serial
+SIMSIMD_MAKE_SCALE_TO(serial, f32, i8, SIMSIMD_IDENTIFY, simsimd_saturate_i8)       // simsimd_scale_f32_to_i8_serial
+SIMSIMD_MAKE_SCALE_TO(serial, i8, f32, SIMSIMD_IDENTIFY, SIMSIMD_IDENTIFY)          // simsimd_scale_i8_to_f32_serial
+
+SIMSIMD_MAKE_AFFINE_TO(serial, f32, i8, SIMSIMD_IDENTIFY, simsimd_saturate_i8) // simsimd_affine_f32_to_i8_serial
+SIMSIMD_MAKE_AFFINE_TO(serial, i8, f32, SIMSIMD_IDENTIFY, SIMSIMD_IDENTIFY)    // simsimd_affine_i8_to_f32_serial
+
+/*  The L2 normalization kernels compute the squared norm of a row and immediately scale it, while it's still
+ *  in the L1 cache. The reciprocal square root is computed once per row in double precision, so all backends
+ *  scale by the same factor, if their squared norms match. Rows with a zero norm are exported as zeros.
+ */
+SIMSIMD_INTERNAL simsimd_f32_t simsimd_normalizer_f32(simsimd_f32_t norm_squared) {
+    return norm_squared > 0 ? (simsimd_f32_t)(1 / SIMSIMD_SQRT((simsimd_f64_t)norm_squared)) : 0;
+}
+
+SIMSIMD_PUBLIC void simsimd_normalize_f32_serial(simsimd_f32_t const* a, simsimd_size_t count, simsimd_size_t n,
+                                                 simsimd_f32_t* result) {
+    for (simsimd_size_t row = 0; row != count; ++row, a += n, result += n) {
+        simsimd_f32_t norm_squared = 0;
+        for (simsimd_size_t i = 0; i != n; ++i)
+            norm_squared += a[i] * a[i];
+        simsimd_f32_t normalizer = simsimd_normalizer_f32(norm_squared);
+        for (simsimd_size_t i = 0; i != n; ++i)
+            result[i] = a[i] * normalizer;
+    }
+}
+
+#if SIMSIMD_TARGET_ARM
+#if SIMSIMD_TARGET_NEON
+#pragma GCC push_options
+#pragma GCC target("+simd")
+#pragma clang attribute push(__attribute__((target("+simd"))), apply_to = function)
+
+SIMSIMD_PUBLIC void simsimd_wsum_f32_neon(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n,
+                                          simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f32_t* result) {
+    simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha, beta_f32 = (simsimd_f32_t)beta;
+    float32x4_t alpha_vec = vdupq_n_f32(alpha_f32), beta_vec = vdupq_n_f32(beta_f32);
+    simsimd_size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        float32x4_t a_vec = vld1q_f32(a + i);
+        float32x4_t b_vec = vld1q_f32(b + i);
+        vst1q_f32(result + i, vfmaq_f32(vmulq_f32(a_vec, alpha_vec), b_vec, beta_vec));
+    }
+    for (; i < n; ++i)
+        result[i] = alpha_f32 * a[i] + beta_f32 * b[i];
+}
+
+SIMSIMD_PUBLIC void simsimd_fma_f32_neon(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_f32_t const* c,
+                                         simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta,
+                                         simsimd_f32_t* result) {
+    simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha, beta_f32 = (simsimd_f32_t)beta;
+    float32x4_t alpha_vec = vdupq_n_f32(alpha_f32), beta_vec = vdupq_n_f32(beta_f32);
+    simsimd_size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        float32x4_t ab_vec = vmulq_f32(vld1q_f32(a + i), vld1q_f32(b + i));
+        float32x4_t c_vec = vld1q_f32(c + i);
+        vst1q_f32(result + i, vfmaq_f32(vmulq_f32(ab_vec, alpha_vec), c_vec, beta_vec));
+    }
+    for (; i < n; ++i)
+        result[i] = alpha_f32 * a[i] * b[i] + beta_f32 * c[i];
+}
+
+SIMSIMD_PUBLIC void simsimd_scale_f32_neon(simsimd_f32_t const* a, simsimd_size_t n, simsimd_distance_t alpha,
+                                           simsimd_distance_t beta, simsimd_f32_t* result) {
+    simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha, beta_f32 = (simsimd_f32_t)beta;
+    float32x4_t alpha_vec = vdupq_n_f32(alpha_f32), beta_vec = vdupq_n_f32(beta_f32);
+    simsimd_size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+        vst1q_f32(result + i, vfmaq_f32(beta_vec, vld1q_f32(a + i), alpha_vec));
+    for (; i < n; ++i)
+        result[i] = alpha_f32 * a[i] + beta_f32;
+}
+
+SIMSIMD_INTERNAL int32x4_t simsimd_f32x4_to_i32x4_neon(float32x4_t x) {
+    // Mirror `simsimd_saturate_i8` exactly: clamp, add a half with the sign of `x`, and truncate
+    x = vminq_f32(vmaxq_f32(x, vdupq_n_f32(-128.f)), vdupq_n_f32(127.f));
+    uint32x4_t sign = vandq_u32(vreinterpretq_u32_f32(x), vdupq_n_u32(0x80000000u));
+    float32x4_t half = vreinterpretq_f32_u32(vorrq_u32(sign, vreinterpretq_u32_f32(vdupq_n_f32(0.5f))));
+    return vcvtq_s32_f32(vaddq_f32(x, half));
+}
+
+SIMSIMD_INTERNAL int8x8_t simsimd_f32x8_to_i8x8_neon(float32x4_t low, float32x4_t high) {
+    int16x8_t x_i16 = vcombine_s16(vqmovn_s32(simsimd_f32x4_to_i32x4_neon(low)),
+                                   vqmovn_s32(simsimd_f32x4_to_i32x4_neon(high)));
+    return vqmovn_s16(x_i16);
+}
+
+SIMSIMD_PUBLIC void simsimd_scale_f32_to_i8_neon(simsimd_f32_t const* a, simsimd_size_t n, simsimd_distance_t alpha,
+                                                 simsimd_distance_t beta, simsimd_i8_t* result) {
+    simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha, beta_f32 = (simsimd_f32_t)beta;
+    float32x4_t alpha_vec = vdupq_n_f32(alpha_f32), beta_vec = vdupq_n_f32(beta_f32);
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        float32x4_t low_vec = vaddq_f32(vmulq_f32(vld1q_f32(a + i), alpha_vec), beta_vec);
+        float32x4_t high_vec = vaddq_f32(vmulq_f32(vld1q_f32(a + i + 4), alpha_vec), beta_vec);
+        vst1_s8(result + i, simsimd_f32x8_to_i8x8_neon(low_vec, high_vec));
+    }
+    for (; i < n; ++i)
+        result[i] = simsimd_saturate_i8(alpha_f32 * a[i] + beta_f32);
+}
+
+SIMSIMD_PUBLIC void simsimd_scale_i8_to_f32_neon(simsimd_i8_t const* a, simsimd_size_t n, simsimd_distance_t alpha,
+                                                 simsimd_distance_t beta, simsimd_f32_t* result) {
+    simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha, beta_f32 = (simsimd_f32_t)beta;
+    float32x4_t alpha_vec = vdupq_n_f32(alpha_f32), beta_vec = vdupq_n_f32(beta_f32);
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        int16x8_t a_i16 = vmovl_s8(vld1_s8(a + i));
+        float32x4_t low_vec = vcvtq_f32_s32(vmovl_s16(vget_low_s16(a_i16)));
+        float32x4_t high_vec = vcvtq_f32_s32(vmovl_high_s16(a_i16));
+        vst1q_f32(result + i, vfmaq_f32(beta_vec, low_vec, alpha_vec));
+        vst1q_f32(result + i + 4, vfmaq_f32(beta_vec, high_vec, alpha_vec));
+    }
+    for (; i < n; ++i)
+        result[i] = alpha_f32 * a[i] + beta_f32;
+}
+
+SIMSIMD_PUBLIC void simsimd_affine_f32_to_i8_neon(simsimd_f32_t const* a, simsimd_size_t n, simsimd_f32_t const* alphas,
+                                                  simsimd_f32_t const* betas, simsimd_i8_t* result) {
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        float32x4_t low_vec = vaddq_f32(vmulq_f32(vld1q_f32(a + i), vld1q_f32(alphas + i)), vld1q_f32(betas + i));
+        float32x4_t high_vec =
+            vaddq_f32(vmulq_f32(vld1q_f32(a + i + 4), vld1q_f32(alphas + i + 4)), vld1q_f32(betas + i + 4));
+        vst1_s8(result + i, simsimd_f32x8_to_i8x8_neon(low_vec, high_vec));
+    }
+    for (; i < n; ++i)
+        result[i] = simsimd_saturate_i8(alphas[i] * a[i] + betas[i]);
+}
+
+SIMSIMD_PUBLIC void simsimd_affine_i8_to_f32_neon(simsimd_i8_t const* a, simsimd_size_t n, simsimd_f32_t const* alphas,
+                                                  simsimd_f32_t const* betas, simsimd_f32_t* result) {
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        int16x8_t a_i16 = vmovl_s8(vld1_s8(a + i));
+        float32x4_t low_vec = vcvtq_f32_s32(vmovl_s16(vget_low_s16(a_i16)));
+        float32x4_t high_vec = vcvtq_f32_s32(vmovl_high_s16(a_i16));
+        vst1q_f32(result + i, vfmaq_f32(vld1q_f32(betas + i), low_vec, vld1q_f32(alphas + i)));
+        vst1q_f32(result + i + 4, vfmaq_f32(vld1q_f32(betas + i + 4), high_vec, vld1q_f32(alphas + i + 4)));
+    }
+    for (; i < n; ++i)
+        result[i] = alphas[i] * a[i] + betas[i];
+}
+
+SIMSIMD_PUBLIC void simsimd_normalize_f32_neon(simsimd_f32_t const* a, simsimd_size_t count, simsimd_size_t n,
+                                               simsimd_f32_t* result) {
+    for (simsimd_size_t row = 0; row != count; ++row, a += n, result += n) {
+        float32x4_t norm_squared_vec = vdupq_n_f32(0);
+        simsimd_size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            float32x4_t a_vec = vld1q_f32(a + i);
+            norm_squared_vec = vfmaq_f32(norm_squared_vec, a_vec, a_vec);
+        }
+        simsimd_f32_t norm_squared = vaddvq_f32(norm_squared_vec);
+        for (; i < n; ++i)
+            norm_squared += a[i] * a[i];
+        simsimd_f32_t normalizer = simsimd_normalizer_f32(norm_squared);
+        float32x4_t normalizer_vec = vdupq_n_f32(normalizer);
+        for (i = 0; i + 4 <= n; i += 4)
+            vst1q_f32(result + i, vmulq_f32(vld1q_f32(a + i), normalizer_vec));
+        for (; i < n; ++i)
+            result[i] = a[i] * normalizer;
+    }
+}
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_NEON
+
+#if SIMSIMD_TARGET_NEON_F16
+#pragma GCC push_options
+#pragma GCC target("+simd+fp16")
+#pragma clang attribute push(__attribute__((target("+simd+fp16"))), apply_to = function)
+
+SIMSIMD_PUBLIC void simsimd_wsum_f16_neon(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n,
+                                          simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f16_t* result) {
+    simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha, beta_f32 = (simsimd_f32_t)beta;
+    float32x4_t alpha_vec = vdupq_n_f32(alpha_f32), beta_vec = vdupq_n_f32(beta_f32);
+    simsimd_size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        float32x4_t a_vec = vcvt_f32_f16(vld1_f16((simsimd_f16_for_arm_simd_t const*)a + i));
+        float32x4_t b_vec = vcvt_f32_f16(vld1_f16((simsimd_f16_for_arm_simd_t const*)b + i));
+        float32x4_t sum_vec = vfmaq_f32(vmulq_f32(a_vec, alpha_vec), b_vec, beta_vec);
+        vst1_f16((simsimd_f16_for_arm_simd_t*)result + i, vcvt_f16_f32(sum_vec));
+    }
+    for (; i < n; ++i)
+        result[i] =
+            SIMSIMD_COMPRESS_F16(alpha_f32 * SIMSIMD_UNCOMPRESS_F16(a[i]) + beta_f32 * SIMSIMD_UNCOMPRESS_F16(b[i]));
+}
+
+SIMSIMD_PUBLIC void simsimd_fma_f16_neon(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_f16_t const* c,
+                                         simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta,
+                                         simsimd_f16_t* result) {
+    simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha, beta_f32 = (simsimd_f32_t)beta;
+    float32x4_t alpha_vec = vdupq_n_f32(alpha_f32), beta_vec = vdupq_n_f32(beta_f32);
+    simsimd_size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        float32x4_t a_vec = vcvt_f32_f16(vld1_f16((simsimd_f16_for_arm_simd_t const*)a + i));
+        float32x4_t b_vec = vcvt_f32_f16(vld1_f16((simsimd_f16_for_arm_simd_t const*)b + i));
+        float32x4_t c_vec = vcvt_f32_f16(vld1_f16((simsimd_f16_for_arm_simd_t const*)c + i));
+        float32x4_t sum_vec = vfmaq_f32(vmulq_f32(vmulq_f32(a_vec, b_vec), alpha_vec), c_vec, beta_vec);
+        vst1_f16((simsimd_f16_for_arm_simd_t*)result + i, vcvt_f16_f32(sum_vec));
+    }
+    for (; i < n; ++i)
+        result[i] = SIMSIMD_COMPRESS_F16(alpha_f32 * SIMSIMD_UNCOMPRESS_F16(a[i]) * SIMSIMD_UNCOMPRESS_F16(b[i]) +
+                                         beta_f32 * SIMSIMD_UNCOMPRESS_F16(c[i]));
+}
+
+SIMSIMD_PUBLIC void simsimd_scale_f16_neon(simsimd_f16_t const* a, simsimd_size_t n, simsimd_distance_t alpha,
+                                           simsimd_distance_t beta, simsimd_f16_t* result) {
+    simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha, beta_f32 = (simsimd_f32_t)beta;
+    float32x4_t alpha_vec = vdupq_n_f32(alpha_f32), beta_vec = vdupq_n_f32(beta_f32);
+    simsimd_size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        float32x4_t a_vec = vcvt_f32_f16(vld1_f16((simsimd_f16_for_arm_simd_t const*)a + i));
+        vst1_f16((simsimd_f16_for_arm_simd_t*)result + i, vcvt_f16_f32(vfmaq_f32(beta_vec, a_vec, alpha_vec)));
+    }
+    for (; i < n; ++i)
+        result[i] = SIMSIMD_COMPRESS_F16(alpha_f32 * SIMSIMD_UNCOMPRESS_F16(a[i]) + beta_f32);
+}
+
+SIMSIMD_PUBLIC void simsimd_scale_f32_to_f16_neon(simsimd_f32_t const* a, simsimd_size_t n, simsimd_distance_t alpha,
+                                                  simsimd_distance_t beta, simsimd_f16_t* result) {
+    simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha, beta_f32 = (simsimd_f32_t)beta;
+    float32x4_t alpha_vec = vdupq_n_f32(alpha_f32), beta_vec = vdupq_n_f32(beta_f32);
+    simsimd_size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        float32x4_t result_vec = vfmaq_f32(beta_vec, vld1q_f32(a + i), alpha_vec);
+        vst1_f16((simsimd_f16_for_arm_simd_t*)result + i, vcvt_f16_f32(result_vec));
+    }
+    for (; i < n; ++i)
+        result[i] = SIMSIMD_COMPRESS_F16(alpha_f32 * a[i] + beta_f32);
+}
+
+SIMSIMD_PUBLIC void simsimd_scale_f16_to_f32_neon(simsimd_f16_t const* a, simsimd_size_t n, simsimd_distance_t alpha,
+                                                  simsimd_distance_t beta, simsimd_f32_t* result) {
+    simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha, beta_f32 = (simsimd_f32_t)beta;
+    float32x4_t alpha_vec = vdupq_n_f32(alpha_f32), beta_vec = vdupq_n_f32(beta_f32);
+    simsimd_size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        float32x4_t a_vec = vcvt_f32_f16(vld1_f16((simsimd_f16_for_arm_simd_t const*)a + i));
+        vst1q_f32(result + i, vfmaq_f32(beta_vec, a_vec, alpha_vec));
+    }
+    for (; i < n; ++i)
+        result[i] = alpha_f32 * SIMSIMD_UNCOMPRESS_F16(a[i]) + beta_f32;
+}
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_NEON_F16
+#endif // SIMSIMD_TARGET_ARM
+
+#if SIMSIMD_TARGET_X86
+#if SIMSIMD_TARGET_HASWELL
+#pragma GCC push_options
+#pragma GCC target("avx2", "f16c", "fma")
+#pragma clang attribute push(__attribute__((target("avx2,f16c,fma"))), apply_to = function)
+
+SIMSIMD_PUBLIC void simsimd_wsum_f64_haswell(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n,
+                                             simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f64_t* result) {
+    __m256d alpha_vec = _mm256_set1_pd(alpha), beta_vec = _mm256_set1_pd(beta);
+    simsimd_size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d a_vec = _mm256_loadu_pd(a + i);
+        __m256d b_vec = _mm256_loadu_pd(b + i);
+        _mm256_storeu_pd(result + i, _mm256_fmadd_pd(a_vec, alpha_vec, _mm256_mul_pd(b_vec, beta_vec)));
+    }
+    for (; i < n; ++i)
+        result[i] = alpha * a[i] + beta * b[i];
+}
+
+SIMSIMD_PUBLIC void simsimd_fma_f64_haswell(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_f64_t const* c,
+                                            simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta,
+                                            simsimd_f64_t* result) {
+    __m256d alpha_vec = _mm256_set1_pd(alpha), beta_vec = _mm256_set1_pd(beta);
+    simsimd_size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d ab_vec = _mm256_mul_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i));
+        __m256d c_vec = _mm256_loadu_pd(c + i);
+        _mm256_storeu_pd(result + i, _mm256_fmadd_pd(ab_vec, alpha_vec, _mm256_mul_pd(c_vec, beta_vec)));
+    }
+    for (; i < n; ++i)
+        result[i] = alpha * a[i] * b[i] + beta * c[i];
+}
+
+SIMSIMD_PUBLIC void simsimd_scale_f64_haswell(simsimd_f64_t const* a, simsimd_size_t n, simsimd_distance_t alpha,
+                                              simsimd_distance_t beta, simsimd_f64_t* result) {
+    __m256d alpha_vec = _mm256_set1_pd(alpha), beta_vec = _mm256_set1_pd(beta);
+    simsimd_size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+        _mm256_storeu_pd(result + i, _mm256_fmadd_pd(_mm256_loadu_pd(a + i), alpha_vec, beta_vec));
+    for (; i < n; ++i)
+        result[i] = alpha * a[i] + beta;
+}
+
+SIMSIMD_PUBLIC void simsimd_wsum_f32_haswell(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n,
+                                             simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f32_t* result) {
+    simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha, beta_f32 = (simsimd_f32_t)beta;
+    __m256 alpha_vec = _mm256_set1_ps(alpha_f32), beta_vec = _mm256_set1_ps(beta_f32);
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 a_vec = _mm256_loadu_ps(a + i);
+        __m256 b_vec = _mm256_loadu_ps(b + i);
+        _mm256_storeu_ps(result + i, _mm256_fmadd_ps(a_vec, alpha_vec, _mm256_mul_ps(b_vec, beta_vec)));
+    }
+    for (; i < n; ++i)
+        result[i] = alpha_f32 * a[i] + beta_f32 * b[i];
+}
+
+SIMSIMD_PUBLIC void simsimd_fma_f32_haswell(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_f32_t const* c,
+                                            simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta,
+                                            simsimd_f32_t* result) {
+    simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha, beta_f32 = (simsimd_f32_t)beta;
+    __m256 alpha_vec = _mm256_set1_ps(alpha_f32), beta_vec = _mm256_set1_ps(beta_f32);
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 ab_vec = _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i));
+        __m256 c_vec = _mm256_loadu_ps(c + i);
+        _mm256_storeu_ps(result + i, _mm256_fmadd_ps(ab_vec, alpha_vec, _mm256_mul_ps(c_vec, beta_vec)));
+    }
+    for (; i < n; ++i)
+        result[i] = alpha_f32 * a[i] * b[i] + beta_f32 * c[i];
+}
+
+SIMSIMD_PUBLIC void simsimd_scale_f32_haswell(simsimd_f32_t const* a, simsimd_size_t n, simsimd_distance_t alpha,
+                                              simsimd_distance_t beta, simsimd_f32_t* result) {
+    simsimd_f32_t alpha_f32 = (simsimd_f32_t)alpha, beta_f32 = (simsimd_f32_t)beta;
+    __m256 alpha_vec = _mm256_set1_ps(alpha_f32), beta_vec = _mm256_set1_ps(beta_f32);
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+        _mm256_storeu_ps(result + i, _mm256_fmadd_ps(_mm256_loadu_ps(a + i), alpha_vec, beta_vec));
+    for (; i < n; ++i)
+        result[i] = alpha_f32 * a[i] + beta_f32;
+}
+
+/*  The `f16`, `bf16`, and `i8` variants below share the same structure: upcast eight scalars at a time to `f32`,
+ *  compute, and downcast back. In case the software emulation for `f16` scalars is enabled, the serial
+ *  conversions are extremely slow, so even for the tails, we copy the scalars into padded vectors.
+ */
+SIMSIMD_INTERNAL __m256 simsimd_f16x8_to_f32x8_haswell(__m128i x) { return _mm256_cvtph_ps(x); }
+SIMSIMD_INTERNAL __m128i simsimd_f32x8_to_f16x8_haswell(__m256 x) {
+    return _mm256_cvtps_ph(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+}
+SIMSIMD_INTERNAL __m256 simsimd_bf16x8_to_f32x8_haswell(__m128i x) {
+    return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(x), 16));
+}
+SIMSIMD_INTERNAL __m128i simsimd_f32x8_to_bf16x8_haswell(__m256 x) {
+    // Truncate the mantissa, just like `simsimd_compress_bf16`, and pack the upper halves of each word
+    __m256i x_i32 = _mm256_srli_epi32(_mm256_castps_si256(x), 16);
+    return _mm_packus_epi32(_mm256_castsi256_si128(x_i32), _mm256_extracti128_si256(x_i32, 1));
+}
+SIMSIMD_INTERNAL __m256 simsimd_i8x8_to_f32x8_haswell(__m128i x) {
+    return _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(x));
+}
+SIMSIMD_INTERNAL __m128i simsimd_f32x8_to_i8x8_haswell(__m256 x) {
+    // Mirror `simsimd_saturate_i8` exactly: clamp, add a half with the sign of `x`, and truncate,
+    // as `cvtps` would round half to even, disagreeing with the serial kernels on ties
+    x = _mm256_min_ps(_mm256_max_ps(x, _mm256_set1_ps(-128.f)), _mm256_set1_ps(127.f));
+    __m256 half = _mm256_or_ps(_mm256_and_ps(x, _mm256_set1_ps(-0.f)), _mm256_set1_ps(0.5f));
+    __m256i x_i32 = _mm256_cvttps_epi32(_mm256_add_ps(x, half));
+    __m128i x_i16 = _mm_packs_epi32(_mm256_castsi256_si128(x_i32), _mm256_extracti128_si256(x_i32, 1));
+    return _mm_packs_epi16(x_i16, x_i16);
+}
+
+#define SIMSIMD_MAKE_ELEMENTWISE_HASWELL(input_type, load_vec, store_vec)                                              \
+    SIMSIMD_PUBLIC void simsimd_wsum_##input_type##_haswell(                                                           \
+        simsimd_##input_type##_t const* a, simsimd_##input_type##_t const* b, simsimd_size_t n,                        \
+        simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_##input_type##_t* result) {                         \
+        __m256 alpha_vec = _mm256_set1_ps((simsimd_f32_t)alpha), beta_vec = _mm256_set1_ps((simsimd_f32_t)beta);       \
+        union {                                                                                                        \
+            __m128i vec;                                                                                               \
+            simsimd_##input_type##_t scalars[8];                                                                       \
+        } a_tail, b_tail, result_tail;                                                                                 \
+        for (simsimd_size_t i = 0; i < n; i += 8) {                                                                    \
+            simsimd_size_t count = n - i < 8 ? n - i : 8, j = 0;                                                       \
+            if (count == 8)                                                                                            \
+                a_tail.vec = load_vec((__m128i const*)(a + i)), b_tail.vec = load_vec((__m128i const*)(b + i));        \
+            else {                                                                                                     \
+                a_tail.vec = b_tail.vec = _mm_setzero_si128();                                                         \
+                for (; j != count; ++j)                                                                                \
+                    a_tail.scalars[j] = a[i + j], b_tail.scalars[j] = b[i + j];                                        \
+            }                                                                                                          \
+            __m256 a_vec = simsimd_##input_type##x8_to_f32x8_haswell(a_tail.vec);                                      \
+            __m256 b_vec = simsimd_##input_type##x8_to_f32x8_haswell(b_tail.vec);                                      \
+            __m256 sum_vec = _mm256_add_ps(_mm256_mul_ps(a_vec, alpha_vec), _mm256_mul_ps(b_vec, beta_vec));           \
+            result_tail.vec = simsimd_f32x8_to_##input_type##x8_haswell(sum_vec);                                      \
+            if (count == 8)                                                                                            \
+                store_vec((__m128i*)(result + i), result_tail.vec);                                                    \
+            else                                                                                                       \
+                for (j = 0; j != count; ++j)                                                                           \
+                    result[i + j] = result_tail.scalars[j];                                                            \
+        }                                                                                                              \
+    }                                                                                                                  \
+    SIMSIMD_PUBLIC void simsimd_fma_##input_type##_haswell(                                                            \
+        simsimd_##input_type##_t const* a, simsimd_##input_type##_t const* b, simsimd_##input_type##_t const* c,       \
+        simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_##input_type##_t* result) {       \
+        __m256 alpha_vec = _mm256_set1_ps((simsimd_f32_t)alpha), beta_vec = _mm256_set1_ps((simsimd_f32_t)beta);       \
+        union {                                                                                                        \
+            __m128i vec;                                                                                               \
+            simsimd_##input_type##_t scalars[8];                                                                       \
+        } a_tail, b_tail, c_tail, result_tail;                                                                         \
+        for (simsimd_size_t i = 0; i < n; i += 8) {                                                                    \
+            simsimd_size_t count = n - i < 8 ? n - i : 8, j = 0;                                                       \
+            if (count == 8)                                                                                            \
+                a_tail.vec = load_vec((__m128i const*)(a + i)), b_tail.vec = load_vec((__m128i const*)(b + i)),        \
+                c_tail.vec = load_vec((__m128i const*)(c + i));                                                        \
+            else {                                                                                                     \
+                a_tail.vec = b_tail.vec = c_tail.vec = _mm_setzero_si128();                                            \
+                for (; j != count; ++j)                                                                                \
+                    a_tail.scalars[j] = a[i + j], b_tail.scalars[j] = b[i + j], c_tail.scalars[j] = c[i + j];          \
+            }                                                                                                          \
+            __m256 a_vec = simsimd_##input_type##x8_to_f32x8_haswell(a_tail.vec);                                      \
+            __m256 b_vec = simsimd_##input_type##x8_to_f32x8_haswell(b_tail.vec);                                      \
+            __m256 c_vec = simsimd_##input_type##x8_to_f32x8_haswell(c_tail.vec);                                      \
+            __m256 alpha_ab_vec = _mm256_mul_ps(_mm256_mul_ps(alpha_vec, a_vec), b_vec);                               \
+            __m256 sum_vec = _mm256_add_ps(alpha_ab_vec, _mm256_mul_ps(beta_vec, c_vec));                              \
+            result_tail.vec = simsimd_f32x8_to_##input_type##x8_haswell(sum_vec);                                      \
+            if (count == 8)                                                                                            \
+                store_vec((__m128i*)(result + i), result_tail.vec);                                                    \
+            else                                                                                                       \
+                for (j = 0; j != count; ++j)                                                                           \
+                    result[i + j] = result_tail.scalars[j];                                                            \
+        }                                                                                                              \
+    }                                                                                                                  \
+    SIMSIMD_PUBLIC void simsimd_scale_##input_type##_haswell(simsimd_##input_type##_t const* a, simsimd_size_t n,      \
+                                                             simsimd_distance_t alpha, simsimd_distance_t beta,        \
+                                                             simsimd_##input_type##_t* result) {                       \
+        __m256 alpha_vec = _mm256_set1_ps((simsimd_f32_t)alpha), beta_vec = _mm256_set1_ps((simsimd_f32_t)beta);       \
+        union {                                                                                                        \
+            __m128i vec;                                                                                               \
+            simsimd_##input_type##_t scalars[8];                                                                       \
+        } a_tail, result_tail;                                                                                         \
+        for (simsimd_size_t i = 0; i < n; i += 8) {                                                                    \
+            simsimd_size_t count = n - i < 8 ? n - i : 8, j = 0;                                                       \
+            if (count == 8)                                                                                            \
+                a_tail.vec = load_vec((__m128i const*)(a + i));                                                        \
+            else {                                                                                                     \
+                a_tail.vec = _mm_setzero_si128();                                                                      \
+                for (; j != count; ++j)                                                                                \
+                    a_tail.scalars[j] = a[i + j];                                                                      \
+            }                                                                                                          \
+            __m256 a_vec = simsimd_##input_type##x8_to_f32x8_haswell(a_tail.vec);                                      \
+            __m256 sum_vec = _mm256_add_ps(_mm256_mul_ps(a_vec, alpha_vec), beta_vec);                                 \
+            result_tail.vec = simsimd_f32x8_to_##input_type##x8_haswell(sum_vec);                                      \
+            if (count == 8)                                                                                            \
+                store_vec((__m128i*)(result + i), result_tail.vec);                                                    \
+            else                                                                                                       \
+                for (j = 0; j != count; ++j)                                                                           \
+                    result[i + j] = result_tail.scalars[j];                                                            \
+        }                                                                                                              \
+    }
+
+SIMSIMD_MAKE_ELEMENTWISE_HASWELL(f16, _mm_loadu_si128, _mm_storeu_si128)  // simsimd_{wsum,fma,scale}_f16_haswell
+SIMSIMD_MAKE_ELEMENTWISE_HASWELL(bf16, _mm_loadu_si128, _mm_storeu_si128) // simsimd_{wsum,fma,scale}_bf16_haswell
+SIMSIMD_MAKE_ELEMENTWISE_HASWELL(i8, _mm_loadl_epi64, _mm_storel_epi64)   // simsimd_{wsum,fma,scale}_i8_haswell
+
+/*  Mixed-type scaling kernels, that either upcast a narrow type into `f32` or downcast `f32` into a narrow type.
+ *  The tails are handled the same way as above, passing through padded vectors.
+ */
+#define SIMSIMD_MAKE_SCALE_FROM_F32_HASWELL(output_type, store_vec)                                                    \
+    SIMSIMD_PUBLIC void simsimd_scale_f32_to_##output_type##_haswell(                                                  \
+        simsimd_f32_t const* a, simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta,                   \
+        simsimd_##output_type##_t* result) {                                                                           \
+        __m256 alpha_vec = _mm256_set1_ps((simsimd_f32_t)alpha), beta_vec = _mm256_set1_ps((simsimd_f32_t)beta);       \
+        union {                                                                                                        \
+            __m256 vec;                                                                                                \
+            simsimd_f32_t scalars[8];                                                                                  \
+        } a_tail;                                                                                                      \
+        union {                                                                                                        \
+            __m128i vec;                                                                                               \
+            simsimd_##output_type##_t scalars[8];                                                                      \
+        } result_tail;                                                                                                 \
+        for (simsimd_size_t i = 0; i < n; i += 8) {                                                                    \
+            simsimd_size_t count = n - i < 8 ? n - i : 8, j = 0;                                                       \
+            if (count == 8)                                                                                            \
+                a_tail.vec = _mm256_loadu_ps(a + i);                                                                   \
+            else {                                                                                                     \
+                a_tail.vec = _mm256_setzero_ps();                                                                      \
+                for (; j != count; ++j)                                                                                \
+                    a_tail.scalars[j] = a[i + j];                                                                      \
+            }                                                                                                          \
+            __m256 result_vec = _mm256_add_ps(_mm256_mul_ps(a_tail.vec, alpha_vec), beta_vec);                         \
+            result_tail.vec = simsimd_f32x8_to_##output_type##x8_haswell(result_vec);                                  \
+            if (count == 8)                                                                                            \
+                store_vec((__m128i*)(result + i), result_tail.vec);                                                    \
+            else                                                                                                       \
+                for (j = 0; j != count; ++j)                                                                           \
+                    result[i + j] = result_tail.scalars[j];                                                            \
+        }                                                                                                              \
+    }
+
+#define SIMSIMD_MAKE_SCALE_TO_F32_HASWELL(input_type, load_vec)                                                        \
+    SIMSIMD_PUBLIC void simsimd_scale_##input_type##_to_f32_haswell(simsimd_##input_type##_t const* a,                 \
+                                                                    simsimd_size_t n, simsimd_distance_t alpha,        \
+                                                                    simsimd_distance_t beta, simsimd_f32_t* result) {  \
+        __m256 alpha_vec = _mm256_set1_ps((simsimd_f32_t)alpha), beta_vec = _mm256_set1_ps((simsimd_f32_t)beta);       \
+        union {                                                                                                        \
+            __m128i vec;                                                                                               \
+            simsimd_##input_type##_t scalars[8];                                                                       \
+        } a_tail;                                                                                                      \
+        union {                                                                                                        \
+            __m256 vec;                                                                                                \
+            simsimd_f32_t scalars[8];                                                                                  \
+        } result_tail;                                                                                                 \
+        for (simsimd_size_t i = 0; i < n; i += 8) {                                                                    \
+            simsimd_size_t count = n - i < 8 ? n - i : 8, j = 0;                                                       \
+            if (count == 8)                                                                                            \
+                a_tail.vec = load_vec((__m128i const*)(a + i));                                                        \
+            else {                                                                                                     \
+                a_tail.vec = _mm_setzero_si128();                                                                      \
+                for (; j != count; ++j)                                                                                \
+                    a_tail.scalars[j] = a[i + j];                                                                      \
+            }                                                                                                          \
+            __m256 a_vec = simsimd_##input_type##x8_to_f32x8_haswell(a_tail.vec);                                      \
+            result_tail.vec = _mm256_fmadd_ps(a_vec, alpha_vec, beta_vec);                                             \
+            if (count == 8)                                                                                            \
+                _mm256_storeu_ps(result + i, result_tail.vec);                                                         \
+            else                                                                                                       \
+                for (j = 0; j != count; ++j)                                                                           \
+                    result[i + j] = result_tail.scalars[j];                                                            \
+        }                                                                                                              \
+    }
+
+SIMSIMD_MAKE_SCALE_FROM_F32_HASWELL(f16, _mm_storeu_si128)  // simsimd_scale_f32_to_f16_haswell
+SIMSIMD_MAKE_SCALE_FROM_F32_HASWELL(bf16, _mm_storeu_si128) // simsimd_scale_f32_to_bf16_haswell
+SIMSIMD_MAKE_SCALE_TO_F32_HASWELL(f16, _mm_loadu_si128)     // simsimd_scale_f16_to_f32_haswell
+SIMSIMD_MAKE_SCALE_TO_F32_HASWELL(bf16, _mm_loadu_si128)    // simsimd_scale_bf16_to_f32_haswell
+SIMSIMD_MAKE_SCALE_FROM_F32_HASWELL(i8, _mm_storel_epi64)   // simsimd_scale_f32_to_i8_haswell
+SIMSIMD_MAKE_SCALE_TO_F32_HASWELL(i8, _mm_loadl_epi64)      // simsimd_scale_i8_to_f32_haswell
+
+SIMSIMD_PUBLIC void simsimd_affine_f32_to_i8_haswell(simsimd_f32_t const* a, simsimd_size_t n,
+                                                     simsimd_f32_t const* alphas, simsimd_f32_t const* betas,
+                                                     simsimd_i8_t* result) {
+    // Bound both loops by the same `head`, so the compiler can prove the tail has fewer than 8 iterations
+    simsimd_size_t const head = n - n % 8;
+    simsimd_size_t i = 0;
+    for (; i != head; i += 8) {
+        __m256 alphas_vec = _mm256_loadu_ps(alphas + i), betas_vec = _mm256_loadu_ps(betas + i);
+        __m256 result_vec = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(a + i), alphas_vec), betas_vec);
+        _mm_storel_epi64((__m128i*)(result + i), simsimd_f32x8_to_i8x8_haswell(result_vec));
+    }
+    for (; i != n; ++i)
+        result[i] = simsimd_saturate_i8(alphas[i] * a[i] + betas[i]);
+}
+
+SIMSIMD_PUBLIC void simsimd_affine_i8_to_f32_haswell(simsimd_i8_t const* a, simsimd_size_t n,
+                                                     simsimd_f32_t const* alphas, simsimd_f32_t const* betas,
+                                                     simsimd_f32_t* result) {
+    simsimd_size_t const head = n - n % 8;
+    simsimd_size_t i = 0;
+    for (; i != head; i += 8) {
+        __m256 alphas_vec = _mm256_loadu_ps(alphas + i), betas_vec = _mm256_loadu_ps(betas + i);
+        __m256 a_vec = simsimd_i8x8_to_f32x8_haswell(_mm_loadl_epi64((__m128i const*)(a + i)));
+        _mm256_storeu_ps(result + i, _mm256_fmadd_ps(a_vec, alphas_vec, betas_vec));
+    }
+    for (; i != n; ++i)
+        result[i] = alphas[i] * a[i] + betas[i];
+}
+
+SIMSIMD_PUBLIC void simsimd_normalize_f32_haswell(simsimd_f32_t const* a, simsimd_size_t count, simsimd_size_t n,
+                                                  simsimd_f32_t* result) {
+    simsimd_size_t const head = n - n % 8;
+    for (simsimd_size_t row = 0; row != count; ++row, a += n, result += n) {
+        __m256 norm_squared_vec = _mm256_setzero_ps();
+        simsimd_size_t i = 0;
+        for (; i != head; i += 8) {
+            __m256 a_vec = _mm256_loadu_ps(a + i);
+            norm_squared_vec = _mm256_fmadd_ps(a_vec, a_vec, norm_squared_vec);
+        }
+        __m128 sum_vec = _mm_add_ps(_mm256_castps256_ps128(norm_squared_vec),
+                                    _mm256_extractf128_ps(norm_squared_vec, 1));
+        sum_vec = _mm_hadd_ps(sum_vec, sum_vec);
+        simsimd_f32_t norm_squared = _mm_cvtss_f32(_mm_hadd_ps(sum_vec, sum_vec));
+        for (; i != n; ++i)
+            norm_squared += a[i] * a[i];
+        simsimd_f32_t normalizer = simsimd_normalizer_f32(norm_squared);
+        __m256 normalizer_vec = _mm256_set1_ps(normalizer);
+        for (i = 0; i != head; i += 8)
+            _mm256_storeu_ps(result + i, _mm256_mul_ps(_mm256_loadu_ps(a + i), normalizer_vec));
+        for (; i != n; ++i)
+            result[i] = a[i] * normalizer;
+    }
+}
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_HASWELL
+
+#if SIMSIMD_TARGET_SKYLAKE
+#pragma GCC push_options
+#pragma GCC target("avx512f", "avx512vl", "avx512bw", "bmi2")
+#pragma clang attribute push(__attribute__((target("avx512f,avx512vl,avx512bw,bmi2"))), apply_to = function)
+
+SIMSIMD_PUBLIC void simsimd_wsum_f64_skylake(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n,
+                                             simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f64_t* result) {
+    __m512d alpha_vec = _mm512_set1_pd(alpha), beta_vec = _mm512_set1_pd(beta);
+    __mmask8 mask = 0xFF;
+    __m512d a_vec, b_vec;
+
+simsimd_wsum_f64_skylake_cycle:
+    if (n < 8) {
+        mask = (__mmask8)_bzhi_u32(0xFFFFFFFF, n);
+        a_vec = _mm512_maskz_loadu_pd(mask, a);
+        b_vec = _mm512_maskz_loadu_pd(mask, b);
+        n = 0;
+    } else {
+        a_vec = _mm512_loadu_pd(a);
+        b_vec = _mm512_loadu_pd(b);
+        n -= 8;
+    }
+    _mm512_mask_storeu_pd(result, mask, _mm512_fmadd_pd(a_vec, alpha_vec, _mm512_mul_pd(b_vec, beta_vec)));
+    a += 8, b += 8, result += 8;
+    if (n)
+        goto simsimd_wsum_f64_skylake_cycle;
+}
+
+SIMSIMD_PUBLIC void simsimd_fma_f64_skylake(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_f64_t const* c,
+                                            simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta,
+                                            simsimd_f64_t* result) {
+    __m512d alpha_vec = _mm512_set1_pd(alpha), beta_vec = _mm512_set1_pd(beta);
+    __mmask8 mask = 0xFF;
+    __m512d a_vec, b_vec, c_vec;
+
+simsimd_fma_f64_skylake_cycle:
+    if (n < 8) {
+        mask = (__mmask8)_bzhi_u32(0xFFFFFFFF, n);
+        a_vec = _mm512_maskz_loadu_pd(mask, a);
+        b_vec = _mm512_maskz_loadu_pd(mask, b);
+        c_vec = _mm512_maskz_loadu_pd(mask, c);
+        n = 0;
+    } else {
+        a_vec = _mm512_loadu_pd(a);
+        b_vec = _mm512_loadu_pd(b);
+        c_vec = _mm512_loadu_pd(c);
+        n -= 8;
+    }
+    __m512d ab_vec = _mm512_mul_pd(a_vec, b_vec);
+    _mm512_mask_storeu_pd(result, mask, _mm512_fmadd_pd(ab_vec, alpha_vec, _mm512_mul_pd(c_vec, beta_vec)));
+    a += 8, b += 8, c += 8, result += 8;
+    if (n)
+        goto simsimd_fma_f64_skylake_cycle;
+}
+
+SIMSIMD_PUBLIC void simsimd_scale_f64_skylake(simsimd_f64_t const* a, simsimd_size_t n, simsimd_distance_t alpha,
+                                              simsimd_distance_t beta, simsimd_f64_t* result) {
+    __m512d alpha_vec = _mm512_set1_pd(alpha), beta_vec = _mm512_set1_pd(beta);
+    __mmask8 mask = 0xFF;
+    __m512d a_vec;
+
+simsimd_scale_f64_skylake_cycle:
+    if (n < 8) {
+        mask = (__mmask8)_bzhi_u32(0xFFFFFFFF, n);
+        a_vec = _mm512_maskz_loadu_pd(mask, a);
+        n = 0;
+    } else {
+        a_vec = _mm512_loadu_pd(a);
+        n -= 8;
+    }
+    _mm512_mask_storeu_pd(result, mask, _mm512_fmadd_pd(a_vec, alpha_vec, beta_vec));
+    a += 8, result += 8;
+    if (n)
+        goto simsimd_scale_f64_skylake_cycle;
+}
+
+SIMSIMD_PUBLIC void simsimd_wsum_f32_skylake(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n,
+                                             simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f32_t* result) {
+    __m512 alpha_vec = _mm512_set1_ps((simsimd_f32_t)alpha), beta_vec = _mm512_set1_ps((simsimd_f32_t)beta);
+    __mmask16 mask = 0xFFFF;
+    __m512 a_vec, b_vec;
+
+simsimd_wsum_f32_skylake_cycle:
+    if (n < 16) {
+        mask = (__mmask16)_bzhi_u32(0xFFFFFFFF, n);
+        a_vec = _mm512_maskz_loadu_ps(mask, a);
+        b_vec = _mm512_maskz_loadu_ps(mask, b);
+        n = 0;
+    } else {
+        a_vec = _mm512_loadu_ps(a);
+        b_vec = _mm512_loadu_ps(b);
+        n -= 16;
+    }
+    _mm512_mask_storeu_ps(result, mask, _mm512_fmadd_ps(a_vec, alpha_vec, _mm512_mul_ps(b_vec, beta_vec)));
+    a += 16, b += 16, result += 16;
+    if (n)
+        goto simsimd_wsum_f32_skylake_cycle;
+}
+
+SIMSIMD_PUBLIC void simsimd_fma_f32_skylake(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_f32_t const* c,
+                                            simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta,
+                                            simsimd_f32_t* result) {
+    __m512 alpha_vec = _mm512_set1_ps((simsimd_f32_t)alpha), beta_vec = _mm512_set1_ps((simsimd_f32_t)beta);
+    __mmask16 mask = 0xFFFF;
+    __m512 a_vec, b_vec, c_vec;
+
+simsimd_fma_f32_skylake_cycle:
+    if (n < 16) {
+        mask = (__mmask16)_bzhi_u32(0xFFFFFFFF, n);
+        a_vec = _mm512_maskz_loadu_ps(mask, a);
+        b_vec = _mm512_maskz_loadu_ps(mask, b);
+        c_vec = _mm512_maskz_loadu_ps(mask, c);
+        n = 0;
+    } else {
+        a_vec = _mm512_loadu_ps(a);
+        b_vec = _mm512_loadu_ps(b);
+        c_vec = _mm512_loadu_ps(c);
+        n -= 16;
+    }
+    __m512 ab_vec = _mm512_mul_ps(a_vec, b_vec);
+    _mm512_mask_storeu_ps(result, mask, _mm512_fmadd_ps(ab_vec, alpha_vec, _mm512_mul_ps(c_vec, beta_vec)));
+    a += 16, b += 16, c += 16, result += 16;
+    if (n)
+        goto simsimd_fma_f32_skylake_cycle;
+}
+
+SIMSIMD_PUBLIC void simsimd_scale_f32_skylake(simsimd_f32_t const* a, simsimd_size_t n, simsimd_distance_t alpha,
+                                              simsimd_distance_t beta, simsimd_f32_t* result) {
+    __m512 alpha_vec = _mm512_set1_ps((simsimd_f32_t)alpha), beta_vec = _mm512_set1_ps((simsimd_f32_t)beta);
+    __mmask16 mask = 0xFFFF;
+    __m512 a_vec;
+
+simsimd_scale_f32_skylake_cycle:
+    if (n < 16) {
+        mask = (__mmask16)_bzhi_u32(0xFFFFFFFF, n);
+        a_vec = _mm512_maskz_loadu_ps(mask, a);
+        n = 0;
+    } else {
+        a_vec = _mm512_loadu_ps(a);
+        n -= 16;
+    }
+    _mm512_mask_storeu_ps(result, mask, _mm512_fmadd_ps(a_vec, alpha_vec, beta_vec));
+    a += 16, result += 16;
+    if (n)
+        goto simsimd_scale_f32_skylake_cycle;
+}
+
+/*  The `f16`, `bf16`, and `i8` variants upcast sixteen scalars at a time to `f32`, like the Haswell kernels,
+ *  but load and store the tails with the same masked instructions, instead of passing through padded vectors.
+ */
+SIMSIMD_INTERNAL __m512 simsimd_f16x16_to_f32x16_skylake(__m256i x) { return _mm512_cvtph_ps(x); }
+SIMSIMD_INTERNAL __m256i simsimd_f32x16_to_f16x16_skylake(__m512 x) {
+    return _mm512_cvtps_ph(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+}
+SIMSIMD_INTERNAL __m512 simsimd_bf16x16_to_f32x16_skylake(__m256i x) {
+    return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(x), 16));
+}
+SIMSIMD_INTERNAL __m256i simsimd_f32x16_to_bf16x16_skylake(__m512 x) {
+    // Truncate the mantissa, just like `simsimd_compress_bf16`, and keep the upper halves of each word
+    return _mm512_cvtepi32_epi16(_mm512_srli_epi32(_mm512_castps_si512(x), 16));
+}
+SIMSIMD_INTERNAL __m512 simsimd_i8x16_to_f32x16_skylake(__m128i x) {
+    return _mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(x));
+}
+SIMSIMD_INTERNAL __m128i simsimd_f32x16_to_i8x16_skylake(__m512 x) {
+    // Mirror `simsimd_saturate_i8` exactly, like `simsimd_f32x8_to_i8x8_haswell`,
+    // composing the signed half with integer operations, as floating-point logic needs AVX-512DQ
+    x = _mm512_min_ps(_mm512_max_ps(x, _mm512_set1_ps(-128.f)), _mm512_set1_ps(127.f));
+    __m512i sign = _mm512_and_si512(_mm512_castps_si512(x), _mm512_set1_epi32((int)0x80000000u));
+    __m512 half = _mm512_castsi512_ps(_mm512_or_si512(sign, _mm512_set1_epi32(0x3F000000)));
+    return _mm512_cvtsepi32_epi8(_mm512_cvttps_epi32(_mm512_add_ps(x, half)));
+}
+
+#define SIMSIMD_MAKE_ELEMENTWISE_SKYLAKE(input_type, load_vec, store_vec)                                              \
+    SIMSIMD_PUBLIC void simsimd_wsum_##input_type##_skylake(                                                           \
+        simsimd_##input_type##_t const* a, simsimd_##input_type##_t const* b, simsimd_size_t n,                        \
+        simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_##input_type##_t* result) {                         \
+        __m512 alpha_vec = _mm512_set1_ps((simsimd_f32_t)alpha), beta_vec = _mm512_set1_ps((simsimd_f32_t)beta);       \
+        for (simsimd_size_t i = 0; i < n; i += 16) {                                                                   \
+            __mmask16 mask = (__mmask16)_bzhi_u32(0xFFFFFFFF, n - i < 16 ? (unsigned)(n - i) : 16);                    \
+            __m512 a_vec = simsimd_##input_type##x16_to_f32x16_skylake(load_vec(mask, a + i));                         \
+            __m512 b_vec = simsimd_##input_type##x16_to_f32x16_skylake(load_vec(mask, b + i));                         \
+            __m512 sum_vec = _mm512_add_ps(_mm512_mul_ps(a_vec, alpha_vec), _mm512_mul_ps(b_vec, beta_vec));           \
+            store_vec(result + i, mask, simsimd_f32x16_to_##input_type##x16_skylake(sum_vec));                         \
+        }                                                                                                              \
+    }                                                                                                                  \
+    SIMSIMD_PUBLIC void simsimd_fma_##input_type##_skylake(                                                            \
+        simsimd_##input_type##_t const* a, simsimd_##input_type##_t const* b, simsimd_##input_type##_t const* c,       \
+        simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_##input_type##_t* result) {       \
+        __m512 alpha_vec = _mm512_set1_ps((simsimd_f32_t)alpha), beta_vec = _mm512_set1_ps((simsimd_f32_t)beta);       \
+        for (simsimd_size_t i = 0; i < n; i += 16) {                                                                   \
+            __mmask16 mask = (__mmask16)_bzhi_u32(0xFFFFFFFF, n - i < 16 ? (unsigned)(n - i) : 16);                    \
+            __m512 a_vec = simsimd_##input_type##x16_to_f32x16_skylake(load_vec(mask, a + i));                         \
+            __m512 b_vec = simsimd_##input_type##x16_to_f32x16_skylake(load_vec(mask, b + i));                         \
+            __m512 c_vec = simsimd_##input_type##x16_to_f32x16_skylake(load_vec(mask, c + i));                         \
+            __m512 alpha_ab_vec = _mm512_mul_ps(_mm512_mul_ps(alpha_vec, a_vec), b_vec);                               \
+            __m512 sum_vec = _mm512_add_ps(alpha_ab_vec, _mm512_mul_ps(beta_vec, c_vec));                              \
+            store_vec(result + i, mask, simsimd_f32x16_to_##input_type##x16_skylake(sum_vec));                         \
+        }                                                                                                              \
+    }                                                                                                                  \
+    SIMSIMD_PUBLIC void simsimd_scale_##input_type##_skylake(simsimd_##input_type##_t const* a, simsimd_size_t n,      \
+                                                             simsimd_distance_t alpha, simsimd_distance_t beta,        \
+                                                             simsimd_##input_type##_t* result) {                       \
+        __m512 alpha_vec = _mm512_set1_ps((simsimd_f32_t)alpha), beta_vec = _mm512_set1_ps((simsimd_f32_t)beta);       \
+        for (simsimd_size_t i = 0; i < n; i += 16) {                                                                   \
+            __mmask16 mask = (__mmask16)_bzhi_u32(0xFFFFFFFF, n - i < 16 ? (unsigned)(n - i) : 16);                    \
+            __m512 a_vec = simsimd_##input_type##x16_to_f32x16_skylake(load_vec(mask, a + i));                         \
+            __m512 result_vec = _mm512_add_ps(_mm512_mul_ps(a_vec, alpha_vec), beta_vec);                              \
+            store_vec(result + i, mask, simsimd_f32x16_to_##input_type##x16_skylake(result_vec));                      \
+        }                                                                                                              \
+    }
+
+SIMSIMD_MAKE_ELEMENTWISE_SKYLAKE(f16, _mm256_maskz_loadu_epi16, _mm256_mask_storeu_epi16)  // simsimd_*_f16_skylake
+SIMSIMD_MAKE_ELEMENTWISE_SKYLAKE(bf16, _mm256_maskz_loadu_epi16, _mm256_mask_storeu_epi16) // simsimd_*_bf16_skylake
+SIMSIMD_MAKE_ELEMENTWISE_SKYLAKE(i8, _mm_maskz_loadu_epi8, _mm_mask_storeu_epi8)           // simsimd_*_i8_skylake
+
+SIMSIMD_PUBLIC void simsimd_normalize_f32_skylake(simsimd_f32_t const* a, simsimd_size_t count, simsimd_size_t n,
+                                                  simsimd_f32_t* result) {
+    for (simsimd_size_t row = 0; row != count; ++row, a += n, result += n) {
+        __m512 norm_squared_vec = _mm512_setzero_ps();
+        for (simsimd_size_t i = 0; i < n; i += 16) {
+            __mmask16 mask = (__mmask16)_bzhi_u32(0xFFFFFFFF, n - i < 16 ? (unsigned)(n - i) : 16);
+            __m512 a_vec = _mm512_maskz_loadu_ps(mask, a + i);
+            norm_squared_vec = _mm512_fmadd_ps(a_vec, a_vec, norm_squared_vec);
+        }
+        __m512 normalizer_vec = _mm512_set1_ps(simsimd_normalizer_f32(_mm512_reduce_add_ps(norm_squared_vec)));
+        for (simsimd_size_t i = 0; i < n; i += 16) {
+            __mmask16 mask = (__mmask16)_bzhi_u32(0xFFFFFFFF, n - i < 16 ? (unsigned)(n - i) : 16);
+            __m512 a_vec = _mm512_maskz_loadu_ps(mask, a + i);
+            _mm512_mask_storeu_ps(result + i, mask, _mm512_mul_ps(a_vec, normalizer_vec));
+        }
+    }
+}
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_SKYLAKE
+#endif // SIMSIMD_TARGET_X86
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,1393 @@
+/**
+ *  @file       index.h
+ *  @brief      Exact and Approximate Nearest Neighbors Search on top of SimSIMD kernels.
+ *  @date       October 17, 2026
+ *
+ *  Contains:
+ *  - Flat brute-force index with tombstone deletions and NUMA-local partitioned scans
+ *  - K-means clustering with full and mini-batch iterations
+ *  - Inverted file index with k-means coarse quantization
+ *  - Hierarchical Navigable Small World graph index with concurrent insertions
+ *
+ *  Unlike the rest of the library, those structures own memory, allocated with `malloc` and released with `free`.
+ *  That's why this header is not included from `simsimd.h`, and has to be included explicitly.
+ *  If compiled with OpenMP, batched searches are parallelized across queries, while k-means and graph
+ *  construction are parallelized across vectors.
+ */
+#ifndef SIMSIMD_INDEX_H
+#define SIMSIMD_INDEX_H
+
+#include "simsimd.h"
+
+#include <float.h>  // `DBL_MAX`
+#include <stdlib.h> // `malloc`, `free`
+#include <string.h> // `memcpy`, `memset`
+
+#if defined(_OPENMP)
+#include <omp.h> // `omp_get_max_threads`, `omp_get_thread_num`
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *  @brief  Alignment of every row in the index storage, matching the cache line and the widest SIMD register.
+ */
+#ifndef SIMSIMD_INDEX_ALIGNMENT
+#define SIMSIMD_INDEX_ALIGNMENT (64)
+#endif
+
+/**
+ *  @brief  Returns the size of a single scalar of the given datatype in bytes, or zero for unknown types.
+ *          Complex types are reported as the size of the real component.
+ */
+SIMSIMD_PUBLIC simsimd_size_t simsimd_datatype_bytes(simsimd_datatype_t datatype) {
+    switch (datatype) {
+    case simsimd_datatype_f64_k: return sizeof(simsimd_f64_t);
+    case simsimd_datatype_f32_k: return sizeof(simsimd_f32_t);
+    case simsimd_datatype_f16_k: return sizeof(simsimd_f16_t);
+    case simsimd_datatype_bf16_k: return sizeof(simsimd_bf16_t);
+    case simsimd_datatype_i8_k: return sizeof(simsimd_i8_t);
+    case simsimd_datatype_b8_k: return sizeof(simsimd_b8_t);
+    case simsimd_datatype_f64c_k: return sizeof(simsimd_f64_t);
+    case simsimd_datatype_f32c_k: return sizeof(simsimd_f32_t);
+    case simsimd_datatype_f16c_k: return sizeof(simsimd_f16_t);
+    case simsimd_datatype_bf16c_k: return sizeof(simsimd_bf16_t);
+    default: return 0;
+    }
+}
+
+/**
+ *  @brief  Allocates `bytes` of uninitialized memory aligned to `SIMSIMD_INDEX_ALIGNMENT`, to be released with
+ *          `simsimd_aligned_free`. The original pointer is kept right before the aligned block. Large blocks
+ *          aren't backed by physical pages until first written, so NUMA placement is decided by the writers.
+ */
+SIMSIMD_PUBLIC void* simsimd_aligned_alloc_uninitialized(simsimd_size_t bytes) {
+    simsimd_size_t const alignment = SIMSIMD_INDEX_ALIGNMENT;
+    char* raw = (char*)malloc(bytes + alignment + sizeof(void*));
+    if (!raw)
+        return 0;
+    simsimd_size_t address = (simsimd_size_t)(raw + sizeof(void*));
+    char* aligned = raw + sizeof(void*) + (alignment - address % alignment) % alignment;
+    ((void**)aligned)[-1] = raw;
+    return aligned;
+}
+
+/**
+ *  @brief  Allocates `bytes` of zeroed memory aligned to `SIMSIMD_INDEX_ALIGNMENT`.
+ */
+SIMSIMD_PUBLIC void* simsimd_aligned_alloc(simsimd_size_t bytes) {
+    void* aligned = simsimd_aligned_alloc_uninitialized(bytes);
+    if (aligned)
+        memset(aligned, 0, bytes);
+    return aligned;
+}
+
+SIMSIMD_PUBLIC void simsimd_aligned_free(void* aligned) {
+    if (aligned)
+        free(((void**)aligned)[-1]);
+}
+
+/**
+ *  @brief  Flat brute-force index, storing every vector in a row-major matrix and scanning all of them on search.
+ *          Rows are padded to `SIMSIMD_INDEX_ALIGNMENT` bytes, so that every row starts on a cache line.
+ *          Removed rows are marked in the `alive` bitmap and skipped 64 at a time, but never compacted.
+ */
+typedef struct simsimd_flat_index_t {
+    simsimd_metric_kind_t metric;   ///< Metric used to compare the vectors
+    simsimd_datatype_t datatype;    ///< Type of the scalars in every vector
+    simsimd_metric_punned_t kernel; ///< Best kernel for the `metric` and `datatype` on the current machine
+    simsimd_size_t dimensions;      ///< Number of scalars in every vector
+    simsimd_size_t stride;          ///< Number of bytes between the starts of consecutive rows
+    simsimd_size_t count;           ///< Number of rows ever added, including the removed ones
+    simsimd_size_t removed;         ///< Number of removed rows
+    simsimd_size_t capacity;        ///< Number of rows, that fit into the allocated storage
+    simsimd_b8_t* vectors;          ///< Aligned storage of `capacity` rows of `stride` bytes
+    simsimd_b8_t* alive;            ///< Bitmap of `capacity` bits, marking the rows, that were not removed
+} simsimd_flat_index_t;
+
+/**
+ *  @brief  Splits `capacity` rows into `threads` contiguous partitions of whole 64-row bitmap words, returning the
+ *          `[begin, end)` range of the given `thread`. The flat index storage is first touched with the same
+ *          partitioning, that `simsimd_flat_index_search_partitioned` scans with, so on NUMA systems with pinned
+ *          threads every thread reads the pages that were allocated on its own node.
+ */
+SIMSIMD_INTERNAL void simsimd_flat_index_partition(simsimd_size_t capacity, simsimd_size_t thread,
+                                                   simsimd_size_t threads, simsimd_size_t* begin,
+                                                   simsimd_size_t* end) {
+    simsimd_size_t const words = (capacity + 63) / 64;
+    *begin = words * thread / threads * 64;
+    *end = words * (thread + 1) / threads * 64;
+}
+
+/**
+ *  @brief  Initializes an empty flat index, picking the best available kernel for the metric and datatype.
+ *  @return Non-zero on success, zero if the metric isn't supported for the datatype.
+ */
+SIMSIMD_PUBLIC int simsimd_flat_index_init(simsimd_flat_index_t* index, simsimd_metric_kind_t metric,
+                                           simsimd_datatype_t datatype, simsimd_size_t dimensions) {
+    simsimd_size_t const alignment = SIMSIMD_INDEX_ALIGNMENT;
+    simsimd_size_t const row_bytes = dimensions * simsimd_datatype_bytes(datatype);
+    memset(index, 0, sizeof(simsimd_flat_index_t));
+    // Complex kernels export two values per pair, and element-wise kernels have different signatures
+    if (datatype >= simsimd_datatype_f64c_k || metric == simsimd_metric_wsum_k || metric == simsimd_metric_fma_k ||
+        metric == simsimd_metric_scale_k)
+        return 0;
+    index->kernel = simsimd_metric_punned(metric, datatype, simsimd_cap_any_k);
+    if (!index->kernel || !row_bytes)
+        return 0;
+    index->metric = metric;
+    index->datatype = datatype;
+    index->dimensions = dimensions;
+    index->stride = (row_bytes + alignment - 1) / alignment * alignment;
+    return 1;
+}
+
+/**
+ *  @brief  Releases the memory owned by the index, leaving it empty but usable for further additions.
+ */
+SIMSIMD_PUBLIC void simsimd_flat_index_free(simsimd_flat_index_t* index) {
+    simsimd_aligned_free(index->vectors);
+    free(index->alive);
+    index->vectors = 0, index->alive = 0;
+    index->count = index->removed = index->capacity = 0;
+}
+
+/**
+ *  @brief  Grows the storage to fit at least `capacity` rows, doubling the current capacity if that's larger.
+ *  @return Non-zero on success, zero if the allocation failed, leaving the index unchanged.
+ */
+SIMSIMD_PUBLIC int simsimd_flat_index_reserve(simsimd_flat_index_t* index, simsimd_size_t capacity) {
+    if (capacity <= index->capacity)
+        return 1;
+    if (capacity < index->capacity * 2)
+        capacity = index->capacity * 2;
+    capacity = (capacity + 63) / 64 * 64; // Keep the bitmap in whole words
+    simsimd_b8_t* vectors = (simsimd_b8_t*)simsimd_aligned_alloc_uninitialized(capacity * index->stride);
+    simsimd_b8_t* alive = (simsimd_b8_t*)calloc(capacity / 8, 1);
+    if (!vectors || !alive) {
+        simsimd_aligned_free(vectors);
+        free(alive);
+        return 0;
+    }
+    if (index->count)
+        memcpy(alive, index->alive, (index->count + 7) / 8);
+
+    // Every thread copies and zeroes its own partition of rows, placing those pages on its own NUMA node
+    simsimd_size_t const count = index->count, stride = index->stride;
+    simsimd_b8_t const* old_vectors = index->vectors;
+#if defined(_OPENMP) && _OPENMP >= 201307
+#pragma omp parallel proc_bind(spread)
+#elif defined(_OPENMP)
+#pragma omp parallel
+#endif
+    {
+#if defined(_OPENMP)
+        simsimd_size_t const thread = (simsimd_size_t)omp_get_thread_num();
+        simsimd_size_t const threads = (simsimd_size_t)omp_get_num_threads();
+#else
+        simsimd_size_t const thread = 0, threads = 1;
+#endif
+        simsimd_size_t begin, end;
+        simsimd_flat_index_partition(capacity, thread, threads, &begin, &end);
+        simsimd_size_t const copied = count < begin ? begin : count > end ? end : count;
+        if (copied > begin)
+            memcpy(vectors + begin * stride, old_vectors + begin * stride, (copied - begin) * stride);
+        if (end > copied)
+            memset(vectors + copied * stride, 0, (end - copied) * stride);
+    }
+    simsimd_aligned_free(index->vectors);
+    free(index->alive);
+    index->vectors = vectors, index->alive = alive, index->capacity = capacity;
+    return 1;
+}
+
+/**
+ *  @brief  Appends `count` contiguous vectors, assigning them consecutive identifiers starting from `index->count`.
+ *  @return Non-zero on success, zero if the allocation failed.
+ */
+SIMSIMD_PUBLIC int simsimd_flat_index_add(simsimd_flat_index_t* index, void const* vectors, simsimd_size_t count) {
+    simsimd_size_t const row_bytes = index->dimensions * simsimd_datatype_bytes(index->datatype);
+    if (!simsimd_flat_index_reserve(index, index->count + count))
+        return 0;
+    for (simsimd_size_t i = 0; i != count; ++i) {
+        simsimd_size_t id = index->count + i;
+        memcpy(index->vectors + id * index->stride, (simsimd_b8_t const*)vectors + i * row_bytes, row_bytes);
+        index->alive[id / 8] |= (simsimd_b8_t)(1 << (id % 8));
+    }
+    index->count += count;
+    return 1;
+}
+
+/**
+ *  @brief  Marks the vector with the given identifier as removed, excluding it from future searches.
+ *  @return Non-zero if the vector was present, zero if it was never added or was already removed.
+ */
+SIMSIMD_PUBLIC int simsimd_flat_index_remove(simsimd_flat_index_t* index, simsimd_size_t id) {
+    simsimd_b8_t const bit = (simsimd_b8_t)(1 << (id % 8));
+    if (id >= index->count || !(index->alive[id / 8] & bit))
+        return 0;
+    index->alive[id / 8] &= (simsimd_b8_t)~bit;
+    ++index->removed;
+    return 1;
+}
+
+/**
+ *  @brief  Searches the `k` nearest vectors for each of the `queries_count` contiguous queries.
+ *          The results of query `i` are exported into `ids + i * k` and `distances + i * k`, sorted by
+ *          ascending distance. For the inner product, the results are sorted by descending similarity.
+ *          If fewer than `k` vectors are found, the remaining identifiers are set to `(simsimd_size_t)-1`,
+ *          like in all other index searches.
+ *
+ *  @return The number of results found for each query, which is smaller than `k` if the index is smaller.
+ */
+SIMSIMD_PUBLIC simsimd_size_t simsimd_flat_index_search(simsimd_flat_index_t const* index, void const* queries,
+                                                        simsimd_size_t queries_count, simsimd_size_t k,
+                                                        simsimd_size_t* ids, simsimd_distance_t* distances) {
+    simsimd_size_t const row_bytes = index->dimensions * simsimd_datatype_bytes(index->datatype);
+    simsimd_size_t const alive = index->count - index->removed;
+    simsimd_distance_t const sign = index->metric == simsimd_metric_dot_k ? -1 : 1;
+    long long const queries_signed = (long long)queries_count;
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for (long long q = 0; q < queries_signed; ++q) {
+        void const* query = (simsimd_b8_t const*)queries + q * row_bytes;
+        simsimd_size_t* query_ids = ids + q * k;
+        simsimd_distance_t* query_distances = distances + q * k;
+        simsimd_size_t size = 0;
+        for (simsimd_size_t first = 0; first < index->count; first += 64)
+            for (simsimd_u64_t word = simsimd_bitmap_word(index->alive, first, index->count); word;
+                 word &= word - 1) {
+                simsimd_size_t i = first + simsimd_ctz_u64(word);
+                simsimd_distance_t distance;
+                index->kernel(query, index->vectors + i * index->stride, index->dimensions, &distance);
+                simsimd_topk_push(query_distances, query_ids, k, &size, sign * distance, i);
+            }
+        simsimd_topk_sort(query_distances, query_ids, size);
+        for (simsimd_size_t j = 0; j != size; ++j)
+            query_distances[j] *= sign;
+        for (simsimd_size_t j = size; j < k; ++j)
+            query_ids[j] = (simsimd_size_t)-1, query_distances[j] = sign * DBL_MAX;
+    }
+    return alive < k ? alive : k;
+}
+
+/**
+ *  @brief  Searches the `k` nearest vectors for each of the `queries_count` contiguous queries, like
+ *          `simsimd_flat_index_search`, but splitting the rows instead of the queries across threads.
+ *
+ *  Every thread scans only its own partition of rows, that it has first touched when the storage was allocated,
+ *  scoring every block of 64 rows against all queries, while the block is in cache. The per-thread top-k results
+ *  are merged at the end. On multi-socket machines, set `OMP_PLACES=cores` to keep the threads pinned, and keep
+ *  the number of threads unchanged between additions and searches, so the scan bandwidth scales with the sockets.
+ *  Falls back to `simsimd_flat_index_search`, if the per-thread results can't be allocated. Unused slots are padded
+ *  like in `simsimd_flat_index_search`.
+ *
+ *  @return The number of results found for each query, which is smaller than `k` if the index is smaller.
+ */
+SIMSIMD_PUBLIC simsimd_size_t simsimd_flat_index_search_partitioned(simsimd_flat_index_t const* index,
+                                                                    void const* queries, simsimd_size_t queries_count,
+                                                                    simsimd_size_t k, simsimd_size_t* ids,
+                                                                    simsimd_distance_t* distances) {
+    simsimd_size_t const row_bytes = index->dimensions * simsimd_datatype_bytes(index->datatype);
+    simsimd_size_t const alive = index->count - index->removed;
+    simsimd_distance_t const sign = index->metric == simsimd_metric_dot_k ? -1 : 1;
+#if defined(_OPENMP)
+    simsimd_size_t const max_threads = (simsimd_size_t)omp_get_max_threads();
+#else
+    simsimd_size_t const max_threads = 1;
+#endif
+    simsimd_size_t const heaps = max_threads * queries_count;
+    simsimd_size_t* thread_ids = (simsimd_size_t*)malloc((heaps * k + 1) * sizeof(simsimd_size_t));
+    simsimd_distance_t* thread_distances = (simsimd_distance_t*)malloc((heaps * k + 1) * sizeof(simsimd_distance_t));
+    simsimd_size_t* thread_sizes = (simsimd_size_t*)calloc(heaps + 1, sizeof(simsimd_size_t));
+    if (!thread_ids || !thread_distances || !thread_sizes) {
+        free(thread_ids);
+        free(thread_distances);
+        free(thread_sizes);
+        return simsimd_flat_index_search(index, queries, queries_count, k, ids, distances);
+    }
+
+    simsimd_size_t threads = 1;
+#if defined(_OPENMP) && _OPENMP >= 201307
+#pragma omp parallel proc_bind(spread) num_threads((int)max_threads)
+#elif defined(_OPENMP)
+#pragma omp parallel num_threads((int)max_threads)
+#endif
+    {
+#if defined(_OPENMP)
+        simsimd_size_t const thread = (simsimd_size_t)omp_get_thread_num();
+        simsimd_size_t const team = (simsimd_size_t)omp_get_num_threads();
+#else
+        simsimd_size_t const thread = 0, team = 1;
+#endif
+        if (thread == 0)
+            threads = team;
+        simsimd_size_t begin, end;
+        simsimd_flat_index_partition(index->capacity, thread, team, &begin, &end);
+        if (end > index->count)
+            end = index->count;
+        for (simsimd_size_t first = begin; first < end; first += 64) {
+            simsimd_u64_t const block = simsimd_bitmap_word(index->alive, first, end);
+            for (simsimd_size_t q = 0; q != queries_count; ++q) {
+                void const* query = (simsimd_b8_t const*)queries + q * row_bytes;
+                simsimd_size_t const heap = thread * queries_count + q;
+                for (simsimd_u64_t word = block; word; word &= word - 1) {
+                    simsimd_size_t i = first + simsimd_ctz_u64(word);
+                    simsimd_distance_t distance;
+                    index->kernel(query, index->vectors + i * index->stride, index->dimensions, &distance);
+                    simsimd_topk_push(thread_distances + heap * k, thread_ids + heap * k, k, &thread_sizes[heap],
+                                      sign * distance, i);
+                }
+            }
+        }
+    }
+
+    // Merge the per-thread candidates of every query
+    long long const queries_signed = (long long)queries_count;
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for (long long q = 0; q < queries_signed; ++q) {
+        simsimd_size_t* query_ids = ids + q * k;
+        simsimd_distance_t* query_distances = distances + q * k;
+        simsimd_size_t size = 0;
+        for (simsimd_size_t thread = 0; thread != threads; ++thread) {
+            simsimd_size_t const heap = thread * queries_count + (simsimd_size_t)q;
+            for (simsimd_size_t j = 0; j != thread_sizes[heap]; ++j)
+                simsimd_topk_push(query_distances, query_ids, k, &size, thread_distances[heap * k + j],
+                                  thread_ids[heap * k + j]);
+        }
+        simsimd_topk_sort(query_distances, query_ids, size);
+        for (simsimd_size_t j = 0; j != size; ++j)
+            query_distances[j] *= sign;
+        for (simsimd_size_t j = size; j < k; ++j)
+            query_ids[j] = (simsimd_size_t)-1, query_distances[j] = sign * DBL_MAX;
+    }
+    free(thread_ids);
+    free(thread_distances);
+    free(thread_sizes);
+    return alive < k ? alive : k;
+}
+
+/**
+ *  @brief  Finds the nearest of `count` centroids to the given vector, with `sign` set to -1 for similarity metrics.
+ *  @return The index of the nearest centroid, and its distance in `distance`, if it's not NULL.
+ */
+SIMSIMD_INTERNAL simsimd_size_t simsimd_nearest_punned(simsimd_metric_punned_t kernel, simsimd_distance_t sign,
+                                                       void const* vector, void const* centroids, simsimd_size_t stride,
+                                                       simsimd_size_t count, simsimd_size_t n,
+                                                       simsimd_distance_t* distance) {
+    simsimd_size_t nearest = 0;
+    simsimd_distance_t nearest_distance = DBL_MAX;
+    for (simsimd_size_t i = 0; i != count; ++i) {
+        simsimd_distance_t candidate;
+        kernel(vector, (simsimd_b8_t const*)centroids + i * stride, n, &candidate);
+        candidate *= sign;
+        if (candidate < nearest_distance)
+            nearest = i, nearest_distance = candidate;
+    }
+    if (distance)
+        *distance = sign * nearest_distance;
+    return nearest;
+}
+
+/**
+ *  @brief  Assigns `rows` contiguous `f32` vectors to the nearest of `k` contiguous centroids, using the fused
+ *          `assign` kernel if one exists for the metric, or comparing against every centroid with `kernel` otherwise.
+ */
+SIMSIMD_INTERNAL void simsimd_nearest_rows_punned(simsimd_kernel_assign_punned_t assign, simsimd_metric_punned_t kernel,
+                                                  simsimd_distance_t sign, simsimd_f32_t const* vectors,
+                                                  simsimd_size_t rows, simsimd_f32_t const* centroids, simsimd_size_t k,
+                                                  simsimd_size_t n, simsimd_size_t* assignments) {
+    if (assign) {
+        assign(vectors, rows, centroids, k, n, assignments, 0);
+        return;
+    }
+    for (simsimd_size_t r = 0; r != rows; ++r)
+        assignments[r] =
+            simsimd_nearest_punned(kernel, sign, vectors + r * n, centroids, n * sizeof(simsimd_f32_t), k, n, 0);
+}
+
+/**
+ *  @brief  Number of consecutive rows, that k-means converts to `f32` and assigns at once. The tile is kept in cache
+ *          while the rows are assigned and accumulated into their centroids. Defaults to 64 KB of `f32` scalars
+ *          for 256-dimensional vectors.
+ */
+#ifndef SIMSIMD_KMEANS_TILE
+#define SIMSIMD_KMEANS_TILE (64)
+#endif
+
+/**
+ *  @brief  Returns `rows` contiguous vectors starting from `first` as `f32`, either converting them into `scratch`
+ *          with the `to_f32` kernel, or pointing into the original `f32` array, if no kernel is given.
+ */
+SIMSIMD_INTERNAL simsimd_f32_t const* simsimd_kmeans_load(void const* vectors, simsimd_size_t scalar_bytes,
+                                                          simsimd_kernel_scale_punned_t to_f32, simsimd_size_t first,
+                                                          simsimd_size_t rows, simsimd_size_t n,
+                                                          simsimd_f32_t* scratch) {
+    if (!to_f32)
+        return (simsimd_f32_t const*)vectors + first * n;
+    to_f32((simsimd_b8_t const*)vectors + first * n * scalar_bytes, rows * n, 1, 0, scratch);
+    return scratch;
+}
+
+/**
+ *  @brief  Clusters `count` contiguous vectors of any floating-point type into `k` centroids, using either
+ *          Lloyd's algorithm, or the mini-batch updates of Sculley, if `batch_size` is non-zero and
+ *          smaller than `count`. The centroids are seeded with evenly spaced vectors, and mini-batches are
+ *          sampled with a fixed-seed generator, so the result is deterministic.
+ *
+ *  Lloyd's iterations convert every tile of `SIMSIMD_KMEANS_TILE` vectors to `f32` and assign it to the nearest
+ *  centroids, distributing tiles across OpenMP threads. The assigned vectors are then bucketed by centroid with a
+ *  counting sort, and the centroids are recomputed in parallel, each thread owning whole centroids and summing
+ *  their members in `f64`. So no thread keeps partial sums of all `k` centroids, there is nothing to merge, and
+ *  the result doesn't depend on the number of threads. Empty clusters keep their previous centroids. For the
+ *  `l2sq`, `cos`, and `dot` metrics, the assignment uses the fused `simsimd_assign_*` kernels, never
+ *  materializing the distances to all centroids.
+ *
+ *  @param metric The metric used to assign vectors to centroids.
+ *  @param datatype The type of the input vectors, being `f32`, `f16` or `bf16`.
+ *  @param vectors The first of `count` contiguous vectors of `n` dimensions.
+ *  @param k The number of centroids, not larger than `count`.
+ *  @param iterations The maximum number of iterations, stopping early if Lloyd's assignments don't change.
+ *  @param batch_size The number of vectors sampled per mini-batch iteration, or zero for full iterations.
+ *  @param centroids The output array of `k` contiguous `f32` centroids of `n` dimensions.
+ *  @param assignments The optional output array of `count` centroid indices, one per vector.
+ *  @return Non-zero on success, zero if the metric or datatype aren't supported or the allocation failed.
+ */
+SIMSIMD_PUBLIC int simsimd_kmeans_punned(simsimd_metric_kind_t metric, simsimd_datatype_t datatype,
+                                         void const* vectors, simsimd_size_t count, simsimd_size_t n,
+                                         simsimd_size_t k, simsimd_size_t iterations, simsimd_size_t batch_size,
+                                         simsimd_f32_t* centroids, simsimd_size_t* assignments) {
+    simsimd_size_t const tile = SIMSIMD_KMEANS_TILE;
+    simsimd_size_t const scalar_bytes = simsimd_datatype_bytes(datatype);
+    simsimd_size_t const tiles = (count + tile - 1) / tile;
+    simsimd_distance_t const sign = metric == simsimd_metric_dot_k ? -1 : 1;
+    int const minibatch = batch_size && batch_size < count;
+    simsimd_metric_punned_t kernel = simsimd_metric_punned(metric, simsimd_datatype_f32_k, simsimd_cap_any_k);
+    simsimd_kernel_assign_punned_t assign = 0;
+    simsimd_kernel_scale_punned_t to_f32 = 0;
+    simsimd_capability_t to_f32_capability, assign_capability;
+    if (datatype != simsimd_datatype_f32_k && datatype != simsimd_datatype_f16_k && datatype != simsimd_datatype_bf16_k)
+        return 0;
+    if (datatype != simsimd_datatype_f32_k)
+        simsimd_find_scale_punned(datatype, simsimd_datatype_f32_k, simsimd_capabilities(), simsimd_cap_any_k,
+                                  &to_f32, &to_f32_capability);
+    if (!kernel || (datatype != simsimd_datatype_f32_k && !to_f32) || !k || k > count)
+        return 0;
+    simsimd_find_assign_punned(metric, simsimd_datatype_f32_k, simsimd_capabilities(), simsimd_cap_any_k, &assign,
+                               &assign_capability);
+
+    // Every thread gets its own conversion scratch space and, for Lloyd's iterations, the sums of one centroid
+#if defined(_OPENMP)
+    simsimd_size_t const threads = (simsimd_size_t)omp_get_max_threads();
+#else
+    simsimd_size_t const threads = 1;
+#endif
+    simsimd_size_t const rows = minibatch && batch_size > tile ? batch_size : tile;
+    simsimd_size_t const sums_count = minibatch ? 0 : threads * n;
+    simsimd_size_t const members_count = minibatch ? 0 : count;
+    simsimd_f32_t* scratch = (simsimd_f32_t*)malloc(threads * rows * n * sizeof(simsimd_f32_t));
+    simsimd_f64_t* sums = (simsimd_f64_t*)malloc((sums_count + 1) * sizeof(simsimd_f64_t));
+    simsimd_size_t* sizes = (simsimd_size_t*)calloc(k + 1, sizeof(simsimd_size_t));
+    simsimd_size_t* members = (simsimd_size_t*)malloc((members_count + 1) * sizeof(simsimd_size_t));
+    simsimd_size_t const nearest_count = minibatch ? batch_size : threads * tile;
+    simsimd_size_t* nearest = (simsimd_size_t*)malloc(nearest_count * sizeof(simsimd_size_t));
+    simsimd_size_t* owned_assignments = 0;
+    if (!assignments && !minibatch)
+        assignments = owned_assignments = (simsimd_size_t*)malloc(count * sizeof(simsimd_size_t));
+    int const allocated = scratch && sums && sizes && members && nearest && (assignments || minibatch);
+    if (allocated) {
+        for (simsimd_size_t c = 0; c != k; ++c) {
+            simsimd_size_t const seed_row = c * count / k;
+            simsimd_f32_t const* seed = simsimd_kmeans_load(vectors, scalar_bytes, to_f32, seed_row, 1, n, scratch);
+            memcpy(centroids + c * n, seed, n * sizeof(simsimd_f32_t));
+        }
+    }
+
+    long long const tiles_signed = (long long)tiles;
+    long long const k_signed = (long long)k;
+    if (allocated && !minibatch) {
+        for (simsimd_size_t i = 0; i != count; ++i)
+            assignments[i] = k;
+        for (simsimd_size_t iteration = 0; iteration != iterations; ++iteration) {
+            long long changes = 0;
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic, 1) reduction(+ : changes)
+#endif
+            for (long long t = 0; t < tiles_signed; ++t) {
+#if defined(_OPENMP)
+                simsimd_size_t const thread = (simsimd_size_t)omp_get_thread_num();
+#else
+                simsimd_size_t const thread = 0;
+#endif
+                simsimd_size_t const first = (simsimd_size_t)t * tile;
+                simsimd_size_t const tile_rows = count - first < tile ? count - first : tile;
+                simsimd_f32_t* thread_scratch = scratch + thread * rows * n;
+                simsimd_f32_t const* tile_vectors =
+                    simsimd_kmeans_load(vectors, scalar_bytes, to_f32, first, tile_rows, n, thread_scratch);
+                simsimd_size_t* thread_nearest = nearest + thread * tile;
+                simsimd_nearest_rows_punned(assign, kernel, sign, tile_vectors, tile_rows, centroids, k, n,
+                                            thread_nearest);
+                for (simsimd_size_t r = 0; r != tile_rows; ++r) {
+                    changes += thread_nearest[r] != assignments[first + r];
+                    assignments[first + r] = thread_nearest[r];
+                }
+            }
+            if (!changes)
+                break;
+
+            // Bucket the vectors by centroid with a counting sort, leaving the ascending indices of the vectors
+            // of centroid `c` in `members`, from `c ? sizes[c - 1] : 0` to `sizes[c]`
+            memset(sizes, 0, (k + 1) * sizeof(simsimd_size_t));
+            for (simsimd_size_t i = 0; i != count; ++i)
+                ++sizes[assignments[i] + 1];
+            for (simsimd_size_t c = 1; c != k; ++c)
+                sizes[c] += sizes[c - 1];
+            for (simsimd_size_t i = 0; i != count; ++i)
+                members[sizes[assignments[i]]++] = i;
+
+            // Recompute the centroids, each summed by a single thread
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+            for (long long c = 0; c < k_signed; ++c) {
+#if defined(_OPENMP)
+                simsimd_size_t const thread = (simsimd_size_t)omp_get_thread_num();
+#else
+                simsimd_size_t const thread = 0;
+#endif
+                simsimd_size_t const begin = c ? sizes[c - 1] : 0, end = sizes[c];
+                simsimd_f64_t* centroid_sums = sums + thread * n;
+                simsimd_f32_t* thread_scratch = scratch + thread * rows * n;
+                if (begin == end)
+                    continue;
+                memset(centroid_sums, 0, n * sizeof(simsimd_f64_t));
+                for (simsimd_size_t m = begin; m != end; ++m) {
+                    simsimd_f32_t const* vector =
+                        simsimd_kmeans_load(vectors, scalar_bytes, to_f32, members[m], 1, n, thread_scratch);
+                    for (simsimd_size_t j = 0; j != n; ++j)
+                        centroid_sums[j] += vector[j];
+                }
+                for (simsimd_size_t j = 0; j != n; ++j)
+                    centroids[c * n + j] = (simsimd_f32_t)(centroid_sums[j] / (end - begin));
+            }
+        }
+    }
+    else if (allocated) {
+        // Mini-batch iterations gather and convert a sample, assign it in parallel, and move every assigned
+        // centroid towards the sampled vector with a learning rate, decaying with the number of its samples.
+        long long const batch_tiles_signed = (long long)((batch_size + tile - 1) / tile);
+        simsimd_u64_t random = 0x9E3779B97F4A7C15ull;
+        for (simsimd_size_t iteration = 0; iteration != iterations; ++iteration) {
+            for (simsimd_size_t b = 0; b != batch_size; ++b) {
+                random = random * 6364136223846793005ull + 1442695040888963407ull;
+                simsimd_size_t i = (simsimd_size_t)((random >> 33) % count);
+                simsimd_f32_t* sample = scratch + b * n;
+                simsimd_f32_t const* vector = simsimd_kmeans_load(vectors, scalar_bytes, to_f32, i, 1, n, sample);
+                if (vector != sample)
+                    memcpy(sample, vector, n * sizeof(simsimd_f32_t));
+            }
+#if defined(_OPENMP)
+#pragma omp parallel for
+#endif
+            for (long long t = 0; t < batch_tiles_signed; ++t) {
+                simsimd_size_t const first = (simsimd_size_t)t * tile;
+                simsimd_size_t const tile_rows = batch_size - first < tile ? batch_size - first : tile;
+                simsimd_nearest_rows_punned(assign, kernel, sign, scratch + first * n, tile_rows, centroids, k, n,
+                                            nearest + first);
+            }
+            for (simsimd_size_t b = 0; b != batch_size; ++b) {
+                simsimd_f32_t* centroid = centroids + nearest[b] * n;
+                simsimd_f32_t const rate = 1.f / (simsimd_f32_t)(++sizes[nearest[b]]);
+                for (simsimd_size_t j = 0; j != n; ++j)
+                    centroid[j] += rate * (scratch[b * n + j] - centroid[j]);
+            }
+        }
+
+        // Export the final assignments of all vectors, if requested
+        if (assignments) {
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+            for (long long t = 0; t < tiles_signed; ++t) {
+#if defined(_OPENMP)
+                simsimd_size_t const thread = (simsimd_size_t)omp_get_thread_num();
+#else
+                simsimd_size_t const thread = 0;
+#endif
+                simsimd_size_t const first = (simsimd_size_t)t * tile;
+                simsimd_size_t const tile_rows = count - first < tile ? count - first : tile;
+                simsimd_f32_t* thread_scratch = scratch + thread * rows * n;
+                simsimd_f32_t const* tile_vectors =
+                    simsimd_kmeans_load(vectors, scalar_bytes, to_f32, first, tile_rows, n, thread_scratch);
+                simsimd_nearest_rows_punned(assign, kernel, sign, tile_vectors, tile_rows, centroids, k, n,
+                                            assignments + first);
+            }
+        }
+    }
+    free(scratch);
+    free(sums);
+    free(sizes);
+    free(members);
+    free(nearest);
+    free(owned_assignments);
+    return allocated;
+}
+
+/*  Typed wrappers over `simsimd_kmeans_punned`
+ *  - `simsimd_kmeans_*` run full Lloyd's iterations.
+ *  - `simsimd_kmeans_minibatch_*` run mini-batch iterations of `batch_size` sampled vectors.
+ */
+#define SIMSIMD_MAKE_KMEANS(input_type)                                                                                \
+    SIMSIMD_PUBLIC int simsimd_kmeans_##input_type(                                                                    \
+        simsimd_metric_kind_t metric, simsimd_##input_type##_t const* vectors, simsimd_size_t count, simsimd_size_t n, \
+        simsimd_size_t k, simsimd_size_t iterations, simsimd_f32_t* centroids, simsimd_size_t* assignments) {          \
+        return simsimd_kmeans_punned(metric, simsimd_datatype_##input_type##_k, vectors, count, n, k, iterations, 0,   \
+                                     centroids, assignments);                                                          \
+    }                                                                                                                  \
+    SIMSIMD_PUBLIC int simsimd_kmeans_minibatch_##input_type(                                                          \
+        simsimd_metric_kind_t metric, simsimd_##input_type##_t const* vectors, simsimd_size_t count, simsimd_size_t n, \
+        simsimd_size_t k, simsimd_size_t iterations, simsimd_size_t batch_size, simsimd_f32_t* centroids,              \
+        simsimd_size_t* assignments) {                                                                                 \
+        return simsimd_kmeans_punned(metric, simsimd_datatype_##input_type##_k, vectors, count, n, k, iterations,      \
+                                     batch_size, centroids, assignments);                                              \
+    }
+
+SIMSIMD_MAKE_KMEANS(f32)  // simsimd_kmeans_f32, simsimd_kmeans_minibatch_f32
+SIMSIMD_MAKE_KMEANS(f16)  // simsimd_kmeans_f16, simsimd_kmeans_minibatch_f16
+SIMSIMD_MAKE_KMEANS(bf16) // simsimd_kmeans_bf16, simsimd_kmeans_minibatch_bf16
+
+/**
+ *  @brief  Single inverted list, storing the vectors assigned to one centroid contiguously, with their identifiers.
+ */
+typedef struct simsimd_ivf_list_t {
+    simsimd_b8_t* vectors;   ///< Aligned storage of `capacity` rows of `stride` bytes
+    simsimd_size_t* ids;     ///< Identifiers of the stored vectors
+    simsimd_size_t count;    ///< Number of stored vectors
+    simsimd_size_t capacity; ///< Number of vectors, that fit into the allocated storage
+} simsimd_ivf_list_t;
+
+/**
+ *  @brief  Inverted file index, partitioning the vectors into lists by their nearest k-means centroid.
+ *          Searches only scan the `nprobe` lists with the nearest centroids, trading recall for speed.
+ *          Currently supports only `f32` vectors, matching the `simsimd_kmeans_f32` training routine.
+ */
+typedef struct simsimd_ivf_index_t {
+    simsimd_metric_kind_t metric;   ///< Metric used to compare the vectors
+    simsimd_datatype_t datatype;    ///< Type of the scalars in every vector
+    simsimd_metric_punned_t kernel; ///< Best kernel for the `metric` and `datatype` on the current machine
+    simsimd_size_t dimensions;      ///< Number of scalars in every vector
+    simsimd_size_t stride;          ///< Number of bytes between the starts of consecutive rows in every list
+    simsimd_size_t count;           ///< Number of vectors ever added
+    simsimd_size_t lists_count;     ///< Number of centroids and inverted lists
+    simsimd_f32_t* centroids;       ///< Contiguous `lists_count` centroids, or NULL before training
+    simsimd_ivf_list_t* lists;      ///< Array of `lists_count` inverted lists
+} simsimd_ivf_index_t;
+
+/**
+ *  @brief  Initializes an empty untrained inverted file index with the given number of lists.
+ *  @return Non-zero on success, zero if the metric or datatype aren't supported or the allocation failed.
+ */
+SIMSIMD_PUBLIC int simsimd_ivf_index_init(simsimd_ivf_index_t* index, simsimd_metric_kind_t metric,
+                                          simsimd_datatype_t datatype, simsimd_size_t dimensions,
+                                          simsimd_size_t lists_count) {
+    simsimd_size_t const alignment = SIMSIMD_INDEX_ALIGNMENT;
+    memset(index, 0, sizeof(simsimd_ivf_index_t));
+    if (datatype != simsimd_datatype_f32_k || !dimensions || !lists_count)
+        return 0;
+    if (metric != simsimd_metric_dot_k && metric != simsimd_metric_cos_k && metric != simsimd_metric_l2sq_k)
+        return 0;
+    index->kernel = simsimd_metric_punned(metric, datatype, simsimd_cap_any_k);
+    index->lists = (simsimd_ivf_list_t*)calloc(lists_count, sizeof(simsimd_ivf_list_t));
+    if (!index->kernel || !index->lists) {
+        free(index->lists);
+        index->lists = 0;
+        return 0;
+    }
+    index->metric = metric;
+    index->datatype = datatype;
+    index->dimensions = dimensions;
+    index->stride = (dimensions * sizeof(simsimd_f32_t) + alignment - 1) / alignment * alignment;
+    index->lists_count = lists_count;
+    return 1;
+}
+
+/**
+ *  @brief  Releases the memory owned by the index, including the trained centroids.
+ */
+SIMSIMD_PUBLIC void simsimd_ivf_index_free(simsimd_ivf_index_t* index) {
+    for (simsimd_size_t i = 0; index->lists && i != index->lists_count; ++i) {
+        simsimd_aligned_free(index->lists[i].vectors);
+        free(index->lists[i].ids);
+    }
+    free(index->lists);
+    free(index->centroids);
+    index->lists = 0, index->centroids = 0;
+    index->count = 0;
+}
+
+/**
+ *  @brief  Trains the centroids on a sample of `count` contiguous vectors, that isn't added to the index.
+ *          Should be called once, before any additions.
+ *  @return Non-zero on success, zero if there are fewer vectors than lists or the allocation failed.
+ */
+SIMSIMD_PUBLIC int simsimd_ivf_index_train(simsimd_ivf_index_t* index, void const* vectors, simsimd_size_t count,
+                                           simsimd_size_t iterations) {
+    simsimd_size_t const n = index->dimensions;
+    simsimd_f32_t* centroids = (simsimd_f32_t*)malloc(index->lists_count * n * sizeof(simsimd_f32_t));
+    simsimd_size_t* assignments = (simsimd_size_t*)malloc(count * sizeof(simsimd_size_t));
+    int trained = centroids && assignments &&
+                  simsimd_kmeans_f32(index->metric, (simsimd_f32_t const*)vectors, count, n, index->lists_count,
+                                     iterations, centroids, assignments);
+    free(assignments);
+    if (!trained) {
+        free(centroids);
+        return 0;
+    }
+    free(index->centroids);
+    index->centroids = centroids;
+    return 1;
+}
+
+/**
+ *  @brief  Appends `count` contiguous vectors to the lists of their nearest centroids, assigning them consecutive
+ *          identifiers starting from `index->count`. The index must be trained. All vectors are assigned and every
+ *          list is grown before the first one is appended, so a failed addition doesn't add a partial batch.
+ *  @return Non-zero on success, zero if the index isn't trained or the allocation failed, leaving it unchanged.
+ */
+SIMSIMD_PUBLIC int simsimd_ivf_index_add(simsimd_ivf_index_t* index, void const* vectors, simsimd_size_t count) {
+    simsimd_size_t const n = index->dimensions, lists_count = index->lists_count;
+    simsimd_size_t const row_bytes = n * sizeof(simsimd_f32_t);
+    simsimd_distance_t const sign = index->metric == simsimd_metric_dot_k ? -1 : 1;
+    simsimd_kernel_assign_punned_t assign = 0;
+    simsimd_capability_t assign_capability;
+    if (!index->centroids)
+        return 0;
+    simsimd_size_t* nearest = (simsimd_size_t*)malloc((count + 1) * sizeof(simsimd_size_t));
+    simsimd_size_t* added = (simsimd_size_t*)calloc(lists_count, sizeof(simsimd_size_t));
+    simsimd_ivf_list_t* grown = (simsimd_ivf_list_t*)calloc(lists_count, sizeof(simsimd_ivf_list_t));
+    int failed = !nearest || !added || !grown;
+    simsimd_find_assign_punned(index->metric, simsimd_datatype_f32_k, simsimd_capabilities(), simsimd_cap_any_k,
+                               &assign, &assign_capability);
+    for (simsimd_size_t i = 0; !failed && i < count; i += SIMSIMD_KMEANS_TILE) {
+        simsimd_size_t const tile_rows = count - i < SIMSIMD_KMEANS_TILE ? count - i : SIMSIMD_KMEANS_TILE;
+        simsimd_f32_t const* tile_vectors = (simsimd_f32_t const*)((simsimd_b8_t const*)vectors + i * row_bytes);
+        simsimd_nearest_rows_punned(assign, index->kernel, sign, tile_vectors, tile_rows, index->centroids,
+                                    lists_count, n, nearest + i);
+        for (simsimd_size_t r = 0; r != tile_rows; ++r)
+            ++added[nearest[i + r]];
+    }
+
+    // Allocate the new storage of every overflowing list, without releasing the old one yet
+    for (simsimd_size_t l = 0; !failed && l != lists_count; ++l) {
+        simsimd_ivf_list_t const* list = &index->lists[l];
+        if (list->count + added[l] <= list->capacity)
+            continue;
+        simsimd_size_t capacity = list->capacity ? list->capacity * 2 : 16;
+        while (capacity < list->count + added[l])
+            capacity *= 2;
+        grown[l].vectors = (simsimd_b8_t*)simsimd_aligned_alloc(capacity * index->stride);
+        grown[l].ids = (simsimd_size_t*)malloc(capacity * sizeof(simsimd_size_t));
+        grown[l].capacity = capacity;
+        failed = !grown[l].vectors || !grown[l].ids;
+    }
+    if (failed) {
+        for (simsimd_size_t l = 0; grown && l != lists_count; ++l) {
+            simsimd_aligned_free(grown[l].vectors);
+            free(grown[l].ids);
+        }
+        free(nearest);
+        free(added);
+        free(grown);
+        return 0;
+    }
+
+    // Nothing can fail from here on, so the grown lists replace the old ones, and the vectors are appended
+    for (simsimd_size_t l = 0; l != lists_count; ++l) {
+        simsimd_ivf_list_t* list = &index->lists[l];
+        if (!grown[l].capacity)
+            continue;
+        if (list->count) {
+            memcpy(grown[l].vectors, list->vectors, list->count * index->stride);
+            memcpy(grown[l].ids, list->ids, list->count * sizeof(simsimd_size_t));
+        }
+        simsimd_aligned_free(list->vectors);
+        free(list->ids);
+        list->vectors = grown[l].vectors, list->ids = grown[l].ids, list->capacity = grown[l].capacity;
+    }
+    for (simsimd_size_t i = 0; i != count; ++i) {
+        simsimd_ivf_list_t* list = &index->lists[nearest[i]];
+        memcpy(list->vectors + list->count * index->stride, (simsimd_b8_t const*)vectors + i * row_bytes, row_bytes);
+        list->ids[list->count++] = index->count++;
+    }
+    free(nearest);
+    free(added);
+    free(grown);
+    return 1;
+}
+
+/**
+ *  @brief  Searches the `k` nearest vectors for each of the `queries_count` contiguous queries, scanning the
+ *          `nprobe` lists with the nearest centroids. The results of query `i` are exported into `ids + i * k`
+ *          and `distances + i * k`, sorted like in `simsimd_flat_index_search`. If fewer than `k` vectors
+ *          are found, the remaining identifiers are set to `(simsimd_size_t)-1`.
+ *          Queries are processed in parallel with OpenMP, if enabled.
+ *
+ *  @return Non-zero on success, zero if the index isn't trained or the allocation failed.
+ */
+SIMSIMD_PUBLIC int simsimd_ivf_index_search(simsimd_ivf_index_t const* index, void const* queries,
+                                            simsimd_size_t queries_count, simsimd_size_t nprobe, simsimd_size_t k,
+                                            simsimd_size_t* ids, simsimd_distance_t* distances) {
+    simsimd_size_t const n = index->dimensions;
+    simsimd_size_t const row_bytes = n * sizeof(simsimd_f32_t);
+    simsimd_distance_t const sign = index->metric == simsimd_metric_dot_k ? -1 : 1;
+    if (nprobe > index->lists_count)
+        nprobe = index->lists_count;
+    if (!index->centroids)
+        return 0;
+    // Every query ranks the centroids in its own slice of the scratch space
+    simsimd_size_t* probe_ids = (simsimd_size_t*)malloc(queries_count * nprobe * sizeof(simsimd_size_t));
+    simsimd_distance_t* probe_distances =
+        (simsimd_distance_t*)malloc(queries_count * nprobe * sizeof(simsimd_distance_t));
+    if (!probe_ids || !probe_distances) {
+        free(probe_ids);
+        free(probe_distances);
+        return 0;
+    }
+
+    long long const queries_signed = (long long)queries_count;
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for (long long q = 0; q < queries_signed; ++q) {
+        void const* query = (simsimd_b8_t const*)queries + q * row_bytes;
+        simsimd_size_t* query_probe_ids = probe_ids + q * nprobe;
+        simsimd_distance_t* query_probe_distances = probe_distances + q * nprobe;
+        simsimd_size_t* query_ids = ids + q * k;
+        simsimd_distance_t* query_distances = distances + q * k;
+        simsimd_size_t probes = 0, size = 0;
+        for (simsimd_size_t c = 0; c != index->lists_count; ++c) {
+            simsimd_distance_t distance;
+            index->kernel(query, index->centroids + c * n, n, &distance);
+            simsimd_topk_push(query_probe_distances, query_probe_ids, nprobe, &probes, sign * distance, c);
+        }
+        for (simsimd_size_t p = 0; p != probes; ++p) {
+            simsimd_ivf_list_t const* list = &index->lists[query_probe_ids[p]];
+            for (simsimd_size_t i = 0; i != list->count; ++i) {
+                simsimd_distance_t distance;
+                index->kernel(query, list->vectors + i * index->stride, n, &distance);
+                simsimd_topk_push(query_distances, query_ids, k, &size, sign * distance, list->ids[i]);
+            }
+        }
+        simsimd_topk_sort(query_distances, query_ids, size);
+        for (simsimd_size_t j = 0; j != size; ++j)
+            query_distances[j] *= sign;
+        for (simsimd_size_t j = size; j < k; ++j)
+            query_ids[j] = (simsimd_size_t)-1, query_distances[j] = sign * DBL_MAX;
+    }
+    free(probe_ids);
+    free(probe_distances);
+    return 1;
+}
+
+/**
+ *  @brief  Acquires and releases a byte-sized spin-lock, guarding the adjacency lists of a single graph node.
+ *          Without compiler support for atomics, the locks are no-ops, and concurrent insertions aren't safe.
+ */
+SIMSIMD_INTERNAL void simsimd_spin_lock(char* lock) {
+#if defined(__GNUC__) || defined(__clang__)
+    while (__atomic_test_and_set(lock, __ATOMIC_ACQUIRE))
+        ;
+#elif defined(_MSC_VER)
+    while (_InterlockedExchange8(lock, 1))
+        ;
+#else
+    (void)lock;
+#endif
+}
+
+SIMSIMD_INTERNAL void simsimd_spin_unlock(char* lock) {
+#if defined(__GNUC__) || defined(__clang__)
+    __atomic_clear(lock, __ATOMIC_RELEASE);
+#elif defined(_MSC_VER)
+    _InterlockedExchange8(lock, 0);
+#else
+    (void)lock;
+#endif
+}
+
+/**
+ *  @brief  Hierarchical Navigable Small World graph index, supporting concurrent insertions and searches.
+ *
+ *  The base level is interleaved with the vectors: every node occupies `node_bytes`, starting with the vector
+ *  padded to `stride` bytes, followed by the neighbors counter and up to `2 * connectivity` neighbors, so that
+ *  expanding a node touches the cache lines of its vector. Upper levels are allocated separately per node,
+ *  as only one in `connectivity` nodes reaches them. All neighbors of an expanded node are scored with a single
+ *  gather call, prefetching the rows of the upcoming neighbors.
+ *
+ *  Every node has its own spin-lock, taken while its adjacency lists are read or updated, and the entry point
+ *  is guarded by a global lock. The storage is allocated once for a fixed `capacity`, so that insertions never
+ *  move the nodes, that concurrent searches may be reading.
+ */
+typedef struct simsimd_hnsw_index_t {
+    simsimd_metric_kind_t metric;   ///< Metric used to compare the vectors
+    simsimd_datatype_t datatype;    ///< Type of the scalars in every vector
+    simsimd_metric_punned_t kernel; ///< Best kernel for the `metric` and `datatype` on the current machine
+    simsimd_distance_t sign;        ///< Multiplier turning the kernel outputs into distances, -1 for similarities
+    simsimd_size_t dimensions;      ///< Number of scalars in every vector
+    simsimd_size_t stride;          ///< Number of bytes of the padded vector at the start of every node
+    simsimd_size_t node_bytes;      ///< Number of bytes between the starts of consecutive nodes
+    simsimd_size_t connectivity;    ///< Maximum number of neighbors on upper levels, doubled on the base level
+    simsimd_size_t expansion;       ///< Number of candidates tracked while searching for neighbors on insertion
+    simsimd_size_t count;           ///< Number of reserved nodes, including the ones being inserted
+    simsimd_size_t capacity;        ///< Maximum number of nodes, smaller than `UINT32_MAX`
+    simsimd_size_t entry;           ///< Entry node on the top level, or `(simsimd_size_t)-1` if empty
+    simsimd_size_t max_level;       ///< Level of the entry node
+    simsimd_b8_t* nodes;            ///< Aligned storage of `capacity` nodes of `node_bytes` each
+    simsimd_u32_t** upper_links;    ///< Per-node adjacency lists for levels above the base, or NULL
+    char* locks;                    ///< Per-node spin-locks
+    char lock;                      ///< Spin-lock guarding `count`, `entry` and `max_level`
+} simsimd_hnsw_index_t;
+
+/**
+ *  @brief  Initializes an empty graph for up to `capacity` vectors.
+ *
+ *  @param connectivity The maximum number of neighbors per node on upper levels, often 16.
+ *  @param expansion The number of candidates considered when linking new nodes, often 128.
+ *  @return Non-zero on success, zero if the metric isn't supported for the datatype or the allocation failed.
+ */
+SIMSIMD_PUBLIC int simsimd_hnsw_index_init(simsimd_hnsw_index_t* index, simsimd_metric_kind_t metric,
+                                           simsimd_datatype_t datatype, simsimd_size_t dimensions,
+                                           simsimd_size_t capacity, simsimd_size_t connectivity,
+                                           simsimd_size_t expansion) {
+    simsimd_size_t const alignment = SIMSIMD_INDEX_ALIGNMENT;
+    simsimd_size_t const row_bytes = dimensions * simsimd_datatype_bytes(datatype);
+    memset(index, 0, sizeof(simsimd_hnsw_index_t));
+    if (datatype >= simsimd_datatype_f64c_k || metric == simsimd_metric_wsum_k || metric == simsimd_metric_fma_k ||
+        metric == simsimd_metric_scale_k)
+        return 0;
+    if (!row_bytes || !capacity || capacity >= 0xFFFFFFFFull || connectivity < 2 || !expansion)
+        return 0;
+    index->kernel = simsimd_metric_punned(metric, datatype, simsimd_cap_any_k);
+    if (!index->kernel)
+        return 0;
+    index->metric = metric;
+    index->datatype = datatype;
+    index->sign = metric == simsimd_metric_dot_k ? -1 : 1;
+    index->dimensions = dimensions;
+    index->stride = (row_bytes + alignment - 1) / alignment * alignment;
+    index->node_bytes = index->stride + (1 + 2 * connectivity) * sizeof(simsimd_u32_t);
+    index->node_bytes = (index->node_bytes + alignment - 1) / alignment * alignment;
+    index->connectivity = connectivity;
+    index->expansion = expansion;
+    index->capacity = capacity;
+    index->entry = (simsimd_size_t)-1;
+    index->nodes = (simsimd_b8_t*)simsimd_aligned_alloc(capacity * index->node_bytes);
+    index->upper_links = (simsimd_u32_t**)calloc(capacity, sizeof(simsimd_u32_t*));
+    index->locks = (char*)calloc(capacity, 1);
+    if (!index->nodes || !index->upper_links || !index->locks) {
+        simsimd_aligned_free(index->nodes);
+        free(index->upper_links);
+        free(index->locks);
+        memset(index, 0, sizeof(simsimd_hnsw_index_t));
+        return 0;
+    }
+    return 1;
+}
+
+/**
+ *  @brief  Releases the memory owned by the graph. Must not be called concurrently with other operations.
+ */
+SIMSIMD_PUBLIC void simsimd_hnsw_index_free(simsimd_hnsw_index_t* index) {
+    for (simsimd_size_t i = 0; index->upper_links && i != index->count; ++i)
+        free(index->upper_links[i]);
+    simsimd_aligned_free(index->nodes);
+    free(index->upper_links);
+    free(index->locks);
+    index->nodes = 0, index->upper_links = 0, index->locks = 0;
+    index->count = 0, index->entry = (simsimd_size_t)-1, index->max_level = 0;
+}
+
+/**
+ *  @brief  Returns the adjacency list of a node on the given level, starting with the number of neighbors.
+ */
+SIMSIMD_INTERNAL simsimd_u32_t* simsimd_hnsw_links(simsimd_hnsw_index_t const* index, simsimd_size_t id,
+                                                   simsimd_size_t level) {
+    if (!level)
+        return (simsimd_u32_t*)(index->nodes + id * index->node_bytes + index->stride);
+    return index->upper_links[id] + (level - 1) * (1 + index->connectivity);
+}
+
+SIMSIMD_INTERNAL simsimd_distance_t simsimd_hnsw_distance(simsimd_hnsw_index_t const* index, void const* a,
+                                                          simsimd_size_t id) {
+    simsimd_distance_t distance;
+    index->kernel(a, index->nodes + id * index->node_bytes, index->dimensions, &distance);
+    return index->sign * distance;
+}
+
+/**
+ *  @brief  Scratch space of a single search: the sorted beam of candidates, the set of visited nodes, and
+ *          the batch of neighbors scored together.
+ */
+typedef struct simsimd_hnsw_search_t {
+    simsimd_distance_t* distances;       ///< Distances of the beam candidates, sorted in ascending order
+    simsimd_u32_t* ids;                  ///< Identifiers of the beam candidates
+    simsimd_b8_t* expanded;              ///< Flags of the beam candidates, that were already expanded
+    simsimd_size_t size;                 ///< Number of candidates in the beam
+    simsimd_size_t ef;                   ///< Maximum number of candidates in the beam
+    simsimd_u32_t* batch;                ///< Neighbors of the expanded node, up to `2 * connectivity + 1`
+    simsimd_distance_t* batch_distances; ///< Distances to the neighbors in the `batch`
+    simsimd_u32_t* neighbors;            ///< Neighbors selected for a new node, up to `2 * connectivity`
+    simsimd_u32_t* visited;              ///< Open-addressing hash-set of visited nodes, with `UINT32_MAX` for empty
+    simsimd_size_t visited_capacity;     ///< Number of slots in the hash-set, a power of two
+    simsimd_size_t visited_count;        ///< Number of occupied slots in the hash-set
+} simsimd_hnsw_search_t;
+
+SIMSIMD_PUBLIC void simsimd_hnsw_search_free(simsimd_hnsw_search_t* search) {
+    free(search->distances);
+    free(search->ids);
+    free(search->expanded);
+    free(search->batch);
+    free(search->batch_distances);
+    free(search->neighbors);
+    free(search->visited);
+}
+
+SIMSIMD_PUBLIC int simsimd_hnsw_search_init(simsimd_hnsw_search_t* search, simsimd_hnsw_index_t const* index,
+                                            simsimd_size_t ef) {
+    simsimd_size_t const batch = 2 * index->connectivity + 1;
+    memset(search, 0, sizeof(simsimd_hnsw_search_t));
+    search->ef = ef;
+    search->distances = (simsimd_distance_t*)malloc(ef * sizeof(simsimd_distance_t));
+    search->ids = (simsimd_u32_t*)malloc(ef * sizeof(simsimd_u32_t));
+    search->expanded = (simsimd_b8_t*)malloc(ef);
+    search->batch = (simsimd_u32_t*)malloc(batch * sizeof(simsimd_u32_t));
+    search->batch_distances = (simsimd_distance_t*)malloc(batch * sizeof(simsimd_distance_t));
+    search->neighbors = (simsimd_u32_t*)malloc(batch * sizeof(simsimd_u32_t));
+    for (search->visited_capacity = 256; search->visited_capacity < 4 * ef; search->visited_capacity *= 2)
+        ;
+    search->visited = (simsimd_u32_t*)malloc(search->visited_capacity * sizeof(simsimd_u32_t));
+    if (search->distances && search->ids && search->expanded && search->batch && search->batch_distances &&
+        search->neighbors && search->visited)
+        return 1;
+    simsimd_hnsw_search_free(search);
+    return 0;
+}
+
+SIMSIMD_INTERNAL int simsimd_hnsw_visited_insert(simsimd_u32_t* visited, simsimd_size_t capacity, simsimd_u32_t id) {
+    simsimd_size_t const mask = capacity - 1;
+    simsimd_size_t slot = (simsimd_size_t)(id * 2654435761u) & mask;
+    for (; visited[slot] != 0xFFFFFFFFu; slot = (slot + 1) & mask)
+        if (visited[slot] == id)
+            return 0;
+    visited[slot] = id;
+    return 1;
+}
+
+/**
+ *  @brief  Marks the node as visited, growing the hash-set to keep it at most half full.
+ *  @return 1 if the node wasn't visited before, 0 if it was, and -1 if growing the hash-set failed.
+ */
+SIMSIMD_PUBLIC int simsimd_hnsw_visit(simsimd_hnsw_search_t* search, simsimd_u32_t id) {
+    if ((search->visited_count + 1) * 2 > search->visited_capacity) {
+        simsimd_size_t const capacity = search->visited_capacity * 2;
+        simsimd_u32_t* visited = (simsimd_u32_t*)malloc(capacity * sizeof(simsimd_u32_t));
+        if (!visited)
+            return -1;
+        memset(visited, 0xFF, capacity * sizeof(simsimd_u32_t));
+        for (simsimd_size_t i = 0; i != search->visited_capacity; ++i)
+            if (search->visited[i] != 0xFFFFFFFFu)
+                simsimd_hnsw_visited_insert(visited, capacity, search->visited[i]);
+        free(search->visited);
+        search->visited = visited, search->visited_capacity = capacity;
+    }
+    int const inserted = simsimd_hnsw_visited_insert(search->visited, search->visited_capacity, id);
+    search->visited_count += inserted;
+    return inserted;
+}
+
+/**
+ *  @brief  Inserts a candidate into the sorted beam, dropping the farthest one if the beam is full.
+ */
+SIMSIMD_INTERNAL void simsimd_hnsw_beam_push(simsimd_hnsw_search_t* search, simsimd_distance_t distance,
+                                             simsimd_u32_t id) {
+    simsimd_size_t i = search->size;
+    if (i == search->ef) {
+        if (distance >= search->distances[i - 1])
+            return;
+        --i;
+    }
+    else
+        ++search->size;
+    for (; i && search->distances[i - 1] > distance; --i) {
+        search->distances[i] = search->distances[i - 1];
+        search->ids[i] = search->ids[i - 1];
+        search->expanded[i] = search->expanded[i - 1];
+    }
+    search->distances[i] = distance, search->ids[i] = id, search->expanded[i] = 0;
+}
+
+/**
+ *  @brief  Beam search on a single level of the graph, starting from the `entry` node, and leaving up to
+ *          `search->ef` nearest nodes in the beam.
+ *  @return Non-zero on success, zero if the allocation failed.
+ */
+SIMSIMD_PUBLIC int simsimd_hnsw_search_level(simsimd_hnsw_index_t const* index, simsimd_hnsw_search_t* search,
+                                             void const* query, simsimd_size_t entry,
+                                             simsimd_distance_t entry_distance, simsimd_size_t level) {
+    memset(search->visited, 0xFF, search->visited_capacity * sizeof(simsimd_u32_t));
+    search->visited_count = 0, search->size = 0;
+    simsimd_hnsw_visit(search, (simsimd_u32_t)entry);
+    simsimd_hnsw_beam_push(search, entry_distance, (simsimd_u32_t)entry);
+    for (;;) {
+        simsimd_size_t i = 0;
+        while (i != search->size && search->expanded[i])
+            ++i;
+        if (i == search->size)
+            return 1;
+        search->expanded[i] = 1;
+
+        // Copy the neighbors under the lock, keeping only the unvisited ones
+        simsimd_size_t const node = search->ids[i];
+        simsimd_size_t count = 0;
+        simsimd_spin_lock(&index->locks[node]);
+        simsimd_u32_t const* links = simsimd_hnsw_links(index, node, level);
+        for (simsimd_u32_t j = 0; j != links[0]; ++j)
+            search->batch[count++] = links[1 + j];
+        simsimd_spin_unlock(&index->locks[node]);
+        simsimd_size_t unvisited = 0;
+        for (simsimd_size_t j = 0; j != count; ++j) {
+            int visit = simsimd_hnsw_visit(search, search->batch[j]);
+            if (visit < 0)
+                return 0;
+            if (visit)
+                search->batch[unvisited++] = search->batch[j];
+        }
+
+        simsimd_gather_punned(index->kernel, query, index->nodes, index->node_bytes, search->batch, unvisited,
+                              index->dimensions, index->stride, search->batch_distances);
+        for (simsimd_size_t j = 0; j != unvisited; ++j)
+            simsimd_hnsw_beam_push(search, index->sign * search->batch_distances[j], search->batch[j]);
+    }
+}
+
+/**
+ *  @brief  Selects up to `max` diverse neighbors from `count` candidates sorted by ascending distance, skipping
+ *          the candidates that are closer to an already selected neighbor than to the base node.
+ *  @return The number of selected neighbors, exported into `selected`.
+ */
+SIMSIMD_PUBLIC simsimd_u32_t simsimd_hnsw_select(simsimd_hnsw_index_t const* index, simsimd_u32_t const* ids,
+                                                 simsimd_distance_t const* distances, simsimd_size_t count,
+                                                 simsimd_size_t max, simsimd_u32_t* selected) {
+    simsimd_u32_t kept = 0;
+    for (simsimd_size_t i = 0; i != count && kept != max; ++i) {
+        void const* candidate = index->nodes + ids[i] * index->node_bytes;
+        int diverse = 1;
+        for (simsimd_u32_t j = 0; j != kept && diverse; ++j)
+            diverse = simsimd_hnsw_distance(index, candidate, selected[j]) >= distances[i];
+        if (diverse)
+            selected[kept++] = ids[i];
+    }
+    return kept;
+}
+
+/**
+ *  @brief  Adds the `id` to the neighbors of the `neighbor` node on the given level, re-selecting the neighbors
+ *          if the adjacency list is full.
+ */
+SIMSIMD_PUBLIC void simsimd_hnsw_connect(simsimd_hnsw_index_t* index, simsimd_hnsw_search_t* search,
+                                         simsimd_size_t neighbor, simsimd_u32_t id, simsimd_distance_t distance,
+                                         simsimd_size_t level) {
+    simsimd_size_t const max = level ? index->connectivity : 2 * index->connectivity;
+    void const* vector = index->nodes + neighbor * index->node_bytes;
+    simsimd_spin_lock(&index->locks[neighbor]);
+    simsimd_u32_t* links = simsimd_hnsw_links(index, neighbor, level);
+    if (links[0] < max)
+        links[1 + links[0]++] = id;
+    else {
+        // Sort the current neighbors and the new one by the distance to the `neighbor` node
+        simsimd_size_t count = 0;
+        for (simsimd_size_t j = 0; j != links[0] + 1; ++j) {
+            simsimd_u32_t candidate = j == links[0] ? id : links[1 + j];
+            simsimd_distance_t candidate_distance =
+                j == links[0] ? distance : simsimd_hnsw_distance(index, vector, candidate);
+            simsimd_size_t i = count++;
+            for (; i && search->batch_distances[i - 1] > candidate_distance; --i)
+                search->batch[i] = search->batch[i - 1], search->batch_distances[i] = search->batch_distances[i - 1];
+            search->batch[i] = candidate, search->batch_distances[i] = candidate_distance;
+        }
+        links[0] = simsimd_hnsw_select(index, search->batch, search->batch_distances, count, max, links + 1);
+    }
+    simsimd_spin_unlock(&index->locks[neighbor]);
+}
+
+/**
+ *  @brief  Links a node with a reserved identifier into the graph. Safe to call concurrently.
+ *  @return Non-zero on success, zero if the allocation failed.
+ */
+SIMSIMD_PUBLIC int simsimd_hnsw_insert(simsimd_hnsw_index_t* index, void const* vector, simsimd_size_t id) {
+    simsimd_size_t const row_bytes = index->dimensions * simsimd_datatype_bytes(index->datatype);
+    simsimd_b8_t* node = index->nodes + id * index->node_bytes;
+    memcpy(node, vector, row_bytes);
+
+    // Draw the level from a geometric distribution with a deterministic hash of the identifier
+    simsimd_u64_t hash = (simsimd_u64_t)id + 0x9E3779B97F4A7C15ull;
+    hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ull;
+    hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBull;
+    hash ^= hash >> 31;
+    simsimd_size_t level = 0;
+    for (; level != 15 && hash % index->connectivity == 0; hash /= index->connectivity)
+        ++level;
+    if (level) {
+        index->upper_links[id] = (simsimd_u32_t*)calloc(level * (1 + index->connectivity), sizeof(simsimd_u32_t));
+        if (!index->upper_links[id])
+            return 0;
+    }
+
+    // The first node becomes the entry point, and the others only take the global lock to read it
+    simsimd_spin_lock(&index->lock);
+    simsimd_size_t entry = index->entry;
+    simsimd_size_t const max_level = index->max_level;
+    if (entry == (simsimd_size_t)-1)
+        index->entry = id, index->max_level = level;
+    simsimd_spin_unlock(&index->lock);
+    if (entry == (simsimd_size_t)-1)
+        return 1;
+
+    simsimd_hnsw_search_t search;
+    if (!simsimd_hnsw_search_init(&search, index, index->expansion))
+        return 0;
+    int success = 1;
+    simsimd_distance_t entry_distance = simsimd_hnsw_distance(index, node, entry);
+    simsimd_size_t const ef = search.ef;
+    search.ef = 1;
+    for (simsimd_size_t l = max_level; l > level && success; --l) {
+        success = simsimd_hnsw_search_level(index, &search, node, entry, entry_distance, l);
+        entry = search.ids[0], entry_distance = search.distances[0];
+    }
+    search.ef = ef;
+    for (simsimd_size_t l = level < max_level ? level : max_level; l != (simsimd_size_t)-1 && success; --l) {
+        success = simsimd_hnsw_search_level(index, &search, node, entry, entry_distance, l);
+        if (!success)
+            break;
+        entry = search.ids[0], entry_distance = search.distances[0];
+
+        // Pick the diverse neighbors for the new node, and add the reverse links
+        simsimd_size_t const max = l ? index->connectivity : 2 * index->connectivity;
+        simsimd_u32_t const count = simsimd_hnsw_select(index, search.ids, search.distances, search.size, max,
+                                                        search.neighbors);
+        simsimd_spin_lock(&index->locks[id]);
+        simsimd_u32_t* links = simsimd_hnsw_links(index, id, l);
+        memcpy(links + 1, search.neighbors, count * sizeof(simsimd_u32_t));
+        links[0] = count;
+        simsimd_spin_unlock(&index->locks[id]);
+        for (simsimd_u32_t j = 0; j != count; ++j) {
+            simsimd_size_t const neighbor = search.neighbors[j];
+            simsimd_distance_t distance = 0;
+            for (simsimd_size_t i = 0; i != search.size; ++i)
+                if (search.ids[i] == neighbor)
+                    distance = search.distances[i];
+            simsimd_hnsw_connect(index, &search, neighbor, (simsimd_u32_t)id, distance, l);
+        }
+    }
+    simsimd_hnsw_search_free(&search);
+
+    // Taller nodes replace the entry point once linked, unless an even taller one was inserted meanwhile
+    if (success && level > max_level) {
+        simsimd_spin_lock(&index->lock);
+        if (level > index->max_level)
+            index->entry = id, index->max_level = level;
+        simsimd_spin_unlock(&index->lock);
+    }
+    return success;
+}
+
+/**
+ *  @brief  Appends `count` contiguous vectors, assigning them consecutive identifiers starting from `index->count`.
+ *          Vectors are inserted in parallel with OpenMP, if enabled. Safe to call concurrently with other
+ *          insertions and searches.
+ *  @return Non-zero on success, zero if the capacity is exhausted or the allocation failed.
+ */
+SIMSIMD_PUBLIC int simsimd_hnsw_index_add(simsimd_hnsw_index_t* index, void const* vectors, simsimd_size_t count) {
+    simsimd_size_t const row_bytes = index->dimensions * simsimd_datatype_bytes(index->datatype);
+    simsimd_spin_lock(&index->lock);
+    simsimd_size_t const first = index->count;
+    int const fits = index->capacity - first >= count;
+    if (fits)
+        index->count += count;
+    simsimd_spin_unlock(&index->lock);
+    if (!fits)
+        return 0;
+
+    int failed = 0;
+    long long const count_signed = (long long)count;
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic, 1) reduction(| : failed)
+#endif
+    for (long long i = 0; i < count_signed; ++i)
+        failed |= !simsimd_hnsw_insert(index, (simsimd_b8_t const*)vectors + i * row_bytes, first + i);
+    return !failed;
+}
+
+/**
+ *  @brief  Searches the approximate `k` nearest vectors for each of the `queries_count` contiguous queries,
+ *          tracking `ef` candidates on the base level, or `k` if it's larger. The results of query `i` are
+ *          exported into `ids + i * k` and `distances + i * k`, sorted like in `simsimd_flat_index_search`.
+ *          If fewer than `k` vectors are found, the remaining identifiers are set to `(simsimd_size_t)-1`.
+ *          Queries are processed in parallel with OpenMP, if enabled.
+ *
+ *  @return Non-zero on success, zero if the allocation failed.
+ */
+SIMSIMD_PUBLIC int simsimd_hnsw_index_search(simsimd_hnsw_index_t* index, void const* queries,
+                                             simsimd_size_t queries_count, simsimd_size_t ef, simsimd_size_t k,
+                                             simsimd_size_t* ids, simsimd_distance_t* distances) {
+    simsimd_size_t const row_bytes = index->dimensions * simsimd_datatype_bytes(index->datatype);
+    int failed = 0;
+    long long const queries_signed = (long long)queries_count;
+    if (ef < k)
+        ef = k;
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic, 1) reduction(| : failed)
+#endif
+    for (long long q = 0; q < queries_signed; ++q) {
+        void const* query = (simsimd_b8_t const*)queries + q * row_bytes;
+        simsimd_size_t* query_ids = ids + q * k;
+        simsimd_distance_t* query_distances = distances + q * k;
+        simsimd_size_t found = 0;
+        simsimd_hnsw_search_t search;
+        simsimd_spin_lock(&index->lock);
+        simsimd_size_t entry = index->entry;
+        simsimd_size_t const max_level = index->max_level;
+        simsimd_spin_unlock(&index->lock);
+        if (entry != (simsimd_size_t)-1 && simsimd_hnsw_search_init(&search, index, ef)) {
+            int success = 1;
+            simsimd_distance_t entry_distance = simsimd_hnsw_distance(index, query, entry);
+            search.ef = 1;
+            for (simsimd_size_t l = max_level; l && success; --l) {
+                success = simsimd_hnsw_search_level(index, &search, query, entry, entry_distance, l);
+                entry = search.ids[0], entry_distance = search.distances[0];
+            }
+            search.ef = ef;
+            success = success && simsimd_hnsw_search_level(index, &search, query, entry, entry_distance, 0);
+            for (; success && found != k && found != search.size; ++found)
+                query_ids[found] = search.ids[found], query_distances[found] = index->sign * search.distances[found];
+            failed |= !success;
+            simsimd_hnsw_search_free(&search);
+        }
+        else
+            failed |= entry != (simsimd_size_t)-1;
+        for (simsimd_size_t j = found; j < k; ++j)
+            query_ids[j] = (simsimd_size_t)-1, query_distances[j] = index->sign * DBL_MAX;
+    }
+    return !failed;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SIMSIMD_INDEX_H
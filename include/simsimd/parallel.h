@@ -0,0 +1,714 @@
+/**
+ *  @file       parallel.h
+ *  @brief      Dependency-free work-stealing thread pool and parallel batch kernels on top of it.
+ *  @date       October 17, 2026
+ *
+ *  Contains:
+ *  - Executor interface, that lets the caller plug in any thread pool
+ *  - Work-stealing thread pool, using POSIX or Windows threads
+ *  - Parallel many-to-many distance matrices, blocked into tiles sized for the detected caches
+ *  - Parallel symmetric all-pairs distance matrices, evaluating only the upper triangle
+ *  - Parallel exact top-k search over contiguous rows
+ *
+ *  Unlike OpenMP, the pool is an explicit object with a caller-controlled number of threads, so the same kernels
+ *  can be parallelized from any language binding. Every parallel kernel splits its work into tile-sized tasks and
+ *  passes them to a `simsimd_executor_t`, being either `simsimd_pool_run` with a pool, `simsimd_serial_run`,
+ *  or a callback of the caller's own scheduler, like a Rust or Go runtime.
+ *  Like `index.h`, this header spawns threads and allocates memory, so it has to be included explicitly.
+ */
+#ifndef SIMSIMD_PARALLEL_H
+#define SIMSIMD_PARALLEL_H
+
+#include "index.h"
+
+#if defined(_WIN32)
+#include <windows.h> // `CreateThread`, `SRWLOCK`, `CONDITION_VARIABLE`
+#else
+#include <pthread.h> // `pthread_create`, `pthread_mutex_t`, `pthread_cond_t`
+#include <unistd.h>  // `sysconf`
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *  @brief  A single task of a parallel job, receiving the shared `context` and the index of the task.
+ */
+typedef void (*simsimd_task_t)(void* context, simsimd_size_t task);
+
+/**
+ *  @brief  Runs `tasks` calls of `task(context, i)` for every `i` in `[0, tasks)`, in any order and on any threads,
+ *          returning only when all of them are done. The `executor` is the state of the scheduler, like a pool.
+ */
+typedef void (*simsimd_executor_t)(void* executor, simsimd_size_t tasks, simsimd_task_t task, void* context);
+
+/**
+ *  @brief  Executor, that runs all tasks on the calling thread. Used when no executor is passed.
+ */
+SIMSIMD_PUBLIC void simsimd_serial_run(void* executor, simsimd_size_t tasks, simsimd_task_t task, void* context) {
+    (void)executor;
+    for (simsimd_size_t i = 0; i != tasks; ++i)
+        task(context, i);
+}
+
+/*  Compare-and-swap primitives for the packed task ranges, mirroring `simsimd_spin_lock` in `index.h`.
+ *  Without compiler support for atomics, pools are limited to the calling thread.
+ */
+#if defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER)
+#define SIMSIMD_POOL_ATOMICS 1
+#else
+#define SIMSIMD_POOL_ATOMICS 0
+#endif
+
+SIMSIMD_INTERNAL simsimd_u64_t simsimd_pool_load(simsimd_u64_t* range) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __atomic_load_n(range, __ATOMIC_ACQUIRE);
+#elif defined(_MSC_VER)
+    return (simsimd_u64_t)_InterlockedCompareExchange64((long long volatile*)range, 0, 0);
+#else
+    return *range;
+#endif
+}
+
+SIMSIMD_INTERNAL int simsimd_pool_swap(simsimd_u64_t* range, simsimd_u64_t expected, simsimd_u64_t desired) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __atomic_compare_exchange_n(range, &expected, desired, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+#elif defined(_MSC_VER)
+    return (simsimd_u64_t)_InterlockedCompareExchange64((long long volatile*)range, (long long)desired,
+                                                        (long long)expected) == expected;
+#else
+    return *range == expected ? (*range = desired, 1) : 0;
+#endif
+}
+
+/**
+ *  @brief  Number of 64-bit words between the task ranges of different threads, keeping them on separate
+ *          cache lines, so that popping tasks doesn't cause false sharing.
+ */
+#define SIMSIMD_POOL_RANGE_STRIDE (8)
+
+/**
+ *  @brief  Work-stealing thread pool. Every job is split into one contiguous range of tasks per thread. Threads
+ *          pop tasks from the front of their own ranges, and once those are exhausted, steal the back halves of
+ *          the ranges of other threads. The calling thread participates in every job, as the thread number zero.
+ */
+typedef struct simsimd_pool_t {
+    simsimd_size_t threads;     ///< Number of threads, including the calling one
+    simsimd_u64_t* ranges;      ///< Per-thread `[begin, end)` task ranges, packed into the upper and lower halves
+    simsimd_task_t task;        ///< Task of the current job
+    void* context;              ///< Context of the current job
+    simsimd_size_t generation;  ///< Number of started jobs, incremented to wake up the workers
+    simsimd_size_t finished;    ///< Number of background threads, that are done with the current job
+    int stop;                   ///< Set on destruction, to make the background threads exit
+    struct simsimd_pool_worker_t* workers;
+#if defined(_WIN32)
+    SRWLOCK lock;
+    CONDITION_VARIABLE wake, done;
+#else
+    pthread_mutex_t lock;
+    pthread_cond_t wake, done;
+#endif
+} simsimd_pool_t;
+
+typedef struct simsimd_pool_worker_t {
+    simsimd_pool_t* pool;
+    simsimd_size_t thread;
+#if defined(_WIN32)
+    HANDLE handle;
+#else
+    pthread_t handle;
+#endif
+} simsimd_pool_worker_t;
+
+/**
+ *  @brief  Returns the number of logical cores available to the process.
+ */
+SIMSIMD_PUBLIC simsimd_size_t simsimd_pool_cores(void) {
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (simsimd_size_t)info.dwNumberOfProcessors;
+#else
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    return cores > 0 ? (simsimd_size_t)cores : 1;
+#endif
+}
+
+/**
+ *  @brief  Executes tasks of the current job on the given thread, until its own range is empty and there is
+ *          nothing left to steal. A thief takes the back half of a victim's range, or the last task of it.
+ */
+SIMSIMD_PUBLIC void simsimd_pool_work(simsimd_pool_t* pool, simsimd_size_t thread) {
+    simsimd_u64_t* own = pool->ranges + thread * SIMSIMD_POOL_RANGE_STRIDE;
+    for (;;) {
+        simsimd_u64_t range = simsimd_pool_load(own);
+        simsimd_u64_t begin = range >> 32, end = range & 0xFFFFFFFFull;
+        if (begin < end) {
+            if (simsimd_pool_swap(own, range, ((begin + 1) << 32) | end))
+                pool->task(pool->context, (simsimd_size_t)begin);
+            continue;
+        }
+
+        // Sweep the other threads, starting from the next one, to spread the thieves across victims
+        int contended = 0, stolen = 0;
+        for (simsimd_size_t i = 1; i < pool->threads && !stolen; ++i) {
+            simsimd_u64_t* victim = pool->ranges + (thread + i) % pool->threads * SIMSIMD_POOL_RANGE_STRIDE;
+            simsimd_u64_t victim_range = simsimd_pool_load(victim);
+            simsimd_u64_t victim_begin = victim_range >> 32, victim_end = victim_range & 0xFFFFFFFFull;
+            if (victim_begin >= victim_end)
+                continue;
+            simsimd_u64_t middle = victim_begin + (victim_end - victim_begin) / 2;
+            if (simsimd_pool_swap(victim, victim_range, (victim_begin << 32) | middle)) {
+                // Only the owner refills its range, so it can't change between the check above and this swap
+                simsimd_pool_swap(own, range, (middle << 32) | victim_end);
+                stolen = 1;
+            }
+            else
+                contended = 1;
+        }
+        if (!stolen && !contended)
+            return;
+    }
+}
+
+#if defined(_WIN32)
+SIMSIMD_PUBLIC DWORD WINAPI simsimd_pool_loop(LPVOID argument) {
+#else
+SIMSIMD_PUBLIC void* simsimd_pool_loop(void* argument) {
+#endif
+    simsimd_pool_worker_t* worker = (simsimd_pool_worker_t*)argument;
+    simsimd_pool_t* pool = worker->pool;
+    simsimd_size_t seen = 0;
+#if defined(_WIN32)
+    AcquireSRWLockExclusive(&pool->lock);
+    for (;;) {
+        while (pool->generation == seen && !pool->stop)
+            SleepConditionVariableSRW(&pool->wake, &pool->lock, INFINITE, 0);
+        if (pool->stop)
+            break;
+        seen = pool->generation;
+        ReleaseSRWLockExclusive(&pool->lock);
+        simsimd_pool_work(pool, worker->thread);
+        AcquireSRWLockExclusive(&pool->lock);
+        if (++pool->finished == pool->threads - 1)
+            WakeConditionVariable(&pool->done);
+    }
+    ReleaseSRWLockExclusive(&pool->lock);
+    return 0;
+#else
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        while (pool->generation == seen && !pool->stop)
+            pthread_cond_wait(&pool->wake, &pool->lock);
+        if (pool->stop)
+            break;
+        seen = pool->generation;
+        pthread_mutex_unlock(&pool->lock);
+        simsimd_pool_work(pool, worker->thread);
+        pthread_mutex_lock(&pool->lock);
+        if (++pool->finished == pool->threads - 1)
+            pthread_cond_signal(&pool->done);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return 0;
+#endif
+}
+
+/**
+ *  @brief  Releases the pool, waiting for its background threads to exit. Safe to call on a failed `init`.
+ */
+SIMSIMD_PUBLIC void simsimd_pool_free(simsimd_pool_t* pool) {
+    simsimd_size_t const workers = pool->threads ? pool->threads - 1 : 0;
+    if (pool->workers) {
+#if defined(_WIN32)
+        AcquireSRWLockExclusive(&pool->lock);
+        pool->stop = 1;
+        WakeAllConditionVariable(&pool->wake);
+        ReleaseSRWLockExclusive(&pool->lock);
+        for (simsimd_size_t i = 0; i != workers; ++i)
+            if (pool->workers[i].handle)
+                WaitForSingleObject(pool->workers[i].handle, INFINITE), CloseHandle(pool->workers[i].handle);
+#else
+        pthread_mutex_lock(&pool->lock);
+        pool->stop = 1;
+        pthread_cond_broadcast(&pool->wake);
+        pthread_mutex_unlock(&pool->lock);
+        for (simsimd_size_t i = 0; i != workers; ++i)
+            pthread_join(pool->workers[i].handle, NULL);
+        pthread_mutex_destroy(&pool->lock);
+        pthread_cond_destroy(&pool->wake);
+        pthread_cond_destroy(&pool->done);
+#endif
+    }
+    free(pool->workers);
+    simsimd_aligned_free(pool->ranges);
+    memset(pool, 0, sizeof(simsimd_pool_t));
+}
+
+/**
+ *  @brief  Initializes a pool of `threads` threads, including the calling one, or of all available cores
+ *          if `threads` is zero. A single-threaded pool spawns nothing, and runs all tasks on the caller.
+ *  @return Non-zero on success, zero if the allocation or the creation of a thread failed.
+ */
+SIMSIMD_PUBLIC int simsimd_pool_init(simsimd_pool_t* pool, simsimd_size_t threads) {
+    memset(pool, 0, sizeof(simsimd_pool_t));
+    if (!threads)
+        threads = simsimd_pool_cores();
+    if (!SIMSIMD_POOL_ATOMICS)
+        threads = 1;
+    pool->ranges = (simsimd_u64_t*)simsimd_aligned_alloc(threads * SIMSIMD_POOL_RANGE_STRIDE * sizeof(simsimd_u64_t));
+    if (!pool->ranges)
+        return 0;
+    pool->threads = 1;
+    if (threads == 1)
+        return 1;
+
+    pool->workers = (simsimd_pool_worker_t*)calloc(threads - 1, sizeof(simsimd_pool_worker_t));
+    if (!pool->workers) {
+        simsimd_pool_free(pool);
+        return 0;
+    }
+#if defined(_WIN32)
+    InitializeSRWLock(&pool->lock);
+    InitializeConditionVariable(&pool->wake);
+    InitializeConditionVariable(&pool->done);
+#else
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->wake, NULL);
+    pthread_cond_init(&pool->done, NULL);
+#endif
+    // Count the threads as they are spawned, so a failure releases only the created ones
+    for (simsimd_size_t i = 0; i != threads - 1; ++i) {
+        simsimd_pool_worker_t* worker = &pool->workers[i];
+        worker->pool = pool, worker->thread = i + 1;
+#if defined(_WIN32)
+        worker->handle = CreateThread(NULL, 0, simsimd_pool_loop, worker, 0, NULL);
+        int created = worker->handle != NULL;
+#else
+        int created = pthread_create(&worker->handle, NULL, simsimd_pool_loop, worker) == 0;
+#endif
+        if (!created) {
+            simsimd_pool_free(pool);
+            return 0;
+        }
+        pool->threads = i + 2;
+    }
+    return 1;
+}
+
+/**
+ *  @brief  Executor over a `simsimd_pool_t`, splitting the tasks evenly between its threads, and letting them steal
+ *          from each other. Tasks must not call back into the same pool. Jobs of over 4 billion tasks run serially.
+ */
+SIMSIMD_PUBLIC void simsimd_pool_run(void* executor, simsimd_size_t tasks, simsimd_task_t task, void* context) {
+    simsimd_pool_t* pool = (simsimd_pool_t*)executor;
+    simsimd_size_t const threads = pool->threads;
+    if (threads <= 1 || tasks <= 1 || tasks > 0xFFFFFFFFull) {
+        simsimd_serial_run(executor, tasks, task, context);
+        return;
+    }
+    pool->task = task, pool->context = context;
+    for (simsimd_size_t t = 0; t != threads; ++t) {
+        simsimd_u64_t begin = tasks * t / threads, end = tasks * (t + 1) / threads;
+        pool->ranges[t * SIMSIMD_POOL_RANGE_STRIDE] = (begin << 32) | end;
+    }
+
+    // Publish the job under the lock, so the workers observe the ranges once they wake up
+#if defined(_WIN32)
+    AcquireSRWLockExclusive(&pool->lock);
+    pool->finished = 0, ++pool->generation;
+    WakeAllConditionVariable(&pool->wake);
+    ReleaseSRWLockExclusive(&pool->lock);
+    simsimd_pool_work(pool, 0);
+    AcquireSRWLockExclusive(&pool->lock);
+    while (pool->finished != threads - 1)
+        SleepConditionVariableSRW(&pool->done, &pool->lock, INFINITE, 0);
+    ReleaseSRWLockExclusive(&pool->lock);
+#else
+    pthread_mutex_lock(&pool->lock);
+    pool->finished = 0, ++pool->generation;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+    simsimd_pool_work(pool, 0);
+    pthread_mutex_lock(&pool->lock);
+    while (pool->finished != threads - 1)
+        pthread_cond_wait(&pool->done, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+#endif
+}
+
+/**
+ *  @brief  Number of rows scanned by every task of `simsimd_topk_parallel` is the square of `SIMSIMD_PARALLEL_TILE`.
+ */
+#ifndef SIMSIMD_PARALLEL_TILE
+#define SIMSIMD_PARALLEL_TILE (64)
+#endif
+
+/**
+ *  @brief  Minimum number of tasks `simsimd_cdist_tiles` splits a matrix into, shrinking the cache-sized tiles
+ *          if needed, so that the threads can balance the load of small matrices.
+ */
+#ifndef SIMSIMD_PARALLEL_TASKS
+#define SIMSIMD_PARALLEL_TASKS (256)
+#endif
+
+#if SIMSIMD_TARGET_X86
+SIMSIMD_INTERNAL void simsimd_cpuid(unsigned leaf, unsigned subleaf, unsigned registers[4]) {
+#if defined(_MSC_VER)
+    __cpuidex((int*)registers, (int)leaf, (int)subleaf);
+#else
+    __asm__ __volatile__("cpuid"
+                         : "=a"(registers[0]), "=b"(registers[1]), "=c"(registers[2]), "=d"(registers[3])
+                         : "a"(leaf), "c"(subleaf));
+#endif
+}
+
+/**
+ *  @brief  Enumerates the "Deterministic Cache Parameters" of CPUID, exposed in leaf 4 on Intel,
+ *          and in leaf 0x8000001D on AMD, outputting the size of the data or unified cache of every level.
+ *  @return Non-zero if the leaf is supported and describes at least one cache.
+ */
+SIMSIMD_INTERNAL int simsimd_cpuid_caches(unsigned leaf, simsimd_size_t* l2, simsimd_size_t* l3) {
+    unsigned registers[4];
+    simsimd_cpuid(leaf & 0x80000000u, 0, registers);
+    if (registers[0] < leaf)
+        return 0;
+    int found = 0;
+    for (unsigned subleaf = 0; subleaf != 16; ++subleaf) {
+        simsimd_cpuid(leaf, subleaf, registers);
+        unsigned const type = registers[0] & 0x1F, level = (registers[0] >> 5) & 0x7;
+        if (!type) // No more caches
+            break;
+        if (type == 2) // Instruction cache
+            continue;
+        simsimd_size_t const ways = (registers[1] >> 22) + 1, partitions = ((registers[1] >> 12) & 0x3FF) + 1;
+        simsimd_size_t const line = (registers[1] & 0xFFF) + 1, sets = (simsimd_size_t)registers[2] + 1;
+        simsimd_size_t const bytes = ways * partitions * line * sets;
+        if (level == 2)
+            *l2 = bytes, found = 1;
+        else if (level == 3)
+            *l3 = bytes, found = 1;
+    }
+    return found;
+}
+#endif
+
+/**
+ *  @brief  Detects the sizes of the L2 cache of a core and the shared L3 cache, using `sysconf` where the C library
+ *          exposes them, and CPUID leaf 4 on x86. Outputs 1 MB and 8 MB if the sizes can't be detected, and
+ *          the L2 size for the L3, if the latter is missing.
+ */
+SIMSIMD_PUBLIC void simsimd_cache_sizes(simsimd_size_t* l2, simsimd_size_t* l3) {
+    *l2 = 0, *l3 = 0;
+#if defined(_SC_LEVEL2_CACHE_SIZE) && defined(_SC_LEVEL3_CACHE_SIZE)
+    long const l2_bytes = sysconf(_SC_LEVEL2_CACHE_SIZE), l3_bytes = sysconf(_SC_LEVEL3_CACHE_SIZE);
+    *l2 = l2_bytes > 0 ? (simsimd_size_t)l2_bytes : 0, *l3 = l3_bytes > 0 ? (simsimd_size_t)l3_bytes : 0;
+#endif
+#if SIMSIMD_TARGET_X86
+    if (!*l2 && !simsimd_cpuid_caches(4, l2, l3))
+        simsimd_cpuid_caches(0x8000001Du, l2, l3);
+#endif
+    if (!*l2)
+        *l2 = 1024 * 1024, *l3 = *l3 ? *l3 : 8 * 1024 * 1024;
+    if (*l3 < *l2)
+        *l3 = *l2;
+}
+
+/**
+ *  @brief  Picks the number of rows in the tiles of `a` and `b` for a many-to-many distance matrix.
+ *          A tile of `b` takes half of the L2 cache, and is reused for every row of the tile of `a`, that takes
+ *          a quarter of the shared L3 cache, and is reused for every tile of `b`. So every row of `b` is fetched
+ *          from memory once per tile of `a`, rather than once per row of `a`.
+ *
+ *  @param row_bytes The size of a single row of `a` or `b` in bytes.
+ *  @param a_tile The output number of rows of `a` per tile.
+ *  @param b_tile The output number of rows of `b` per tile.
+ */
+SIMSIMD_PUBLIC void simsimd_cdist_tiles(simsimd_size_t row_bytes, simsimd_size_t a_count, simsimd_size_t b_count,
+                                        simsimd_size_t* a_tile, simsimd_size_t* b_tile) {
+    simsimd_size_t l2, l3;
+    simsimd_cache_sizes(&l2, &l3);
+    row_bytes = row_bytes ? row_bytes : 1;
+    simsimd_size_t a_rows = l3 / 4 / row_bytes, b_rows = l2 / 2 / row_bytes;
+    a_rows = a_rows < a_count ? a_rows : a_count, b_rows = b_rows < b_count ? b_rows : b_count;
+    a_rows = a_rows ? a_rows : 1, b_rows = b_rows ? b_rows : 1;
+
+    // Halve the larger of the tiles, until there are enough of them to keep all threads busy
+    for (;;) {
+        simsimd_size_t const tiles = ((a_count + a_rows - 1) / a_rows) * ((b_count + b_rows - 1) / b_rows);
+        if (tiles >= SIMSIMD_PARALLEL_TASKS || (a_rows == 1 && b_rows == 1))
+            break;
+        if (a_rows >= b_rows)
+            a_rows = (a_rows + 1) / 2;
+        else
+            b_rows = (b_rows + 1) / 2;
+    }
+    *a_tile = a_rows, *b_tile = b_rows;
+}
+
+typedef struct simsimd_cdist_job_t {
+    simsimd_metric_punned_t kernel;
+    simsimd_b8_t const *a, *b;
+    simsimd_size_t a_count, b_count, n, row_bytes, a_tile, b_tile, b_tiles;
+    simsimd_distance_t* results;
+} simsimd_cdist_job_t;
+
+SIMSIMD_PUBLIC void simsimd_cdist_task(void* context, simsimd_size_t task) {
+    simsimd_cdist_job_t const* job = (simsimd_cdist_job_t const*)context;
+    simsimd_size_t const a_first = task / job->b_tiles * job->a_tile, b_first = task % job->b_tiles * job->b_tile;
+    simsimd_size_t const a_last = a_first + job->a_tile < job->a_count ? a_first + job->a_tile : job->a_count;
+    simsimd_size_t const b_last = b_first + job->b_tile < job->b_count ? b_first + job->b_tile : job->b_count;
+    for (simsimd_size_t i = a_first; i != a_last; ++i)
+        for (simsimd_size_t j = b_first; j != b_last; ++j)
+            job->kernel(job->a + i * job->row_bytes, job->b + j * job->row_bytes, job->n,
+                        job->results + i * job->b_count + j);
+}
+
+/**
+ *  @brief  Computes the row-major `a_count` by `b_count` matrix of distances between the contiguous rows of `a` and
+ *          `b`, split into cache-sized tiles by `simsimd_cdist_tiles`, and scheduled by the `executor`.
+ *          Consecutive tasks share the tile of `a`, so threads popping their task ranges keep it in cache.
+ *
+ *  @param allowed The hardware capabilities allowed for use, like `simsimd_cap_any_k`.
+ *  @param executor The scheduler to run the tiles with, like `simsimd_pool_run`, or NULL to run them serially.
+ *  @param executor_state The state of the scheduler, like a `simsimd_pool_t`.
+ *  @return Non-zero on success, zero if the metric isn't supported for the datatype, or produces complex results.
+ */
+SIMSIMD_PUBLIC int simsimd_cdist_parallel(simsimd_metric_kind_t metric, simsimd_datatype_t datatype,
+                                          simsimd_capability_t allowed, void const* a, simsimd_size_t a_count,
+                                          void const* b, simsimd_size_t b_count, simsimd_size_t n,
+                                          simsimd_distance_t* results, simsimd_executor_t executor,
+                                          void* executor_state) {
+    simsimd_cdist_job_t job;
+    if (datatype >= simsimd_datatype_f64c_k)
+        return 0;
+    job.kernel = simsimd_metric_punned(metric, datatype, allowed);
+    if (!job.kernel)
+        return 0;
+    job.a = (simsimd_b8_t const*)a, job.b = (simsimd_b8_t const*)b;
+    job.a_count = a_count, job.b_count = b_count, job.n = n;
+    job.row_bytes = n * simsimd_datatype_bytes(datatype);
+    simsimd_cdist_tiles(job.row_bytes, a_count, b_count, &job.a_tile, &job.b_tile);
+    job.b_tiles = (b_count + job.b_tile - 1) / job.b_tile;
+    job.results = results;
+    if (!executor)
+        executor = simsimd_serial_run;
+    executor(executor_state, (a_count + job.a_tile - 1) / job.a_tile * job.b_tiles, simsimd_cdist_task, &job);
+    return 1;
+}
+
+typedef struct simsimd_pdist_job_t {
+    simsimd_metric_punned_t kernel; ///< Distance kernel, or the inner product kernel if the `norms` are used
+    simsimd_b8_t const* a;
+    simsimd_size_t count, n, row_bytes, tile, tiles;
+    simsimd_distance_t* norms; ///< Euclidean norms of all rows for the cosine distance, or NULL
+    simsimd_distance_t* results;
+    int mirror;
+} simsimd_pdist_job_t;
+
+SIMSIMD_PUBLIC void simsimd_pdist_norms_task(void* context, simsimd_size_t task) {
+    simsimd_pdist_job_t const* job = (simsimd_pdist_job_t const*)context;
+    simsimd_size_t const first = task * job->tile;
+    simsimd_size_t const last = first + job->tile < job->count ? first + job->tile : job->count;
+    for (simsimd_size_t i = first; i != last; ++i) {
+        simsimd_b8_t const* row = job->a + i * job->row_bytes;
+        job->kernel(row, row, job->n, job->norms + i);
+        job->norms[i] = SIMSIMD_SQRT(job->norms[i]);
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_pdist_task(void* context, simsimd_size_t task) {
+    simsimd_pdist_job_t const* job = (simsimd_pdist_job_t const*)context;
+    simsimd_size_t const tiles = job->tiles, count = job->count;
+
+    // Tiles of the upper triangle are enumerated row by row, and the row `r` starts at `r * tiles - r * (r - 1) / 2`
+    simsimd_size_t low = 0, high = tiles;
+    while (high - low > 1) {
+        simsimd_size_t middle = (low + high) / 2;
+        if (middle * tiles - middle * (middle - 1) / 2 <= task)
+            low = middle;
+        else
+            high = middle;
+    }
+    simsimd_size_t const tile_row = low, tile_column = low + task - (low * tiles - low * (low - 1) / 2);
+    simsimd_size_t const a_first = tile_row * job->tile, b_first = tile_column * job->tile;
+    simsimd_size_t const a_last = a_first + job->tile < count ? a_first + job->tile : count;
+    simsimd_size_t const b_last = b_first + job->tile < count ? b_first + job->tile : count;
+    simsimd_distance_t const* norms = job->norms;
+    for (simsimd_size_t i = a_first; i != a_last; ++i) {
+        simsimd_b8_t const* row = job->a + i * job->row_bytes;
+        for (simsimd_size_t j = i > b_first ? i : b_first; j < b_last; ++j) {
+            simsimd_distance_t distance;
+            if (norms && i == j)
+                distance = norms[i] != 0 ? 0 : 1;
+            else {
+                job->kernel(row, job->a + j * job->row_bytes, job->n, &distance);
+                if (norms)
+                    distance = distance != 0 ? 1 - distance / (norms[i] * norms[j]) : 1;
+            }
+            job->results[i * count + j] = distance;
+            if (job->mirror)
+                job->results[j * count + i] = distance;
+        }
+    }
+}
+
+/**
+ *  @brief  Computes the row-major `count` by `count` matrix of distances between all pairs of the contiguous rows
+ *          of `a`, evaluating only the upper triangle, including the diagonal, in square tiles sized like the tiles
+ *          of `b` in `simsimd_cdist_tiles`. For the cosine distance, the norm of every row is computed once,
+ *          and only the inner products are evaluated per pair.
+ *
+ *  @param allowed The hardware capabilities allowed for use, like `simsimd_cap_any_k`.
+ *  @param mirror Whether to copy the upper triangle into the lower one, or leave the latter untouched.
+ *  @param executor The scheduler to run the tiles with, like `simsimd_pool_run`, or NULL to run them serially.
+ *  @param executor_state The state of the scheduler, like a `simsimd_pool_t`.
+ *  @return Non-zero on success, zero if the metric isn't supported for the datatype, or isn't symmetric,
+ *          like the Kullback-Leibler divergence, or the norms of the rows can't be allocated.
+ */
+SIMSIMD_PUBLIC int simsimd_pdist_parallel(simsimd_metric_kind_t metric, simsimd_datatype_t datatype,
+                                          simsimd_capability_t allowed, void const* a, simsimd_size_t count,
+                                          simsimd_size_t n, simsimd_distance_t* results, int mirror,
+                                          simsimd_executor_t executor, void* executor_state) {
+    simsimd_pdist_job_t job;
+    simsimd_size_t a_tile;
+    memset(&job, 0, sizeof(job));
+    if (datatype >= simsimd_datatype_f64c_k || metric == simsimd_metric_kl_k)
+        return 0;
+    job.kernel = simsimd_metric_punned(metric, datatype, allowed);
+    if (!job.kernel)
+        return 0;
+    job.a = (simsimd_b8_t const*)a, job.count = count, job.n = n, job.results = results, job.mirror = mirror;
+    job.row_bytes = n * simsimd_datatype_bytes(datatype);
+    simsimd_cdist_tiles(job.row_bytes, count, count, &a_tile, &job.tile);
+    job.tiles = (count + job.tile - 1) / job.tile;
+    if (!executor)
+        executor = simsimd_serial_run;
+
+    // The cosine distance is derived from the inner product and the norms, if the inner product is supported
+    simsimd_metric_punned_t dot = metric == simsimd_metric_cos_k
+                                      ? simsimd_metric_punned(simsimd_metric_dot_k, datatype, allowed)
+                                      : 0;
+    if (dot) {
+        job.norms = (simsimd_distance_t*)malloc(count * sizeof(simsimd_distance_t) + 1);
+        if (!job.norms)
+            return 0;
+        job.kernel = dot;
+        executor(executor_state, job.tiles, simsimd_pdist_norms_task, &job);
+    }
+    executor(executor_state, job.tiles * (job.tiles + 1) / 2, simsimd_pdist_task, &job);
+    free(job.norms);
+    return 1;
+}
+
+typedef struct simsimd_topk_job_t {
+    simsimd_metric_punned_t kernel;
+    simsimd_distance_t sign;
+    simsimd_b8_t const *queries, *base;
+    simsimd_size_t count, n, row_bytes, k, chunks, chunk_rows;
+    simsimd_size_t* ids;              ///< Output IDs, that receive the merged results of all chunks
+    simsimd_distance_t* distances;    ///< Output distances, that receive the merged results of all chunks
+    simsimd_size_t* chunk_ids;        ///< Per-chunk candidates, or NULL if queries are scanned as a whole
+    simsimd_distance_t* chunk_distances;
+    simsimd_size_t* chunk_sizes;
+} simsimd_topk_job_t;
+
+SIMSIMD_PUBLIC void simsimd_topk_scan_task(void* context, simsimd_size_t task) {
+    simsimd_topk_job_t const* job = (simsimd_topk_job_t const*)context;
+    simsimd_size_t const q = task / job->chunks, chunk = task % job->chunks;
+    simsimd_size_t const first = chunk * job->chunk_rows;
+    simsimd_size_t const last = first + job->chunk_rows < job->count ? first + job->chunk_rows : job->count;
+    simsimd_size_t* ids = job->chunk_ids ? job->chunk_ids + task * job->k : job->ids + q * job->k;
+    simsimd_distance_t* distances =
+        job->chunk_ids ? job->chunk_distances + task * job->k : job->distances + q * job->k;
+    simsimd_size_t size = 0;
+    simsimd_b8_t const* query = job->queries + q * job->row_bytes;
+    for (simsimd_size_t i = first; i != last; ++i) {
+        simsimd_distance_t distance;
+        job->kernel(query, job->base + i * job->row_bytes, job->n, &distance);
+        simsimd_topk_push(distances, ids, job->k, &size, job->sign * distance, i);
+    }
+    if (job->chunk_ids)
+        job->chunk_sizes[task] = size;
+    else {
+        simsimd_topk_sort(distances, ids, size);
+        for (simsimd_size_t j = 0; j != size; ++j)
+            distances[j] *= job->sign;
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_topk_merge_task(void* context, simsimd_size_t q) {
+    simsimd_topk_job_t const* job = (simsimd_topk_job_t const*)context;
+    simsimd_size_t* ids = job->ids + q * job->k;
+    simsimd_distance_t* distances = job->distances + q * job->k;
+    simsimd_size_t size = 0;
+    for (simsimd_size_t chunk = 0; chunk != job->chunks; ++chunk) {
+        simsimd_size_t const task = q * job->chunks + chunk;
+        for (simsimd_size_t j = 0; j != job->chunk_sizes[task]; ++j)
+            simsimd_topk_push(distances, ids, job->k, &size, job->chunk_distances[task * job->k + j],
+                              job->chunk_ids[task * job->k + j]);
+    }
+    simsimd_topk_sort(distances, ids, size);
+    for (simsimd_size_t j = 0; j != size; ++j)
+        distances[j] *= job->sign;
+}
+
+/**
+ *  @brief  Searches the `k` nearest of `count` contiguous rows of `base` for each of the `queries_count` contiguous
+ *          queries. Every query is split into chunks of `SIMSIMD_PARALLEL_TILE * SIMSIMD_PARALLEL_TILE` rows, each
+ *          producing its own top-k candidates, merged by a second job, so even a single query scales across cores.
+ *          If the candidates can't be allocated, every task scans a whole query instead.
+ *
+ *  @param allowed The hardware capabilities allowed for use, like `simsimd_cap_any_k`.
+ *  @param ids The output array of `queries_count * k` row indices, sorted from the nearest.
+ *  @param distances The output array of `queries_count * k` distances, with the largest inner products first.
+ *  @return The number of results found for each query, or zero if the metric isn't supported for the datatype,
+ *          or `base` is empty.
+ */
+SIMSIMD_PUBLIC simsimd_size_t simsimd_topk_parallel(simsimd_metric_kind_t metric, simsimd_datatype_t datatype,
+                                                    simsimd_capability_t allowed, void const* queries,
+                                                    simsimd_size_t queries_count, void const* base,
+                                                    simsimd_size_t count, simsimd_size_t n, simsimd_size_t k,
+                                                    simsimd_size_t* ids, simsimd_distance_t* distances,
+                                                    simsimd_executor_t executor, void* executor_state) {
+    simsimd_topk_job_t job;
+    memset(&job, 0, sizeof(job));
+    if (datatype >= simsimd_datatype_f64c_k)
+        return 0;
+    job.kernel = simsimd_metric_punned(metric, datatype, allowed);
+    if (!job.kernel || !count)
+        return 0;
+    job.sign = metric == simsimd_metric_dot_k ? -1 : 1;
+    job.queries = (simsimd_b8_t const*)queries, job.base = (simsimd_b8_t const*)base;
+    job.count = count, job.n = n, job.k = k, job.ids = ids, job.distances = distances;
+    job.row_bytes = n * simsimd_datatype_bytes(datatype);
+    job.chunk_rows = SIMSIMD_PARALLEL_TILE * SIMSIMD_PARALLEL_TILE;
+    job.chunks = (count + job.chunk_rows - 1) / job.chunk_rows;
+    if (!executor)
+        executor = simsimd_serial_run;
+
+    simsimd_size_t const tasks = queries_count * job.chunks;
+    if (job.chunks > 1) {
+        job.chunk_ids = (simsimd_size_t*)malloc(tasks * k * sizeof(simsimd_size_t) + 1);
+        job.chunk_distances = (simsimd_distance_t*)malloc(tasks * k * sizeof(simsimd_distance_t) + 1);
+        job.chunk_sizes = (simsimd_size_t*)malloc(tasks * sizeof(simsimd_size_t));
+        if (!job.chunk_ids || !job.chunk_distances || !job.chunk_sizes) {
+            free(job.chunk_ids), free(job.chunk_distances), free(job.chunk_sizes);
+            job.chunk_ids = 0, job.chunk_distances = 0, job.chunk_sizes = 0;
+            job.chunk_rows = count, job.chunks = 1;
+        }
+    }
+    executor(executor_state, queries_count * job.chunks, simsimd_topk_scan_task, &job);
+    if (job.chunk_ids) {
+        executor(executor_state, queries_count, simsimd_topk_merge_task, &job);
+        free(job.chunk_ids), free(job.chunk_distances), free(job.chunk_sizes);
+    }
+    return count < k ? count : k;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SIMSIMD_PARALLEL_H
@@ -78,6 +78,8 @@ SIMSIMD_PUBLIC void simsimd_js_f16_haswell(simsimd_f16_t const* a, simsimd_f16_t
  */
 SIMSIMD_PUBLIC void simsimd_kl_f32_skylake(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n, simsimd_distance_t* divergence);
 SIMSIMD_PUBLIC void simsimd_js_f32_skylake(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n, simsimd_distance_t* divergence);
+SIMSIMD_PUBLIC void simsimd_kl_bf16_genoa(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n, simsimd_distance_t* divergence);
+SIMSIMD_PUBLIC void simsimd_js_bf16_genoa(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n, simsimd_distance_t* divergence);
 SIMSIMD_PUBLIC void simsimd_kl_f16_sapphire(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n, simsimd_distance_t* divergence);
 SIMSIMD_PUBLIC void simsimd_js_f16_sapphire(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n, simsimd_distance_t* divergence);
 // clang-format on
@@ -214,6 +216,7 @@ SIMSIMD_PUBLIC void simsimd_js_f32_neon(simsimd_f32_t const* a, simsimd_f32_t co
 #pragma clang attribute pop
 #pragma GCC pop_options
 
+#if SIMSIMD_TARGET_NEON_F16
 #pragma GCC push_options
 #pragma GCC target("+simd+fp16")
 #pragma clang attribute push(__attribute__((target("+simd+fp16"))), apply_to = function)
@@ -272,6 +275,7 @@ SIMSIMD_PUBLIC void simsimd_js_f16_neon(simsimd_f16_t const* a, simsimd_f16_t co
 
 #pragma clang attribute pop
 #pragma GCC pop_options
+#endif // SIMSIMD_TARGET_NEON_F16
 #endif // SIMSIMD_TARGET_NEON
 #endif // SIMSIMD_TARGET_ARM
 
@@ -475,6 +479,100 @@ simsimd_js_f32_skylake_cycle:
 #pragma GCC pop_options
 #endif // SIMSIMD_TARGET_HASWELL
 
+#if SIMSIMD_TARGET_GENOA
+#pragma GCC push_options
+#pragma GCC target("avx512f", "avx512vl", "bmi2", "avx512bw", "avx512bf16")
+#pragma clang attribute push(__attribute__((target("avx512f,avx512vl,bmi2,avx512bw,avx512bf16"))), apply_to = function)
+
+/*  Expands 16x `bf16` values into `f32`, zero-extending them to 32-bit integers and shifting into the high half.
+ *  Unlike `_mm512_cvtpbh_ps`, this doesn't rely on the `__m256bh` type, defined differently by different compilers.
+ */
+SIMSIMD_INTERNAL __m512 simsimd_bf16x16_to_f32x16_genoa(__m256i x) {
+    return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(x), 16));
+}
+
+SIMSIMD_INTERNAL __m512 simsimd_log2_f32_genoa(__m512 x) {
+    // Same polynomial approximation as in `simsimd_log2_f32_skylake`
+    __m512 one = _mm512_set1_ps(1.0f);
+    __m512 e = _mm512_getexp_ps(x);
+    __m512 m = _mm512_getmant_ps(x, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_src);
+    __m512 p = _mm512_set1_ps(-3.4436006e-2f);
+    p = _mm512_fmadd_ps(m, p, _mm512_set1_ps(3.1821337e-1f));
+    p = _mm512_fmadd_ps(m, p, _mm512_set1_ps(-1.2315303f));
+    p = _mm512_fmadd_ps(m, p, _mm512_set1_ps(2.5988452f));
+    p = _mm512_fmadd_ps(m, p, _mm512_set1_ps(-3.3241990f));
+    p = _mm512_fmadd_ps(m, p, _mm512_set1_ps(3.1157899f));
+    return _mm512_add_ps(_mm512_mul_ps(p, _mm512_sub_ps(m, one)), e);
+}
+
+SIMSIMD_PUBLIC void simsimd_kl_bf16_genoa(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n,
+                                          simsimd_distance_t* result) {
+    __m512 sum_vec = _mm512_setzero_ps();
+    __m512 epsilon_vec = _mm512_set1_ps(SIMSIMD_F32_DIVISION_EPSILON);
+    __m512 a_vec, b_vec;
+
+simsimd_kl_bf16_genoa_cycle:
+    if (n < 16) {
+        __mmask16 mask = (__mmask16)_bzhi_u32(0xFFFFFFFF, n);
+        a_vec = simsimd_bf16x16_to_f32x16_genoa(_mm256_maskz_loadu_epi16(mask, a));
+        b_vec = simsimd_bf16x16_to_f32x16_genoa(_mm256_maskz_loadu_epi16(mask, b));
+        n = 0;
+    } else {
+        a_vec = simsimd_bf16x16_to_f32x16_genoa(_mm256_loadu_si256((__m256i const*)a));
+        b_vec = simsimd_bf16x16_to_f32x16_genoa(_mm256_loadu_si256((__m256i const*)b));
+        a += 16, b += 16, n -= 16;
+    }
+    // Zero-padded lanes produce `log2(1) = 0`, and won't affect the sum
+    __m512 ratio_vec = _mm512_div_ps(_mm512_add_ps(a_vec, epsilon_vec), _mm512_add_ps(b_vec, epsilon_vec));
+    __m512 log_ratio_vec = simsimd_log2_f32_genoa(ratio_vec);
+    sum_vec = _mm512_fmadd_ps(a_vec, log_ratio_vec, sum_vec);
+    if (n)
+        goto simsimd_kl_bf16_genoa_cycle;
+
+    simsimd_f32_t log2_normalizer = 0.693147181f;
+    *result = _mm512_reduce_add_ps(sum_vec) * log2_normalizer;
+}
+
+SIMSIMD_PUBLIC void simsimd_js_bf16_genoa(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n,
+                                          simsimd_distance_t* result) {
+    __m512 sum_a_vec = _mm512_setzero_ps();
+    __m512 sum_b_vec = _mm512_setzero_ps();
+    __m512 epsilon_vec = _mm512_set1_ps(SIMSIMD_F32_DIVISION_EPSILON);
+    __m512 a_vec, b_vec;
+
+simsimd_js_bf16_genoa_cycle:
+    if (n < 16) {
+        __mmask16 mask = (__mmask16)_bzhi_u32(0xFFFFFFFF, n);
+        a_vec = simsimd_bf16x16_to_f32x16_genoa(_mm256_maskz_loadu_epi16(mask, a));
+        b_vec = simsimd_bf16x16_to_f32x16_genoa(_mm256_maskz_loadu_epi16(mask, b));
+        n = 0;
+    } else {
+        a_vec = simsimd_bf16x16_to_f32x16_genoa(_mm256_loadu_si256((__m256i const*)a));
+        b_vec = simsimd_bf16x16_to_f32x16_genoa(_mm256_loadu_si256((__m256i const*)b));
+        a += 16, b += 16, n -= 16;
+    }
+    // Regularizing every term with an epsilon, like the serial version, avoids `0 * log(0)` NaNs without masking
+    __m512 m_vec = _mm512_mul_ps(_mm512_add_ps(a_vec, b_vec), _mm512_set1_ps(0.5f));
+    __m512 m_recip_approx = _mm512_rcp14_ps(_mm512_add_ps(m_vec, epsilon_vec));
+    __m512 ratio_a_vec = _mm512_mul_ps(_mm512_add_ps(a_vec, epsilon_vec), m_recip_approx);
+    __m512 ratio_b_vec = _mm512_mul_ps(_mm512_add_ps(b_vec, epsilon_vec), m_recip_approx);
+    __m512 log_ratio_a_vec = simsimd_log2_f32_genoa(ratio_a_vec);
+    __m512 log_ratio_b_vec = simsimd_log2_f32_genoa(ratio_b_vec);
+    sum_a_vec = _mm512_fmadd_ps(a_vec, log_ratio_a_vec, sum_a_vec);
+    sum_b_vec = _mm512_fmadd_ps(b_vec, log_ratio_b_vec, sum_b_vec);
+    if (n)
+        goto simsimd_js_bf16_genoa_cycle;
+
+    // The approximate reciprocal can push the divergence of (nearly) identical distributions slightly below zero
+    simsimd_f32_t log2_normalizer = 0.693147181f;
+    simsimd_f32_t sum = _mm512_reduce_add_ps(_mm512_add_ps(sum_a_vec, sum_b_vec)) * 0.5f * log2_normalizer;
+    *result = sum > 0 ? sum : 0;
+}
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_GENOA
+
 #if SIMSIMD_TARGET_SAPPHIRE
 #pragma GCC push_options
 #pragma GCC target("avx512f", "avx512vl", "bmi2", "avx512fp16")
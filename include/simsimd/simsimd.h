@@ -30,6 +30,7 @@
 
 #include "binary.h"      // Hamming, Jaccard
 #include "dot.h"         // Inner (dot) product, and its conjugate
+#include "elementwise.h" // Weighted sum, FMA, scale and shift
 #include "geospatial.h"  // Haversine and Vincenty
 #include "probability.h" // Kullback-Leibler, Jensen–Shannon
 #include "spatial.h"     // L2, Cosine
@@ -39,6 +40,9 @@
 #include <asm/hwcap.h>
 #include <sys/auxv.h>
 #endif
+#ifdef __APPLE__
+#include <sys/sysctl.h>
+#endif
 #endif
 
 #ifdef __cplusplus
@@ -79,6 +83,11 @@ typedef enum {
     simsimd_metric_js_k = 's',             ///< Jensen-Shannon divergence
     simsimd_metric_jensen_shannon_k = 's', ///< Jensen-Shannon divergence alias
 
+    // Element-wise:
+    simsimd_metric_wsum_k = 'w',  ///< Weighted sum of two vectors, `alpha * a + beta * b`
+    simsimd_metric_fma_k = 'f',   ///< Fused multiply-add of three vectors, `alpha * a * b + beta * c`
+    simsimd_metric_scale_k = 'a', ///< Scale and shift of a vector, `alpha * a + beta`
+
 } simsimd_metric_kind_t;
 
 /**
@@ -92,11 +101,17 @@ typedef enum {
     simsimd_cap_sve_k = 1 << 11,  ///< ARM SVE capability
     simsimd_cap_sve2_k = 1 << 12, ///< ARM SVE2 capability
 
+    simsimd_cap_neon_f16_k = 1 << 13,  ///< ARM NEON capability with `f16` arithmetic, `FEAT_FP16`
+    simsimd_cap_neon_bf16_k = 1 << 14, ///< ARM NEON capability with `bf16` dot-products, `FEAT_BF16`
+    simsimd_cap_neon_i8_k = 1 << 15,   ///< ARM NEON capability with `i8` dot-products, `FEAT_DotProd`
+    simsimd_cap_neon_i8mm_k = 1 << 16, ///< ARM NEON capability with `i8` matrix multiplications, `FEAT_I8MM`
+
     simsimd_cap_haswell_k = 1 << 20,  ///< x86 AVX2 capability with FMA and F16C extensions
     simsimd_cap_skylake_k = 1 << 21,  ///< x86 AVX512 baseline capability
     simsimd_cap_ice_k = 1 << 22,      ///< x86 AVX512 capability with advanced integer algos
     simsimd_cap_sapphire_k = 1 << 23, ///< x86 AVX512 capability with `f16` support
     simsimd_cap_genoa_k = 1 << 24,    ///< x86 AVX512 capability with `bf16` support
+    simsimd_cap_alder_k = 1 << 25,    ///< x86 AVX2 capability with VEX-encoded `i8` dot-products, AVX-VNNI
 
 } simsimd_capability_t;
 
@@ -134,6 +149,78 @@ typedef enum {
  */
 typedef void (*simsimd_metric_punned_t)(void const* a, void const* b, simsimd_size_t n, simsimd_distance_t* d);
 
+/**
+ *  @brief  Type-punned function pointers for the element-wise kernels, that output vectors of the input type.
+ *          Those are returned by `simsimd_find_metric_punned` for `simsimd_metric_{wsum,fma,scale}_k` kinds,
+ *          and must be cast back to the matching signature before the call.
+ *
+ *  @param[in] a, b, c  Pointers to the input data arrays.
+ *  @param[in] n        Number of scalar words in each of the arrays.
+ *  @param[in] alpha    Multiplier of the first term.
+ *  @param[in] beta     Multiplier of the second term.
+ *  @param[out] result  Pointer to the output array of `n` scalars, that may alias any of the inputs.
+ */
+typedef void (*simsimd_kernel_wsum_punned_t)(void const* a, void const* b, simsimd_size_t n, simsimd_distance_t alpha,
+                                             simsimd_distance_t beta, void* result);
+typedef void (*simsimd_kernel_fma_punned_t)(void const* a, void const* b, void const* c, simsimd_size_t n,
+                                            simsimd_distance_t alpha, simsimd_distance_t beta, void* result);
+typedef void (*simsimd_kernel_scale_punned_t)(void const* a, simsimd_size_t n, simsimd_distance_t alpha,
+                                              simsimd_distance_t beta, void* result);
+
+/**
+ *  @brief  Type-punned function pointer for the per-dimension affine kernels, returned by `simsimd_find_affine_punned`.
+ *
+ *  @param[in] a        Pointer to the input data array.
+ *  @param[in] n        Number of scalar words in the input and output arrays.
+ *  @param[in] alphas   Pointer to the `n` per-dimension multipliers.
+ *  @param[in] betas    Pointer to the `n` per-dimension offsets.
+ *  @param[out] result  Pointer to the output array of `n` scalars.
+ */
+typedef void (*simsimd_kernel_affine_punned_t)(void const* a, simsimd_size_t n, simsimd_f32_t const* alphas,
+                                               simsimd_f32_t const* betas, void* result);
+
+/**
+ *  @brief  Type-punned function pointer for the nearest-centroid assignment kernels, returned by
+ *          `simsimd_find_assign_punned`.
+ *
+ *  @param[in] a                Pointer to the `count` contiguous input vectors of `n` scalars each.
+ *  @param[in] count            Number of input vectors.
+ *  @param[in] centroids        Pointer to the `k` contiguous centroids of `n` scalars each.
+ *  @param[in] k                Number of centroids.
+ *  @param[in] n                Number of dimensions in every vector.
+ *  @param[out] assignments     Output array of `count` indices of the closest centroids.
+ *  @param[out] distances       Optional output array of `count` distances to the closest centroids, can be NULL.
+ */
+typedef void (*simsimd_kernel_assign_punned_t)(void const* a, simsimd_size_t count, void const* centroids,
+                                               simsimd_size_t k, simsimd_size_t n, simsimd_size_t* assignments,
+                                               simsimd_distance_t* distances);
+
+/**
+ *  @brief  Type-punned function pointer for the kernels over packed panels of rows, returned by
+ *          `simsimd_find_packed_punned`.
+ *
+ *  @param[in] a                Pointer to the `a_count` contiguous query vectors of `n` scalars each.
+ *  @param[in] a_count          Number of query vectors.
+ *  @param[in] packed           Pointer to the `count` vectors, rearranged by `simsimd_pack_f32`.
+ *  @param[in] count            Number of packed vectors.
+ *  @param[in] n                Number of dimensions in every vector.
+ *  @param[out] results         Output row-major matrix of `a_count * count` distances.
+ */
+typedef void (*simsimd_kernel_packed_punned_t)(void const* a, simsimd_size_t a_count, void const* packed,
+                                               simsimd_size_t count, simsimd_size_t n, simsimd_distance_t* results);
+
+/**
+ *  @brief  Type-punned function pointer for the fused L2 normalization kernels, returned by
+ *          `simsimd_find_normalize_punned`.
+ *
+ *  @param[in] a                Pointer to the `count` contiguous input vectors of `n` scalars each.
+ *  @param[in] count            Number of input vectors.
+ *  @param[in] n                Number of dimensions in every vector.
+ *  @param[out] result          Pointer to the `count` contiguous output vectors, can be equal to `a`.
+ */
+typedef void (*simsimd_kernel_normalize_punned_t)(void const* a, simsimd_size_t count, simsimd_size_t n,
+                                                  void* result);
+
 #if SIMSIMD_DYNAMIC_DISPATCH
 SIMSIMD_DYNAMIC simsimd_capability_t simsimd_capabilities(void);
 #else
@@ -199,9 +286,13 @@ SIMSIMD_PUBLIC simsimd_capability_t simsimd_capabilities_implementation(void) {
     // Check for AVX512BF16 (Function ID 7, Sub-leaf 1, EAX register)
     // https://github.com/llvm/llvm-project/blob/50598f0ff44f3a4e75706f8c53f3380fe7faa896/clang/lib/Headers/cpuid.h#L205
     unsigned supports_avx512bf16 = (info7sub1.named.eax & 0x00000020) != 0;
+    // Check for AVX-VNNI (Function ID 7, Sub-leaf 1, EAX register)
+    // https://github.com/llvm/llvm-project/blob/50598f0ff44f3a4e75706f8c53f3380fe7faa896/clang/lib/Headers/cpuid.h#L204
+    unsigned supports_avxvnni = (info7sub1.named.eax & 0x00000010) != 0;
 
     // Convert specific features into CPU generations
     unsigned supports_haswell = supports_avx2 && supports_f16c && supports_fma;
+    unsigned supports_alder = supports_haswell && supports_avxvnni;
     unsigned supports_skylake = supports_avx512f;
     unsigned supports_ice = supports_avx512vnni && supports_avx512ifma && supports_avx512bitalg &&
                             supports_avx512vbmi2 && supports_avx512vpopcntdq;
@@ -210,6 +301,7 @@ SIMSIMD_PUBLIC simsimd_capability_t simsimd_capabilities_implementation(void) {
 
     return (simsimd_capability_t)(                     //
         (simsimd_cap_haswell_k * supports_haswell) |   //
+        (simsimd_cap_alder_k * supports_alder) |       //
         (simsimd_cap_skylake_k * supports_skylake) |   //
         (simsimd_cap_ice_k * supports_ice) |           //
         (simsimd_cap_genoa_k * supports_genoa) |       //
@@ -220,22 +312,60 @@ SIMSIMD_PUBLIC simsimd_capability_t simsimd_capabilities_implementation(void) {
 
 #if SIMSIMD_TARGET_ARM
 
-    // Every 64-bit Arm CPU supports NEON
+    // Every 64-bit Arm CPU supports NEON, but not necessarily its Armv8.2+ extensions
     unsigned supports_neon = 1;
+    unsigned supports_neon_f16 = 0;
+    unsigned supports_neon_bf16 = 0;
+    unsigned supports_neon_i8 = 0;
+    unsigned supports_neon_i8mm = 0;
     unsigned supports_sve = 0;
     unsigned supports_sve2 = 0;
 
-#ifdef __linux__
+#if defined(__linux__)
+    // The `HWCAP_*` constants are missing from older kernel headers, so each one is checked separately.
+    // https://www.kernel.org/doc/html/latest/arch/arm64/elf_hwcaps.html
     unsigned long hwcap = getauxval(AT_HWCAP);
     unsigned long hwcap2 = getauxval(AT_HWCAP2);
+#ifdef HWCAP_ASIMDHP
+    supports_neon_f16 = (hwcap & HWCAP_FPHP) != 0 && (hwcap & HWCAP_ASIMDHP) != 0;
+#endif
+#ifdef HWCAP2_BF16
+    supports_neon_bf16 = (hwcap2 & HWCAP2_BF16) != 0;
+#endif
+#ifdef HWCAP_ASIMDDP
+    supports_neon_i8 = (hwcap & HWCAP_ASIMDDP) != 0;
+#endif
+#ifdef HWCAP2_I8MM
+    supports_neon_i8mm = (hwcap2 & HWCAP2_I8MM) != 0;
+#endif
     supports_sve = (hwcap & HWCAP_SVE) != 0;
     supports_sve2 = (hwcap2 & HWCAP2_SVE2) != 0;
-#endif
-
-    return (simsimd_capability_t)(             //
-        (simsimd_cap_neon_k * supports_neon) | //
-        (simsimd_cap_sve_k * supports_sve) |   //
-        (simsimd_cap_sve2_k * supports_sve2) | //
+#elif defined(__APPLE__)
+    // All Apple Silicon chips support `fp16` and `dotprod`, but `bf16` and `i8mm` appeared only in M2.
+    // https://developer.apple.com/documentation/kernel/1387446-sysctlbyname/determining_instruction_set_characteristics
+    unsigned supports_feature = 0;
+    size_t supports_feature_size = sizeof(supports_feature);
+    if (sysctlbyname("hw.optional.arm.FEAT_FP16", &supports_feature, &supports_feature_size, NULL, 0) == 0)
+        supports_neon_f16 = supports_feature != 0;
+    supports_feature = 0;
+    if (sysctlbyname("hw.optional.arm.FEAT_BF16", &supports_feature, &supports_feature_size, NULL, 0) == 0)
+        supports_neon_bf16 = supports_feature != 0;
+    supports_feature = 0;
+    if (sysctlbyname("hw.optional.arm.FEAT_DotProd", &supports_feature, &supports_feature_size, NULL, 0) == 0)
+        supports_neon_i8 = supports_feature != 0;
+    supports_feature = 0;
+    if (sysctlbyname("hw.optional.arm.FEAT_I8MM", &supports_feature, &supports_feature_size, NULL, 0) == 0)
+        supports_neon_i8mm = supports_feature != 0;
+#endif
+
+    return (simsimd_capability_t)(                       //
+        (simsimd_cap_neon_k * supports_neon) |           //
+        (simsimd_cap_neon_f16_k * supports_neon_f16) |   //
+        (simsimd_cap_neon_bf16_k * supports_neon_bf16) | //
+        (simsimd_cap_neon_i8_k * supports_neon_i8) |     //
+        (simsimd_cap_neon_i8mm_k * supports_neon_i8mm) | //
+        (simsimd_cap_sve_k * supports_sve) |             //
+        (simsimd_cap_sve2_k * supports_sve2) |           //
         (simsimd_cap_serial_k));
 
 #endif // SIMSIMD_TARGET_ARM
@@ -296,6 +426,18 @@ SIMSIMD_PUBLIC void simsimd_find_metric_punned( //
             case simsimd_metric_dot_k: *m = (m_t)&simsimd_dot_f64_skylake, *c = simsimd_cap_skylake_k; return;
             case simsimd_metric_cos_k: *m = (m_t)&simsimd_cos_f64_skylake, *c = simsimd_cap_skylake_k; return;
             case simsimd_metric_l2sq_k: *m = (m_t)&simsimd_l2sq_f64_skylake, *c = simsimd_cap_skylake_k; return;
+            case simsimd_metric_wsum_k: *m = (m_t)&simsimd_wsum_f64_skylake, *c = simsimd_cap_skylake_k; return;
+            case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_f64_skylake, *c = simsimd_cap_skylake_k; return;
+            case simsimd_metric_scale_k: *m = (m_t)&simsimd_scale_f64_skylake, *c = simsimd_cap_skylake_k; return;
+            default: break;
+            }
+#endif
+#if SIMSIMD_TARGET_HASWELL
+        if (viable & simsimd_cap_haswell_k)
+            switch (kind) {
+            case simsimd_metric_wsum_k: *m = (m_t)&simsimd_wsum_f64_haswell, *c = simsimd_cap_haswell_k; return;
+            case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_f64_haswell, *c = simsimd_cap_haswell_k; return;
+            case simsimd_metric_scale_k: *m = (m_t)&simsimd_scale_f64_haswell, *c = simsimd_cap_haswell_k; return;
             default: break;
             }
 #endif
@@ -306,6 +448,9 @@ SIMSIMD_PUBLIC void simsimd_find_metric_punned( //
             case simsimd_metric_l2sq_k: *m = (m_t)&simsimd_l2sq_f64_serial, *c = simsimd_cap_serial_k; return;
             case simsimd_metric_js_k: *m = (m_t)&simsimd_js_f64_serial, *c = simsimd_cap_serial_k; return;
             case simsimd_metric_kl_k: *m = (m_t)&simsimd_kl_f64_serial, *c = simsimd_cap_serial_k; return;
+            case simsimd_metric_wsum_k: *m = (m_t)&simsimd_wsum_f64_serial, *c = simsimd_cap_serial_k; return;
+            case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_f64_serial, *c = simsimd_cap_serial_k; return;
+            case simsimd_metric_scale_k: *m = (m_t)&simsimd_scale_f64_serial, *c = simsimd_cap_serial_k; return;
             default: break;
             }
 
@@ -331,6 +476,9 @@ SIMSIMD_PUBLIC void simsimd_find_metric_punned( //
             case simsimd_metric_l2sq_k: *m = (m_t)&simsimd_l2sq_f32_neon, *c = simsimd_cap_neon_k; return;
             case simsimd_metric_js_k: *m = (m_t)&simsimd_js_f32_neon, *c = simsimd_cap_neon_k; return;
             case simsimd_metric_kl_k: *m = (m_t)&simsimd_kl_f32_neon, *c = simsimd_cap_neon_k; return;
+            case simsimd_metric_wsum_k: *m = (m_t)&simsimd_wsum_f32_neon, *c = simsimd_cap_neon_k; return;
+            case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_f32_neon, *c = simsimd_cap_neon_k; return;
+            case simsimd_metric_scale_k: *m = (m_t)&simsimd_scale_f32_neon, *c = simsimd_cap_neon_k; return;
             default: break;
             }
 #endif
@@ -342,6 +490,18 @@ SIMSIMD_PUBLIC void simsimd_find_metric_punned( //
             case simsimd_metric_l2sq_k: *m = (m_t)&simsimd_l2sq_f32_skylake, *c = simsimd_cap_skylake_k; return;
             case simsimd_metric_js_k: *m = (m_t)&simsimd_js_f32_skylake, *c = simsimd_cap_skylake_k; return;
             case simsimd_metric_kl_k: *m = (m_t)&simsimd_kl_f32_skylake, *c = simsimd_cap_skylake_k; return;
+            case simsimd_metric_wsum_k: *m = (m_t)&simsimd_wsum_f32_skylake, *c = simsimd_cap_skylake_k; return;
+            case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_f32_skylake, *c = simsimd_cap_skylake_k; return;
+            case simsimd_metric_scale_k: *m = (m_t)&simsimd_scale_f32_skylake, *c = simsimd_cap_skylake_k; return;
+            default: break;
+            }
+#endif
+#if SIMSIMD_TARGET_HASWELL
+        if (viable & simsimd_cap_haswell_k)
+            switch (kind) {
+            case simsimd_metric_wsum_k: *m = (m_t)&simsimd_wsum_f32_haswell, *c = simsimd_cap_haswell_k; return;
+            case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_f32_haswell, *c = simsimd_cap_haswell_k; return;
+            case simsimd_metric_scale_k: *m = (m_t)&simsimd_scale_f32_haswell, *c = simsimd_cap_haswell_k; return;
             default: break;
             }
 #endif
@@ -352,6 +512,9 @@ SIMSIMD_PUBLIC void simsimd_find_metric_punned( //
             case simsimd_metric_l2sq_k: *m = (m_t)&simsimd_l2sq_f32_serial, *c = simsimd_cap_serial_k; return;
             case simsimd_metric_js_k: *m = (m_t)&simsimd_js_f32_serial, *c = simsimd_cap_serial_k; return;
             case simsimd_metric_kl_k: *m = (m_t)&simsimd_kl_f32_serial, *c = simsimd_cap_serial_k; return;
+            case simsimd_metric_wsum_k: *m = (m_t)&simsimd_wsum_f32_serial, *c = simsimd_cap_serial_k; return;
+            case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_f32_serial, *c = simsimd_cap_serial_k; return;
+            case simsimd_metric_scale_k: *m = (m_t)&simsimd_scale_f32_serial, *c = simsimd_cap_serial_k; return;
             default: break;
             }
 
@@ -369,14 +532,17 @@ SIMSIMD_PUBLIC void simsimd_find_metric_punned( //
             default: break;
             }
 #endif
-#if SIMSIMD_TARGET_NEON
-        if (viable & simsimd_cap_neon_k)
+#if SIMSIMD_TARGET_NEON_F16
+        if (viable & simsimd_cap_neon_f16_k)
             switch (kind) {
-            case simsimd_metric_dot_k: *m = (m_t)&simsimd_dot_f16_neon, *c = simsimd_cap_neon_k; return;
-            case simsimd_metric_cos_k: *m = (m_t)&simsimd_cos_f16_neon, *c = simsimd_cap_neon_k; return;
-            case simsimd_metric_l2sq_k: *m = (m_t)&simsimd_l2sq_f16_neon, *c = simsimd_cap_neon_k; return;
-            case simsimd_metric_js_k: *m = (m_t)&simsimd_js_f16_neon, *c = simsimd_cap_neon_k; return;
-            case simsimd_metric_kl_k: *m = (m_t)&simsimd_kl_f16_neon, *c = simsimd_cap_neon_k; return;
+            case simsimd_metric_dot_k: *m = (m_t)&simsimd_dot_f16_neon, *c = simsimd_cap_neon_f16_k; return;
+            case simsimd_metric_cos_k: *m = (m_t)&simsimd_cos_f16_neon, *c = simsimd_cap_neon_f16_k; return;
+            case simsimd_metric_l2sq_k: *m = (m_t)&simsimd_l2sq_f16_neon, *c = simsimd_cap_neon_f16_k; return;
+            case simsimd_metric_js_k: *m = (m_t)&simsimd_js_f16_neon, *c = simsimd_cap_neon_f16_k; return;
+            case simsimd_metric_kl_k: *m = (m_t)&simsimd_kl_f16_neon, *c = simsimd_cap_neon_f16_k; return;
+            case simsimd_metric_wsum_k: *m = (m_t)&simsimd_wsum_f16_neon, *c = simsimd_cap_neon_f16_k; return;
+            case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_f16_neon, *c = simsimd_cap_neon_f16_k; return;
+            case simsimd_metric_scale_k: *m = (m_t)&simsimd_scale_f16_neon, *c = simsimd_cap_neon_f16_k; return;
             default: break;
             }
 #endif
@@ -391,6 +557,15 @@ SIMSIMD_PUBLIC void simsimd_find_metric_punned( //
             default: break;
             }
 #endif
+#if SIMSIMD_TARGET_SKYLAKE
+        if (viable & simsimd_cap_skylake_k)
+            switch (kind) {
+            case simsimd_metric_wsum_k: *m = (m_t)&simsimd_wsum_f16_skylake, *c = simsimd_cap_skylake_k; return;
+            case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_f16_skylake, *c = simsimd_cap_skylake_k; return;
+            case simsimd_metric_scale_k: *m = (m_t)&simsimd_scale_f16_skylake, *c = simsimd_cap_skylake_k; return;
+            default: break;
+            }
+#endif
 #if SIMSIMD_TARGET_HASWELL
         if (viable & simsimd_cap_haswell_k)
             switch (kind) {
@@ -399,6 +574,9 @@ SIMSIMD_PUBLIC void simsimd_find_metric_punned( //
             case simsimd_metric_l2sq_k: *m = (m_t)&simsimd_l2sq_f16_haswell, *c = simsimd_cap_haswell_k; return;
             case simsimd_metric_js_k: *m = (m_t)&simsimd_js_f16_haswell, *c = simsimd_cap_haswell_k; return;
             case simsimd_metric_kl_k: *m = (m_t)&simsimd_kl_f16_haswell, *c = simsimd_cap_haswell_k; return;
+            case simsimd_metric_wsum_k: *m = (m_t)&simsimd_wsum_f16_haswell, *c = simsimd_cap_haswell_k; return;
+            case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_f16_haswell, *c = simsimd_cap_haswell_k; return;
+            case simsimd_metric_scale_k: *m = (m_t)&simsimd_scale_f16_haswell, *c = simsimd_cap_haswell_k; return;
             default: break;
             }
 #endif
@@ -410,6 +588,9 @@ SIMSIMD_PUBLIC void simsimd_find_metric_punned( //
             case simsimd_metric_l2sq_k: *m = (m_t)&simsimd_l2sq_f16_serial, *c = simsimd_cap_serial_k; return;
             case simsimd_metric_js_k: *m = (m_t)&simsimd_js_f16_serial, *c = simsimd_cap_serial_k; return;
             case simsimd_metric_kl_k: *m = (m_t)&simsimd_kl_f16_serial, *c = simsimd_cap_serial_k; return;
+            case simsimd_metric_wsum_k: *m = (m_t)&simsimd_wsum_f16_serial, *c = simsimd_cap_serial_k; return;
+            case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_f16_serial, *c = simsimd_cap_serial_k; return;
+            case simsimd_metric_scale_k: *m = (m_t)&simsimd_scale_f16_serial, *c = simsimd_cap_serial_k; return;
             default: break;
             }
 
@@ -417,12 +598,13 @@ SIMSIMD_PUBLIC void simsimd_find_metric_punned( //
 
     // Brain floating-point vectors
     case simsimd_datatype_bf16_k:
-#if SIMSIMD_TARGET_HASWELL
-        if (viable & simsimd_cap_haswell_k)
+#if SIMSIMD_TARGET_SVE && SIMSIMD_TARGET_NEON_BF16
+        // SVE `bfdot` is only available on cores that also expose the `bf16` extension for NEON
+        if ((viable & simsimd_cap_sve_k) && (viable & simsimd_cap_neon_bf16_k))
             switch (kind) {
-            case simsimd_metric_dot_k: *m = (m_t)&simsimd_dot_bf16_haswell, *c = simsimd_cap_haswell_k; return;
-            case simsimd_metric_cos_k: *m = (m_t)&simsimd_cos_bf16_haswell, *c = simsimd_cap_haswell_k; return;
-            case simsimd_metric_l2sq_k: *m = (m_t)&simsimd_l2sq_bf16_haswell, *c = simsimd_cap_haswell_k; return;
+            case simsimd_metric_dot_k: *m = (m_t)&simsimd_dot_bf16_sve, *c = simsimd_cap_sve_k; return;
+            case simsimd_metric_cos_k: *m = (m_t)&simsimd_cos_bf16_sve, *c = simsimd_cap_sve_k; return;
+            case simsimd_metric_l2sq_k: *m = (m_t)&simsimd_l2sq_bf16_sve, *c = simsimd_cap_sve_k; return;
             default: break;
             }
 #endif
@@ -432,6 +614,29 @@ SIMSIMD_PUBLIC void simsimd_find_metric_punned( //
             case simsimd_metric_dot_k: *m = (m_t)&simsimd_dot_bf16_genoa, *c = simsimd_cap_genoa_k; return;
             case simsimd_metric_cos_k: *m = (m_t)&simsimd_cos_bf16_genoa, *c = simsimd_cap_genoa_k; return;
             case simsimd_metric_l2sq_k: *m = (m_t)&simsimd_l2sq_bf16_genoa, *c = simsimd_cap_genoa_k; return;
+            case simsimd_metric_js_k: *m = (m_t)&simsimd_js_bf16_genoa, *c = simsimd_cap_genoa_k; return;
+            case simsimd_metric_kl_k: *m = (m_t)&simsimd_kl_bf16_genoa, *c = simsimd_cap_genoa_k; return;
+            default: break;
+            }
+#endif
+#if SIMSIMD_TARGET_SKYLAKE
+        if (viable & simsimd_cap_skylake_k)
+            switch (kind) {
+            case simsimd_metric_wsum_k: *m = (m_t)&simsimd_wsum_bf16_skylake, *c = simsimd_cap_skylake_k; return;
+            case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_bf16_skylake, *c = simsimd_cap_skylake_k; return;
+            case simsimd_metric_scale_k: *m = (m_t)&simsimd_scale_bf16_skylake, *c = simsimd_cap_skylake_k; return;
+            default: break;
+            }
+#endif
+#if SIMSIMD_TARGET_HASWELL
+        if (viable & simsimd_cap_haswell_k)
+            switch (kind) {
+            case simsimd_metric_dot_k: *m = (m_t)&simsimd_dot_bf16_haswell, *c = simsimd_cap_haswell_k; return;
+            case simsimd_metric_cos_k: *m = (m_t)&simsimd_cos_bf16_haswell, *c = simsimd_cap_haswell_k; return;
+            case simsimd_metric_l2sq_k: *m = (m_t)&simsimd_l2sq_bf16_haswell, *c = simsimd_cap_haswell_k; return;
+            case simsimd_metric_wsum_k: *m = (m_t)&simsimd_wsum_bf16_haswell, *c = simsimd_cap_haswell_k; return;
+            case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_bf16_haswell, *c = simsimd_cap_haswell_k; return;
+            case simsimd_metric_scale_k: *m = (m_t)&simsimd_scale_bf16_haswell, *c = simsimd_cap_haswell_k; return;
             default: break;
             }
 #endif
@@ -442,6 +647,9 @@ SIMSIMD_PUBLIC void simsimd_find_metric_punned( //
             case simsimd_metric_l2sq_k: *m = (m_t)&simsimd_l2sq_bf16_serial, *c = simsimd_cap_serial_k; return;
             case simsimd_metric_js_k: *m = (m_t)&simsimd_js_bf16_serial, *c = simsimd_cap_serial_k; return;
             case simsimd_metric_kl_k: *m = (m_t)&simsimd_kl_bf16_serial, *c = simsimd_cap_serial_k; return;
+            case simsimd_metric_wsum_k: *m = (m_t)&simsimd_wsum_bf16_serial, *c = simsimd_cap_serial_k; return;
+            case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_bf16_serial, *c = simsimd_cap_serial_k; return;
+            case simsimd_metric_scale_k: *m = (m_t)&simsimd_scale_bf16_serial, *c = simsimd_cap_serial_k; return;
             default: break;
             }
 
@@ -449,12 +657,21 @@ SIMSIMD_PUBLIC void simsimd_find_metric_punned( //
 
     // Single-byte integer vectors
     case simsimd_datatype_i8_k:
-#if SIMSIMD_TARGET_NEON
-        if (viable & simsimd_cap_neon_k)
+#if SIMSIMD_TARGET_SVE
+        if (viable & simsimd_cap_sve_k)
+            switch (kind) {
+            case simsimd_metric_dot_k: *m = (m_t)&simsimd_dot_i8_sve, *c = simsimd_cap_sve_k; return;
+            case simsimd_metric_cos_k: *m = (m_t)&simsimd_cos_i8_sve, *c = simsimd_cap_sve_k; return;
+            case simsimd_metric_l2sq_k: *m = (m_t)&simsimd_l2sq_i8_sve, *c = simsimd_cap_sve_k; return;
+            default: break;
+            }
+#endif
+#if SIMSIMD_TARGET_NEON_I8
+        if (viable & simsimd_cap_neon_i8_k)
             switch (kind) {
-            case simsimd_metric_dot_k: *m = (m_t)&simsimd_dot_i8_neon, *c = simsimd_cap_neon_k; return;
-            case simsimd_metric_cos_k: *m = (m_t)&simsimd_cos_i8_neon, *c = simsimd_cap_neon_k; return;
-            case simsimd_metric_l2sq_k: *m = (m_t)&simsimd_l2sq_i8_neon, *c = simsimd_cap_neon_k; return;
+            case simsimd_metric_dot_k: *m = (m_t)&simsimd_dot_i8_neon, *c = simsimd_cap_neon_i8_k; return;
+            case simsimd_metric_cos_k: *m = (m_t)&simsimd_cos_i8_neon, *c = simsimd_cap_neon_i8_k; return;
+            case simsimd_metric_l2sq_k: *m = (m_t)&simsimd_l2sq_i8_neon, *c = simsimd_cap_neon_i8_k; return;
             default: break;
             }
 #endif
@@ -467,12 +684,33 @@ SIMSIMD_PUBLIC void simsimd_find_metric_punned( //
             default: break;
             }
 #endif
+#if SIMSIMD_TARGET_ALDER
+        if (viable & simsimd_cap_alder_k)
+            switch (kind) {
+            case simsimd_metric_dot_k: *m = (m_t)&simsimd_dot_i8_alder, *c = simsimd_cap_alder_k; return;
+            case simsimd_metric_cos_k: *m = (m_t)&simsimd_cos_i8_alder, *c = simsimd_cap_alder_k; return;
+            case simsimd_metric_l2sq_k: *m = (m_t)&simsimd_l2sq_i8_alder, *c = simsimd_cap_alder_k; return;
+            default: break;
+            }
+#endif
+#if SIMSIMD_TARGET_SKYLAKE
+        if (viable & simsimd_cap_skylake_k)
+            switch (kind) {
+            case simsimd_metric_wsum_k: *m = (m_t)&simsimd_wsum_i8_skylake, *c = simsimd_cap_skylake_k; return;
+            case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_i8_skylake, *c = simsimd_cap_skylake_k; return;
+            case simsimd_metric_scale_k: *m = (m_t)&simsimd_scale_i8_skylake, *c = simsimd_cap_skylake_k; return;
+            default: break;
+            }
+#endif
 #if SIMSIMD_TARGET_HASWELL
         if (viable & simsimd_cap_haswell_k)
             switch (kind) {
             case simsimd_metric_dot_k: *m = (m_t)&simsimd_dot_i8_haswell, *c = simsimd_cap_haswell_k; return;
             case simsimd_metric_cos_k: *m = (m_t)&simsimd_cos_i8_haswell, *c = simsimd_cap_haswell_k; return;
             case simsimd_metric_l2sq_k: *m = (m_t)&simsimd_l2sq_i8_haswell, *c = simsimd_cap_haswell_k; return;
+            case simsimd_metric_wsum_k: *m = (m_t)&simsimd_wsum_i8_haswell, *c = simsimd_cap_haswell_k; return;
+            case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_i8_haswell, *c = simsimd_cap_haswell_k; return;
+            case simsimd_metric_scale_k: *m = (m_t)&simsimd_scale_i8_haswell, *c = simsimd_cap_haswell_k; return;
             default: break;
             }
 #endif
@@ -482,6 +720,9 @@ SIMSIMD_PUBLIC void simsimd_find_metric_punned( //
             case simsimd_metric_dot_k: *m = (m_t)&simsimd_dot_i8_serial, *c = simsimd_cap_serial_k; return;
             case simsimd_metric_cos_k: *m = (m_t)&simsimd_cos_i8_serial, *c = simsimd_cap_serial_k; return;
             case simsimd_metric_l2sq_k: *m = (m_t)&simsimd_l2sq_i8_serial, *c = simsimd_cap_serial_k; return;
+            case simsimd_metric_wsum_k: *m = (m_t)&simsimd_wsum_i8_serial, *c = simsimd_cap_serial_k; return;
+            case simsimd_metric_fma_k: *m = (m_t)&simsimd_fma_i8_serial, *c = simsimd_cap_serial_k; return;
+            case simsimd_metric_scale_k: *m = (m_t)&simsimd_scale_i8_serial, *c = simsimd_cap_serial_k; return;
             default: break;
             }
 
@@ -614,11 +855,11 @@ SIMSIMD_PUBLIC void simsimd_find_metric_punned( //
             default: break;
             }
 #endif
-#if SIMSIMD_TARGET_NEON
-        if (viable & simsimd_cap_neon_k)
+#if SIMSIMD_TARGET_NEON_F16
+        if (viable & simsimd_cap_neon_f16_k)
             switch (kind) {
-            case simsimd_metric_dot_k: *m = (m_t)&simsimd_dot_f16c_neon, *c = simsimd_cap_neon_k; return;
-            case simsimd_metric_vdot_k: *m = (m_t)&simsimd_vdot_f16c_neon, *c = simsimd_cap_neon_k; return;
+            case simsimd_metric_dot_k: *m = (m_t)&simsimd_dot_f16c_neon, *c = simsimd_cap_neon_f16_k; return;
+            case simsimd_metric_vdot_k: *m = (m_t)&simsimd_vdot_f16c_neon, *c = simsimd_cap_neon_f16_k; return;
             default: break;
             }
 #endif
@@ -669,78 +910,491 @@ SIMSIMD_PUBLIC void simsimd_find_metric_punned( //
     }
 }
 
-#pragma clang diagnostic pop
-#pragma GCC diagnostic pop
-
 /**
- *  @brief  Selects the most suitable metric implementation based on the given metric kind, datatype,
- *          and allowed capabilities. @b Don't call too often and prefer caching the `simsimd_capabilities()`.
+ *  @brief  Determines the best suited scale-and-cast kernel, computing `alpha * a + beta` over `input_type`
+ *          vectors and exporting `output_type` vectors. For matching types, it is the same as looking up
+ *          the `simsimd_metric_scale_k` kernel with `simsimd_find_metric_punned`.
  *
- *  @param kind The kind of metric to be evaluated.
- *  @param datatype The data type for which the metric needs to be evaluated.
+ *  @param input_type The data type of the input vector.
+ *  @param output_type The data type of the output vector.
+ *  @param supported The hardware capabilities supported by the CPU.
  *  @param allowed The hardware capabilities allowed for use.
- *  @return A function pointer to the selected metric implementation.
+ *  @param kernel_output Output variable for the selected kernel, or zero if the conversion is not supported.
+ *  @param capability_output Output variable for the utilized hardware capabilities.
  */
-SIMSIMD_PUBLIC simsimd_metric_punned_t simsimd_metric_punned( //
-    simsimd_metric_kind_t kind,                               //
-    simsimd_datatype_t datatype,                              //
-    simsimd_capability_t allowed) {
+SIMSIMD_PUBLIC void simsimd_find_scale_punned(    //
+    simsimd_datatype_t input_type,                //
+    simsimd_datatype_t output_type,               //
+    simsimd_capability_t supported,               //
+    simsimd_capability_t allowed,                 //
+    simsimd_kernel_scale_punned_t* kernel_output, //
+    simsimd_capability_t* capability_output) {
 
-    simsimd_metric_punned_t result = 0;
-    simsimd_capability_t c = simsimd_cap_serial_k;
-    simsimd_capability_t supported = simsimd_capabilities();
-    simsimd_find_metric_punned(kind, datatype, supported, allowed, &result, &c);
-    return result;
-}
+    simsimd_kernel_scale_punned_t* k = kernel_output;
+    simsimd_capability_t* c = capability_output;
+    simsimd_capability_t viable = (simsimd_capability_t)(supported & allowed);
+    *k = (simsimd_kernel_scale_punned_t)0;
+    *c = (simsimd_capability_t)0;
 
-#if SIMSIMD_DYNAMIC_DISPATCH
+    if (input_type == output_type) {
+        simsimd_find_metric_punned(simsimd_metric_scale_k, input_type, supported, allowed,
+                                   (simsimd_metric_punned_t*)kernel_output, capability_output);
+        return;
+    }
 
-/*  Run-time feature-testing functions
- *  - Check if the CPU supports NEON or SVE extensions on Arm
- *  - Check if the CPU supports AVX2 and F16C extensions on Haswell x86 CPUs and newer
- *  - Check if the CPU supports AVX512F and AVX512BW extensions on Skylake x86 CPUs and newer
- *  - Check if the CPU supports AVX512VNNI, AVX512IFMA, AVX512BITALG, AVX512VBMI2, and AVX512VPOPCNTDQ
- *    extensions on Ice Lake x86 CPUs and newer
- *  - Check if the CPU supports AVX512FP16 extensions on Sapphire Rapids x86 CPUs and newer
+    typedef simsimd_kernel_scale_punned_t k_t;
+    switch (input_type) {
+
+    // Downcasting single-precision floating-point vectors
+    case simsimd_datatype_f32_k:
+
+#if SIMSIMD_TARGET_NEON
+        if (viable & simsimd_cap_neon_k)
+            switch (output_type) {
+            case simsimd_datatype_i8_k: *k = (k_t)&simsimd_scale_f32_to_i8_neon, *c = simsimd_cap_neon_k; return;
+            default: break;
+            }
+#endif
+#if SIMSIMD_TARGET_NEON_F16
+        if (viable & simsimd_cap_neon_f16_k)
+            switch (output_type) {
+            case simsimd_datatype_f16_k: *k = (k_t)&simsimd_scale_f32_to_f16_neon, *c = simsimd_cap_neon_f16_k; return;
+            default: break;
+            }
+#endif
+#if SIMSIMD_TARGET_HASWELL
+        if (viable & simsimd_cap_haswell_k)
+            switch (output_type) {
+            case simsimd_datatype_f16_k:
+                *k = (k_t)&simsimd_scale_f32_to_f16_haswell, *c = simsimd_cap_haswell_k;
+                return;
+            case simsimd_datatype_bf16_k:
+                *k = (k_t)&simsimd_scale_f32_to_bf16_haswell, *c = simsimd_cap_haswell_k;
+                return;
+            case simsimd_datatype_i8_k: *k = (k_t)&simsimd_scale_f32_to_i8_haswell, *c = simsimd_cap_haswell_k; return;
+            default: break;
+            }
+#endif
+
+        if (viable & simsimd_cap_serial_k)
+            switch (output_type) {
+            case simsimd_datatype_f16_k: *k = (k_t)&simsimd_scale_f32_to_f16_serial, *c = simsimd_cap_serial_k; return;
+            case simsimd_datatype_bf16_k:
+                *k = (k_t)&simsimd_scale_f32_to_bf16_serial, *c = simsimd_cap_serial_k;
+                return;
+            case simsimd_datatype_i8_k: *k = (k_t)&simsimd_scale_f32_to_i8_serial, *c = simsimd_cap_serial_k; return;
+            default: break;
+            }
+
+        break;
+
+    // Upcasting half-precision floating-point vectors
+    case simsimd_datatype_f16_k:
+
+#if SIMSIMD_TARGET_NEON_F16
+        if (viable & simsimd_cap_neon_f16_k)
+            switch (output_type) {
+            case simsimd_datatype_f32_k: *k = (k_t)&simsimd_scale_f16_to_f32_neon, *c = simsimd_cap_neon_f16_k; return;
+            default: break;
+            }
+#endif
+#if SIMSIMD_TARGET_HASWELL
+        if (viable & simsimd_cap_haswell_k)
+            switch (output_type) {
+            case simsimd_datatype_f32_k:
+                *k = (k_t)&simsimd_scale_f16_to_f32_haswell, *c = simsimd_cap_haswell_k;
+                return;
+            default: break;
+            }
+#endif
+
+        if (viable & simsimd_cap_serial_k)
+            switch (output_type) {
+            case simsimd_datatype_f32_k: *k = (k_t)&simsimd_scale_f16_to_f32_serial, *c = simsimd_cap_serial_k; return;
+            default: break;
+            }
+
+        break;
+
+    // Upcasting brain floating-point vectors
+    case simsimd_datatype_bf16_k:
+
+#if SIMSIMD_TARGET_HASWELL
+        if (viable & simsimd_cap_haswell_k)
+            switch (output_type) {
+            case simsimd_datatype_f32_k:
+                *k = (k_t)&simsimd_scale_bf16_to_f32_haswell, *c = simsimd_cap_haswell_k;
+                return;
+            default: break;
+            }
+#endif
+
+        if (viable & simsimd_cap_serial_k)
+            switch (output_type) {
+            case simsimd_datatype_f32_k: *k = (k_t)&simsimd_scale_bf16_to_f32_serial, *c = simsimd_cap_serial_k; return;
+            default: break;
+            }
+
+        break;
+
+    // Dequantizing 8-bit integer vectors
+    case simsimd_datatype_i8_k:
+
+#if SIMSIMD_TARGET_NEON
+        if (viable & simsimd_cap_neon_k)
+            switch (output_type) {
+            case simsimd_datatype_f32_k: *k = (k_t)&simsimd_scale_i8_to_f32_neon, *c = simsimd_cap_neon_k; return;
+            default: break;
+            }
+#endif
+#if SIMSIMD_TARGET_HASWELL
+        if (viable & simsimd_cap_haswell_k)
+            switch (output_type) {
+            case simsimd_datatype_f32_k: *k = (k_t)&simsimd_scale_i8_to_f32_haswell, *c = simsimd_cap_haswell_k; return;
+            default: break;
+            }
+#endif
+
+        if (viable & simsimd_cap_serial_k)
+            switch (output_type) {
+            case simsimd_datatype_f32_k: *k = (k_t)&simsimd_scale_i8_to_f32_serial, *c = simsimd_cap_serial_k; return;
+            default: break;
+            }
+
+        break;
+
+    default: break;
+    }
+}
+
+/**
+ *  @brief  Determines the best suited per-dimension affine kernel, computing `alphas[i] * a[i] + betas[i]`,
+ *          to quantize `f32` vectors into `i8` or to dequantize them back.
  *
- *  @return 1 if the CPU supports the SIMD instruction set, 0 otherwise.
+ *  @param input_type The data type of the input vector.
+ *  @param output_type The data type of the output vector.
+ *  @param supported The hardware capabilities supported by the CPU.
+ *  @param allowed The hardware capabilities allowed for use.
+ *  @param kernel_output Output variable for the selected kernel, or zero if the conversion is not supported.
+ *  @param capability_output Output variable for the utilized hardware capabilities.
  */
-SIMSIMD_DYNAMIC int simsimd_uses_neon(void);
-SIMSIMD_DYNAMIC int simsimd_uses_sve(void);
-SIMSIMD_DYNAMIC int simsimd_uses_haswell(void);
-SIMSIMD_DYNAMIC int simsimd_uses_skylake(void);
-SIMSIMD_DYNAMIC int simsimd_uses_ice(void);
-SIMSIMD_DYNAMIC int simsimd_uses_sapphire(void);
-SIMSIMD_DYNAMIC int simsimd_uses_genoa(void);
-SIMSIMD_DYNAMIC simsimd_capability_t simsimd_capabilities(void);
+SIMSIMD_PUBLIC void simsimd_find_affine_punned(    //
+    simsimd_datatype_t input_type,                 //
+    simsimd_datatype_t output_type,                //
+    simsimd_capability_t supported,                //
+    simsimd_capability_t allowed,                  //
+    simsimd_kernel_affine_punned_t* kernel_output, //
+    simsimd_capability_t* capability_output) {
 
-/*  Inner products
- *  - Dot product: the sum of the products of the corresponding elements of two vectors.
- *  - Complex Dot product: dot product with a conjugate first argument.
- *  - Complex Conjugate Dot product: dot product with a conjugate first argument.
- *
- *  @param a The first vector.
- *  @param b The second vector.
- *  @param n The number of elements in the vectors. Even for complex variants (the number of scalars).
- *  @param d The output distance value.
+    simsimd_kernel_affine_punned_t* k = kernel_output;
+    simsimd_capability_t* c = capability_output;
+    simsimd_capability_t viable = (simsimd_capability_t)(supported & allowed);
+    *k = (simsimd_kernel_affine_punned_t)0;
+    *c = (simsimd_capability_t)0;
+
+    typedef simsimd_kernel_affine_punned_t k_t;
+    if (input_type == simsimd_datatype_f32_k && output_type == simsimd_datatype_i8_k) {
+#if SIMSIMD_TARGET_NEON
+        if (viable & simsimd_cap_neon_k) {
+            *k = (k_t)&simsimd_affine_f32_to_i8_neon, *c = simsimd_cap_neon_k;
+            return;
+        }
+#endif
+#if SIMSIMD_TARGET_HASWELL
+        if (viable & simsimd_cap_haswell_k) {
+            *k = (k_t)&simsimd_affine_f32_to_i8_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        }
+#endif
+        if (viable & simsimd_cap_serial_k) {
+            *k = (k_t)&simsimd_affine_f32_to_i8_serial, *c = simsimd_cap_serial_k;
+            return;
+        }
+    }
+    else if (input_type == simsimd_datatype_i8_k && output_type == simsimd_datatype_f32_k) {
+#if SIMSIMD_TARGET_NEON
+        if (viable & simsimd_cap_neon_k) {
+            *k = (k_t)&simsimd_affine_i8_to_f32_neon, *c = simsimd_cap_neon_k;
+            return;
+        }
+#endif
+#if SIMSIMD_TARGET_HASWELL
+        if (viable & simsimd_cap_haswell_k) {
+            *k = (k_t)&simsimd_affine_i8_to_f32_haswell, *c = simsimd_cap_haswell_k;
+            return;
+        }
+#endif
+        if (viable & simsimd_cap_serial_k) {
+            *k = (k_t)&simsimd_affine_i8_to_f32_serial, *c = simsimd_cap_serial_k;
+            return;
+        }
+    }
+}
+
+/**
+ *  @brief  Determines the best suited fused nearest-centroid assignment kernel, returning only the index of the
+ *          closest centroid for every input vector, instead of the whole matrix of distances.
  *
- *  @note The dot product can be negative, to use as a distance, take `1 - a * b`.
- *  @note The dot product is zero if and only if the two vectors are orthogonal.
- *  @note Defined only for floating-point and integer data types.
+ *  @param kind The kind of metric, one of `l2sq`, `cos`, or `dot`, the latter selecting the largest inner product.
+ *  @param datatype The data type of the input vectors and centroids.
+ *  @param supported The hardware capabilities supported by the CPU.
+ *  @param allowed The hardware capabilities allowed for use.
+ *  @param kernel_output Output variable for the selected kernel, or zero if the metric or type is not supported.
+ *  @param capability_output Output variable for the utilized hardware capabilities.
  */
-SIMSIMD_DYNAMIC void simsimd_dot_f16(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n,
-                                     simsimd_distance_t* d);
-SIMSIMD_DYNAMIC void simsimd_dot_bf16(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n,
-                                      simsimd_distance_t* d);
-SIMSIMD_DYNAMIC void simsimd_dot_f32(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n,
-                                     simsimd_distance_t* d);
-SIMSIMD_DYNAMIC void simsimd_dot_f64(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n,
-                                     simsimd_distance_t* d);
-SIMSIMD_DYNAMIC void simsimd_dot_f16c(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n,
-                                      simsimd_distance_t* d);
-SIMSIMD_DYNAMIC void simsimd_dot_bf16c(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n,
-                                       simsimd_distance_t* d);
-SIMSIMD_DYNAMIC void simsimd_dot_f32c(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n,
+SIMSIMD_PUBLIC void simsimd_find_assign_punned(    //
+    simsimd_metric_kind_t kind,                    //
+    simsimd_datatype_t datatype,                   //
+    simsimd_capability_t supported,                //
+    simsimd_capability_t allowed,                  //
+    simsimd_kernel_assign_punned_t* kernel_output, //
+    simsimd_capability_t* capability_output) {
+
+    simsimd_kernel_assign_punned_t* k = kernel_output;
+    simsimd_capability_t* c = capability_output;
+    simsimd_capability_t viable = (simsimd_capability_t)(supported & allowed);
+    *k = (simsimd_kernel_assign_punned_t)0;
+    *c = (simsimd_capability_t)0;
+    if (datatype != simsimd_datatype_f32_k)
+        return;
+
+    typedef simsimd_kernel_assign_punned_t k_t;
+#if SIMSIMD_TARGET_NEON
+    if (viable & simsimd_cap_neon_k) {
+        switch (kind) {
+        case simsimd_metric_l2sq_k: *k = (k_t)&simsimd_assign_l2sq_f32_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_cos_k: *k = (k_t)&simsimd_assign_cos_f32_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_dot_k: *k = (k_t)&simsimd_assign_dot_f32_neon, *c = simsimd_cap_neon_k; return;
+        default: return;
+        }
+    }
+#endif
+#if SIMSIMD_TARGET_SKYLAKE
+    if (viable & simsimd_cap_skylake_k) {
+        switch (kind) {
+        case simsimd_metric_l2sq_k: *k = (k_t)&simsimd_assign_l2sq_f32_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_cos_k: *k = (k_t)&simsimd_assign_cos_f32_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_dot_k: *k = (k_t)&simsimd_assign_dot_f32_skylake, *c = simsimd_cap_skylake_k; return;
+        default: return;
+        }
+    }
+#endif
+#if SIMSIMD_TARGET_HASWELL
+    if (viable & simsimd_cap_haswell_k) {
+        switch (kind) {
+        case simsimd_metric_l2sq_k: *k = (k_t)&simsimd_assign_l2sq_f32_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_cos_k: *k = (k_t)&simsimd_assign_cos_f32_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_dot_k: *k = (k_t)&simsimd_assign_dot_f32_haswell, *c = simsimd_cap_haswell_k; return;
+        default: return;
+        }
+    }
+#endif
+    if (viable & simsimd_cap_serial_k) {
+        switch (kind) {
+        case simsimd_metric_l2sq_k: *k = (k_t)&simsimd_assign_l2sq_f32_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_cos_k: *k = (k_t)&simsimd_assign_cos_f32_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_dot_k: *k = (k_t)&simsimd_assign_dot_f32_serial, *c = simsimd_cap_serial_k; return;
+        default: return;
+        }
+    }
+}
+
+/**
+ *  @brief  Determines the best suited kernel for distances between vectors and rows packed into panels
+ *          by `simsimd_pack_f32`, that needs no horizontal reductions.
+ *
+ *  @param kind The kind of metric, one of `l2sq`, `cos`, or `dot`.
+ *  @param datatype The data type of the input vectors and packed rows.
+ *  @param supported The hardware capabilities supported by the CPU.
+ *  @param allowed The hardware capabilities allowed for use.
+ *  @param kernel_output Output variable for the selected kernel, or zero if the metric or type is not supported.
+ *  @param capability_output Output variable for the utilized hardware capabilities.
+ */
+SIMSIMD_PUBLIC void simsimd_find_packed_punned(    //
+    simsimd_metric_kind_t kind,                    //
+    simsimd_datatype_t datatype,                   //
+    simsimd_capability_t supported,                //
+    simsimd_capability_t allowed,                  //
+    simsimd_kernel_packed_punned_t* kernel_output, //
+    simsimd_capability_t* capability_output) {
+
+    simsimd_kernel_packed_punned_t* k = kernel_output;
+    simsimd_capability_t* c = capability_output;
+    simsimd_capability_t viable = (simsimd_capability_t)(supported & allowed);
+    *k = (simsimd_kernel_packed_punned_t)0;
+    *c = (simsimd_capability_t)0;
+    if (datatype != simsimd_datatype_f32_k)
+        return;
+
+    typedef simsimd_kernel_packed_punned_t k_t;
+#if SIMSIMD_TARGET_NEON
+    if (viable & simsimd_cap_neon_k) {
+        switch (kind) {
+        case simsimd_metric_l2sq_k: *k = (k_t)&simsimd_packed_l2sq_f32_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_cos_k: *k = (k_t)&simsimd_packed_cos_f32_neon, *c = simsimd_cap_neon_k; return;
+        case simsimd_metric_dot_k: *k = (k_t)&simsimd_packed_dot_f32_neon, *c = simsimd_cap_neon_k; return;
+        default: return;
+        }
+    }
+#endif
+#if SIMSIMD_TARGET_SKYLAKE
+    if (viable & simsimd_cap_skylake_k) {
+        switch (kind) {
+        case simsimd_metric_l2sq_k: *k = (k_t)&simsimd_packed_l2sq_f32_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_cos_k: *k = (k_t)&simsimd_packed_cos_f32_skylake, *c = simsimd_cap_skylake_k; return;
+        case simsimd_metric_dot_k: *k = (k_t)&simsimd_packed_dot_f32_skylake, *c = simsimd_cap_skylake_k; return;
+        default: return;
+        }
+    }
+#endif
+#if SIMSIMD_TARGET_HASWELL
+    if (viable & simsimd_cap_haswell_k) {
+        switch (kind) {
+        case simsimd_metric_l2sq_k: *k = (k_t)&simsimd_packed_l2sq_f32_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_cos_k: *k = (k_t)&simsimd_packed_cos_f32_haswell, *c = simsimd_cap_haswell_k; return;
+        case simsimd_metric_dot_k: *k = (k_t)&simsimd_packed_dot_f32_haswell, *c = simsimd_cap_haswell_k; return;
+        default: return;
+        }
+    }
+#endif
+    if (viable & simsimd_cap_serial_k) {
+        switch (kind) {
+        case simsimd_metric_l2sq_k: *k = (k_t)&simsimd_packed_l2sq_f32_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_cos_k: *k = (k_t)&simsimd_packed_cos_f32_serial, *c = simsimd_cap_serial_k; return;
+        case simsimd_metric_dot_k: *k = (k_t)&simsimd_packed_dot_f32_serial, *c = simsimd_cap_serial_k; return;
+        default: return;
+        }
+    }
+}
+
+/**
+ *  @brief  Determines the best suited kernel for the L2 normalization of many vectors at once,
+ *          fusing the norm computation and the scaling of every row.
+ *
+ *  @param datatype The data type of the input and output vectors.
+ *  @param supported The hardware capabilities supported by the CPU.
+ *  @param allowed The hardware capabilities allowed for use.
+ *  @param kernel_output Output variable for the selected kernel, or zero if the type is not supported.
+ *  @param capability_output Output variable for the utilized hardware capabilities.
+ */
+SIMSIMD_PUBLIC void simsimd_find_normalize_punned(    //
+    simsimd_datatype_t datatype,                      //
+    simsimd_capability_t supported,                   //
+    simsimd_capability_t allowed,                     //
+    simsimd_kernel_normalize_punned_t* kernel_output, //
+    simsimd_capability_t* capability_output) {
+
+    simsimd_kernel_normalize_punned_t* k = kernel_output;
+    simsimd_capability_t* c = capability_output;
+    simsimd_capability_t viable = (simsimd_capability_t)(supported & allowed);
+    *k = (simsimd_kernel_normalize_punned_t)0;
+    *c = (simsimd_capability_t)0;
+    if (datatype != simsimd_datatype_f32_k)
+        return;
+
+    typedef simsimd_kernel_normalize_punned_t k_t;
+#if SIMSIMD_TARGET_NEON
+    if (viable & simsimd_cap_neon_k) {
+        *k = (k_t)&simsimd_normalize_f32_neon, *c = simsimd_cap_neon_k;
+        return;
+    }
+#endif
+#if SIMSIMD_TARGET_SKYLAKE
+    if (viable & simsimd_cap_skylake_k) {
+        *k = (k_t)&simsimd_normalize_f32_skylake, *c = simsimd_cap_skylake_k;
+        return;
+    }
+#endif
+#if SIMSIMD_TARGET_HASWELL
+    if (viable & simsimd_cap_haswell_k) {
+        *k = (k_t)&simsimd_normalize_f32_haswell, *c = simsimd_cap_haswell_k;
+        return;
+    }
+#endif
+    if (viable & simsimd_cap_serial_k)
+        *k = (k_t)&simsimd_normalize_f32_serial, *c = simsimd_cap_serial_k;
+}
+
+#pragma clang diagnostic pop
+#pragma GCC diagnostic pop
+
+/**
+ *  @brief  Selects the most suitable metric implementation based on the given metric kind, datatype,
+ *          and allowed capabilities. @b Don't call too often and prefer caching the `simsimd_capabilities()`.
+ *
+ *  @param kind The kind of metric to be evaluated.
+ *  @param datatype The data type for which the metric needs to be evaluated.
+ *  @param allowed The hardware capabilities allowed for use.
+ *  @return A function pointer to the selected metric implementation.
+ */
+SIMSIMD_PUBLIC simsimd_metric_punned_t simsimd_metric_punned( //
+    simsimd_metric_kind_t kind,                               //
+    simsimd_datatype_t datatype,                              //
+    simsimd_capability_t allowed) {
+
+    simsimd_metric_punned_t result = 0;
+    simsimd_capability_t c = simsimd_cap_serial_k;
+    simsimd_capability_t supported = simsimd_capabilities();
+    simsimd_find_metric_punned(kind, datatype, supported, allowed, &result, &c);
+    return result;
+}
+
+#if SIMSIMD_DYNAMIC_DISPATCH
+
+/*  Run-time feature-testing functions
+ *  - Check if the CPU supports NEON or SVE extensions on Arm
+ *  - Check if the CPU supports FP16, BF16, and DotProd extensions of NEON on Armv8.2+ CPUs
+ *  - Check if the CPU supports AVX2 and F16C extensions on Haswell x86 CPUs and newer
+ *  - Check if the CPU supports AVX-VNNI extensions on Alder Lake x86 CPUs and newer
+ *  - Check if the CPU supports AVX512F and AVX512BW extensions on Skylake x86 CPUs and newer
+ *  - Check if the CPU supports AVX512VNNI, AVX512IFMA, AVX512BITALG, AVX512VBMI2, and AVX512VPOPCNTDQ
+ *    extensions on Ice Lake x86 CPUs and newer
+ *  - Check if the CPU supports AVX512FP16 extensions on Sapphire Rapids x86 CPUs and newer
+ *
+ *  @return 1 if the CPU supports the SIMD instruction set, 0 otherwise.
+ */
+SIMSIMD_DYNAMIC int simsimd_uses_neon(void);
+SIMSIMD_DYNAMIC int simsimd_uses_neon_f16(void);
+SIMSIMD_DYNAMIC int simsimd_uses_neon_bf16(void);
+SIMSIMD_DYNAMIC int simsimd_uses_neon_i8(void);
+SIMSIMD_DYNAMIC int simsimd_uses_sve(void);
+SIMSIMD_DYNAMIC int simsimd_uses_haswell(void);
+SIMSIMD_DYNAMIC int simsimd_uses_alder(void);
+SIMSIMD_DYNAMIC int simsimd_uses_skylake(void);
+SIMSIMD_DYNAMIC int simsimd_uses_ice(void);
+SIMSIMD_DYNAMIC int simsimd_uses_sapphire(void);
+SIMSIMD_DYNAMIC int simsimd_uses_genoa(void);
+SIMSIMD_DYNAMIC simsimd_capability_t simsimd_capabilities(void);
+
+/*  Inner products
+ *  - Dot product: the sum of the products of the corresponding elements of two vectors.
+ *  - Complex Dot product: dot product with a conjugate first argument.
+ *  - Complex Conjugate Dot product: dot product with a conjugate first argument.
+ *
+ *  @param a The first vector.
+ *  @param b The second vector.
+ *  @param n The number of elements in the vectors. Even for complex variants (the number of scalars).
+ *  @param d The output distance value.
+ *
+ *  @note The dot product can be negative, to use as a distance, take `1 - a * b`.
+ *  @note The dot product is zero if and only if the two vectors are orthogonal.
+ *  @note Defined only for floating-point and integer data types.
+ */
+SIMSIMD_DYNAMIC void simsimd_dot_i8(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n,
+                                    simsimd_distance_t* d);
+SIMSIMD_DYNAMIC void simsimd_dot_f16(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n,
+                                     simsimd_distance_t* d);
+SIMSIMD_DYNAMIC void simsimd_dot_bf16(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n,
+                                      simsimd_distance_t* d);
+SIMSIMD_DYNAMIC void simsimd_dot_f32(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n,
+                                     simsimd_distance_t* d);
+SIMSIMD_DYNAMIC void simsimd_dot_f64(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n,
+                                     simsimd_distance_t* d);
+SIMSIMD_DYNAMIC void simsimd_dot_f16c(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n,
+                                      simsimd_distance_t* d);
+SIMSIMD_DYNAMIC void simsimd_dot_bf16c(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n,
+                                       simsimd_distance_t* d);
+SIMSIMD_DYNAMIC void simsimd_dot_f32c(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n,
                                       simsimd_distance_t* d);
 SIMSIMD_DYNAMIC void simsimd_dot_f64c(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n,
                                       simsimd_distance_t* d);
@@ -836,11 +1490,117 @@ SIMSIMD_DYNAMIC void simsimd_js_f32(simsimd_f32_t const* a, simsimd_f32_t const*
 SIMSIMD_DYNAMIC void simsimd_js_f64(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n,
                                     simsimd_distance_t* d);
 
+/*  Element-wise operations
+ *  - Weighted sum: `alpha * a + beta * b`, for interpolations and centroid updates.
+ *  - Fused multiply-add: `alpha * a * b + beta * c`, for masking and gating.
+ *  - Scale and shift: `alpha * a + beta`, for normalization and quantization.
+ *
+ *  @param a, b, c The input vectors.
+ *  @param n The number of elements in each vector.
+ *  @param alpha, beta The scaling factors.
+ *  @param result The output vector of `n` elements, that may alias any of the inputs.
+ *
+ *  @note Low-precision inputs are upcast to `f32` for the arithmetic.
+ *  @note Integer outputs are rounded to the nearest value and saturated to the [-128, 127] range.
+ */
+SIMSIMD_DYNAMIC void simsimd_wsum_i8(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n,
+                                     simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_i8_t* result);
+SIMSIMD_DYNAMIC void simsimd_wsum_f16(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n,
+                                      simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f16_t* result);
+SIMSIMD_DYNAMIC void simsimd_wsum_bf16(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n,
+                                       simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_bf16_t* result);
+SIMSIMD_DYNAMIC void simsimd_wsum_f32(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n,
+                                      simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f32_t* result);
+SIMSIMD_DYNAMIC void simsimd_wsum_f64(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n,
+                                      simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f64_t* result);
+SIMSIMD_DYNAMIC void simsimd_fma_i8(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_i8_t const* c,
+                                    simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta,
+                                    simsimd_i8_t* result);
+SIMSIMD_DYNAMIC void simsimd_fma_f16(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_f16_t const* c,
+                                     simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta,
+                                     simsimd_f16_t* result);
+SIMSIMD_DYNAMIC void simsimd_fma_bf16(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_bf16_t const* c,
+                                      simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta,
+                                      simsimd_bf16_t* result);
+SIMSIMD_DYNAMIC void simsimd_fma_f32(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_f32_t const* c,
+                                     simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta,
+                                     simsimd_f32_t* result);
+SIMSIMD_DYNAMIC void simsimd_fma_f64(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_f64_t const* c,
+                                     simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta,
+                                     simsimd_f64_t* result);
+SIMSIMD_DYNAMIC void simsimd_scale_i8(simsimd_i8_t const* a, simsimd_size_t n, simsimd_distance_t alpha,
+                                      simsimd_distance_t beta, simsimd_i8_t* result);
+SIMSIMD_DYNAMIC void simsimd_scale_f16(simsimd_f16_t const* a, simsimd_size_t n, simsimd_distance_t alpha,
+                                       simsimd_distance_t beta, simsimd_f16_t* result);
+SIMSIMD_DYNAMIC void simsimd_scale_bf16(simsimd_bf16_t const* a, simsimd_size_t n, simsimd_distance_t alpha,
+                                        simsimd_distance_t beta, simsimd_bf16_t* result);
+SIMSIMD_DYNAMIC void simsimd_scale_f32(simsimd_f32_t const* a, simsimd_size_t n, simsimd_distance_t alpha,
+                                       simsimd_distance_t beta, simsimd_f32_t* result);
+SIMSIMD_DYNAMIC void simsimd_scale_f64(simsimd_f64_t const* a, simsimd_size_t n, simsimd_distance_t alpha,
+                                       simsimd_distance_t beta, simsimd_f64_t* result);
+
+/*  Scale and cast: `alpha * a + beta`, exported in a different type, to compress or decompress the vectors.
+ *  Downcasting to `f16` rounds to nearest, while downcasting to `bf16` truncates, like `simsimd_compress_bf16`.
+ */
+SIMSIMD_DYNAMIC void simsimd_scale_f32_to_f16(simsimd_f32_t const* a, simsimd_size_t n, simsimd_distance_t alpha,
+                                              simsimd_distance_t beta, simsimd_f16_t* result);
+SIMSIMD_DYNAMIC void simsimd_scale_f32_to_bf16(simsimd_f32_t const* a, simsimd_size_t n, simsimd_distance_t alpha,
+                                               simsimd_distance_t beta, simsimd_bf16_t* result);
+SIMSIMD_DYNAMIC void simsimd_scale_f16_to_f32(simsimd_f16_t const* a, simsimd_size_t n, simsimd_distance_t alpha,
+                                              simsimd_distance_t beta, simsimd_f32_t* result);
+SIMSIMD_DYNAMIC void simsimd_scale_bf16_to_f32(simsimd_bf16_t const* a, simsimd_size_t n, simsimd_distance_t alpha,
+                                               simsimd_distance_t beta, simsimd_f32_t* result);
+SIMSIMD_DYNAMIC void simsimd_scale_f32_to_i8(simsimd_f32_t const* a, simsimd_size_t n, simsimd_distance_t alpha,
+                                             simsimd_distance_t beta, simsimd_i8_t* result);
+SIMSIMD_DYNAMIC void simsimd_scale_i8_to_f32(simsimd_i8_t const* a, simsimd_size_t n, simsimd_distance_t alpha,
+                                             simsimd_distance_t beta, simsimd_f32_t* result);
+
+/*  Per-dimension affine cast: `alphas[i] * a[i] + betas[i]`, to quantize `f32` vectors into `i8` or back.
+ *  Integer outputs are rounded to the nearest value and saturated to the [-128, 127] range.
+ */
+SIMSIMD_DYNAMIC void simsimd_affine_f32_to_i8(simsimd_f32_t const* a, simsimd_size_t n, simsimd_f32_t const* alphas,
+                                              simsimd_f32_t const* betas, simsimd_i8_t* result);
+SIMSIMD_DYNAMIC void simsimd_affine_i8_to_f32(simsimd_i8_t const* a, simsimd_size_t n, simsimd_f32_t const* alphas,
+                                              simsimd_f32_t const* betas, simsimd_f32_t* result);
+
+/*  Fused nearest-centroid assignment: the index of the closest of `k` centroids for each of the `count` vectors,
+ *  and optionally the distance to it. The `dot` variant selects the centroid with the largest inner product.
+ */
+SIMSIMD_DYNAMIC void simsimd_assign_l2sq_f32(simsimd_f32_t const* a, simsimd_size_t count,
+                                             simsimd_f32_t const* centroids, simsimd_size_t k, simsimd_size_t n,
+                                             simsimd_size_t* assignments, simsimd_distance_t* distances);
+SIMSIMD_DYNAMIC void simsimd_assign_dot_f32(simsimd_f32_t const* a, simsimd_size_t count,
+                                            simsimd_f32_t const* centroids, simsimd_size_t k, simsimd_size_t n,
+                                            simsimd_size_t* assignments, simsimd_distance_t* distances);
+SIMSIMD_DYNAMIC void simsimd_assign_cos_f32(simsimd_f32_t const* a, simsimd_size_t count,
+                                            simsimd_f32_t const* centroids, simsimd_size_t k, simsimd_size_t n,
+                                            simsimd_size_t* assignments, simsimd_distance_t* distances);
+
+/*  Distances between `a_count` query vectors and `count` rows packed into panels by `simsimd_pack_f32`,
+ *  exported as a row-major `a_count * count` matrix.
+ */
+SIMSIMD_DYNAMIC void simsimd_packed_l2sq_f32(simsimd_f32_t const* a, simsimd_size_t a_count,
+                                             simsimd_f32_t const* packed, simsimd_size_t count, simsimd_size_t n,
+                                             simsimd_distance_t* results);
+SIMSIMD_DYNAMIC void simsimd_packed_dot_f32(simsimd_f32_t const* a, simsimd_size_t a_count,
+                                            simsimd_f32_t const* packed, simsimd_size_t count, simsimd_size_t n,
+                                            simsimd_distance_t* results);
+SIMSIMD_DYNAMIC void simsimd_packed_cos_f32(simsimd_f32_t const* a, simsimd_size_t a_count,
+                                            simsimd_f32_t const* packed, simsimd_size_t count, simsimd_size_t n,
+                                            simsimd_distance_t* results);
+
+/*  Fused L2 normalization of `count` contiguous rows, that can operate in-place, if `result == a`.
+ */
+SIMSIMD_DYNAMIC void simsimd_normalize_f32(simsimd_f32_t const* a, simsimd_size_t count, simsimd_size_t n,
+                                           simsimd_f32_t* result);
+
 #else
 
 /*  Compile-time feature-testing functions
  *  - Check if the CPU supports NEON or SVE extensions on Arm
+ *  - Check if the CPU supports FP16, BF16, and DotProd extensions of NEON on Armv8.2+ CPUs
  *  - Check if the CPU supports AVX2 and F16C extensions on Haswell x86 CPUs and newer
+ *  - Check if the CPU supports AVX-VNNI extensions on Alder Lake x86 CPUs and newer
  *  - Check if the CPU supports AVX512F and AVX512BW extensions on Skylake x86 CPUs and newer
  *  - Check if the CPU supports AVX512VNNI, AVX512IFMA, AVX512BITALG, AVX512VBMI2, and AVX512VPOPCNTDQ
  *    extensions on Ice Lake x86 CPUs and newer
@@ -850,8 +1610,12 @@ SIMSIMD_DYNAMIC void simsimd_js_f64(simsimd_f64_t const* a, simsimd_f64_t const*
  *  @return 1 if the CPU supports the SIMD instruction set, 0 otherwise.
  */
 SIMSIMD_PUBLIC int simsimd_uses_neon(void) { return SIMSIMD_TARGET_ARM && SIMSIMD_TARGET_NEON; }
+SIMSIMD_PUBLIC int simsimd_uses_neon_f16(void) { return SIMSIMD_TARGET_ARM && SIMSIMD_TARGET_NEON_F16; }
+SIMSIMD_PUBLIC int simsimd_uses_neon_bf16(void) { return SIMSIMD_TARGET_ARM && SIMSIMD_TARGET_NEON_BF16; }
+SIMSIMD_PUBLIC int simsimd_uses_neon_i8(void) { return SIMSIMD_TARGET_ARM && SIMSIMD_TARGET_NEON_I8; }
 SIMSIMD_PUBLIC int simsimd_uses_sve(void) { return SIMSIMD_TARGET_ARM && SIMSIMD_TARGET_SVE; }
 SIMSIMD_PUBLIC int simsimd_uses_haswell(void) { return SIMSIMD_TARGET_X86 && SIMSIMD_TARGET_HASWELL; }
+SIMSIMD_PUBLIC int simsimd_uses_alder(void) { return SIMSIMD_TARGET_X86 && SIMSIMD_TARGET_ALDER; }
 SIMSIMD_PUBLIC int simsimd_uses_skylake(void) { return SIMSIMD_TARGET_X86 && SIMSIMD_TARGET_SKYLAKE; }
 SIMSIMD_PUBLIC int simsimd_uses_ice(void) { return SIMSIMD_TARGET_X86 && SIMSIMD_TARGET_ICE; }
 SIMSIMD_PUBLIC int simsimd_uses_sapphire(void) { return SIMSIMD_TARGET_X86 && SIMSIMD_TARGET_SAPPHIRE; }
@@ -872,11 +1636,27 @@ SIMSIMD_PUBLIC simsimd_capability_t simsimd_capabilities(void) { return simsimd_
  *  @note The dot product is zero if and only if the two vectors are orthogonal.
  *  @note Defined only for floating-point and integer data types.
  */
+SIMSIMD_PUBLIC void simsimd_dot_i8(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n,
+                                   simsimd_distance_t* d) {
+#if SIMSIMD_TARGET_SVE
+    simsimd_dot_i8_sve(a, b, n, d);
+#elif SIMSIMD_TARGET_NEON_I8
+    simsimd_dot_i8_neon(a, b, n, d);
+#elif SIMSIMD_TARGET_ICE
+    simsimd_dot_i8_ice(a, b, n, d);
+#elif SIMSIMD_TARGET_ALDER
+    simsimd_dot_i8_alder(a, b, n, d);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_dot_i8_haswell(a, b, n, d);
+#else
+    simsimd_dot_i8_serial(a, b, n, d);
+#endif
+}
 SIMSIMD_PUBLIC void simsimd_dot_f16(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n,
                                     simsimd_distance_t* d) {
 #if SIMSIMD_TARGET_SVE
     simsimd_dot_f16_sve(a, b, n, d);
-#elif SIMSIMD_TARGET_NEON
+#elif SIMSIMD_TARGET_NEON_F16
     simsimd_dot_f16_neon(a, b, n, d);
 #elif SIMSIMD_TARGET_SAPPHIRE
     simsimd_dot_f16_sapphire(a, b, n, d);
@@ -889,7 +1669,9 @@ SIMSIMD_PUBLIC void simsimd_dot_f16(simsimd_f16_t const* a, simsimd_f16_t const*
 
 SIMSIMD_PUBLIC void simsimd_dot_bf16(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n,
                                      simsimd_distance_t* d) {
-#if SIMSIMD_TARGET_GENOA
+#if SIMSIMD_TARGET_SVE && SIMSIMD_TARGET_NEON_BF16
+    simsimd_dot_bf16_sve(a, b, n, d);
+#elif SIMSIMD_TARGET_GENOA
     simsimd_dot_bf16_genoa(a, b, n, d);
 #elif SIMSIMD_TARGET_HASWELL
     simsimd_dot_bf16_haswell(a, b, n, d);
@@ -924,7 +1706,7 @@ SIMSIMD_PUBLIC void simsimd_dot_f16c(simsimd_f16_t const* a, simsimd_f16_t const
                                      simsimd_distance_t* d) {
 #if SIMSIMD_TARGET_SVE
     simsimd_dot_f16c_sve(a, b, n, d);
-#elif SIMSIMD_TARGET_NEON
+#elif SIMSIMD_TARGET_NEON_F16
     simsimd_dot_f16c_neon(a, b, n, d);
 #elif SIMSIMD_TARGET_SAPPHIRE
     simsimd_dot_f16c_sapphire(a, b, n, d);
@@ -970,7 +1752,7 @@ SIMSIMD_PUBLIC void simsimd_vdot_f16c(simsimd_f16_t const* a, simsimd_f16_t cons
                                       simsimd_distance_t* d) {
 #if SIMSIMD_TARGET_SVE
     simsimd_vdot_f16c_sve(a, b, n, d);
-#elif SIMSIMD_TARGET_NEON
+#elif SIMSIMD_TARGET_NEON_F16
     simsimd_dot_f16c_neon(a, b, n, d);
 #elif SIMSIMD_TARGET_SAPPHIRE
     simsimd_dot_f16c_sapphire(a, b, n, d);
@@ -1024,10 +1806,14 @@ SIMSIMD_PUBLIC void simsimd_vdot_f64c(simsimd_f64_t const* a, simsimd_f64_t cons
  */
 SIMSIMD_PUBLIC void simsimd_cos_i8(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n,
                                    simsimd_distance_t* d) {
-#if SIMSIMD_TARGET_NEON
+#if SIMSIMD_TARGET_SVE
+    simsimd_cos_i8_sve(a, b, n, d);
+#elif SIMSIMD_TARGET_NEON_I8
     simsimd_cos_i8_neon(a, b, n, d);
 #elif SIMSIMD_TARGET_ICE
     simsimd_cos_i8_ice(a, b, n, d);
+#elif SIMSIMD_TARGET_ALDER
+    simsimd_cos_i8_alder(a, b, n, d);
 #elif SIMSIMD_TARGET_HASWELL
     simsimd_cos_i8_haswell(a, b, n, d);
 #else
@@ -1036,10 +1822,14 @@ SIMSIMD_PUBLIC void simsimd_cos_i8(simsimd_i8_t const* a, simsimd_i8_t const* b,
 }
 SIMSIMD_PUBLIC void simsimd_l2sq_i8(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n,
                                     simsimd_distance_t* d) {
-#if SIMSIMD_TARGET_NEON
+#if SIMSIMD_TARGET_SVE
+    simsimd_l2sq_i8_sve(a, b, n, d);
+#elif SIMSIMD_TARGET_NEON_I8
     simsimd_l2sq_i8_neon(a, b, n, d);
 #elif SIMSIMD_TARGET_ICE
     simsimd_l2sq_i8_ice(a, b, n, d);
+#elif SIMSIMD_TARGET_ALDER
+    simsimd_l2sq_i8_alder(a, b, n, d);
 #elif SIMSIMD_TARGET_HASWELL
     simsimd_l2sq_i8_haswell(a, b, n, d);
 #else
@@ -1050,7 +1840,7 @@ SIMSIMD_PUBLIC void simsimd_cos_f16(simsimd_f16_t const* a, simsimd_f16_t const*
                                     simsimd_distance_t* d) {
 #if SIMSIMD_TARGET_SVE
     simsimd_cos_f16_sve(a, b, n, d);
-#elif SIMSIMD_TARGET_NEON
+#elif SIMSIMD_TARGET_NEON_F16
     simsimd_cos_f16_neon(a, b, n, d);
 #elif SIMSIMD_TARGET_SAPPHIRE
     simsimd_cos_f16_sapphire(a, b, n, d);
@@ -1062,7 +1852,9 @@ SIMSIMD_PUBLIC void simsimd_cos_f16(simsimd_f16_t const* a, simsimd_f16_t const*
 }
 SIMSIMD_PUBLIC void simsimd_cos_bf16(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n,
                                      simsimd_distance_t* d) {
-#if SIMSIMD_TARGET_GENOA
+#if SIMSIMD_TARGET_SVE && SIMSIMD_TARGET_NEON_BF16
+    simsimd_cos_bf16_sve(a, b, n, d);
+#elif SIMSIMD_TARGET_GENOA
     simsimd_cos_bf16_genoa(a, b, n, d);
 #elif SIMSIMD_TARGET_HASWELL
     simsimd_cos_bf16_haswell(a, b, n, d);
@@ -1096,7 +1888,7 @@ SIMSIMD_PUBLIC void simsimd_l2sq_f16(simsimd_f16_t const* a, simsimd_f16_t const
                                      simsimd_distance_t* d) {
 #if SIMSIMD_TARGET_SVE
     simsimd_l2sq_f16_sve(a, b, n, d);
-#elif SIMSIMD_TARGET_NEON
+#elif SIMSIMD_TARGET_NEON_F16
     simsimd_l2sq_f16_neon(a, b, n, d);
 #elif SIMSIMD_TARGET_SAPPHIRE
     simsimd_l2sq_f16_sapphire(a, b, n, d);
@@ -1108,7 +1900,9 @@ SIMSIMD_PUBLIC void simsimd_l2sq_f16(simsimd_f16_t const* a, simsimd_f16_t const
 }
 SIMSIMD_PUBLIC void simsimd_l2sq_bf16(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n,
                                       simsimd_distance_t* d) {
-#if SIMSIMD_TARGET_GENOA
+#if SIMSIMD_TARGET_SVE && SIMSIMD_TARGET_NEON_BF16
+    simsimd_l2sq_bf16_sve(a, b, n, d);
+#elif SIMSIMD_TARGET_GENOA
     simsimd_l2sq_bf16_genoa(a, b, n, d);
 #elif SIMSIMD_TARGET_HASWELL
     simsimd_l2sq_bf16_haswell(a, b, n, d);
@@ -1197,7 +1991,7 @@ SIMSIMD_PUBLIC void simsimd_jaccard_b8(simsimd_b8_t const* a, simsimd_b8_t const
  */
 SIMSIMD_PUBLIC void simsimd_kl_f16(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n,
                                    simsimd_distance_t* d) {
-#if SIMSIMD_TARGET_NEON
+#if SIMSIMD_TARGET_NEON_F16
     simsimd_kl_f16_neon(a, b, n, d);
 #elif SIMSIMD_TARGET_HASWELL
     simsimd_kl_f16_haswell(a, b, n, d);
@@ -1207,7 +2001,11 @@ SIMSIMD_PUBLIC void simsimd_kl_f16(simsimd_f16_t const* a, simsimd_f16_t const*
 }
 SIMSIMD_PUBLIC void simsimd_kl_bf16(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n,
                                     simsimd_distance_t* d) {
+#if SIMSIMD_TARGET_GENOA
+    simsimd_kl_bf16_genoa(a, b, n, d);
+#else
     simsimd_kl_bf16_serial(a, b, n, d);
+#endif
 }
 SIMSIMD_PUBLIC void simsimd_kl_f32(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n,
                                    simsimd_distance_t* d) {
@@ -1225,7 +2023,7 @@ SIMSIMD_PUBLIC void simsimd_kl_f64(simsimd_f64_t const* a, simsimd_f64_t const*
 }
 SIMSIMD_PUBLIC void simsimd_js_f16(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n,
                                    simsimd_distance_t* d) {
-#if SIMSIMD_TARGET_NEON
+#if SIMSIMD_TARGET_NEON_F16
     simsimd_js_f16_neon(a, b, n, d);
 #elif SIMSIMD_TARGET_HASWELL
     simsimd_js_f16_haswell(a, b, n, d);
@@ -1235,7 +2033,11 @@ SIMSIMD_PUBLIC void simsimd_js_f16(simsimd_f16_t const* a, simsimd_f16_t const*
 }
 SIMSIMD_PUBLIC void simsimd_js_bf16(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n,
                                     simsimd_distance_t* d) {
+#if SIMSIMD_TARGET_GENOA
+    simsimd_js_bf16_genoa(a, b, n, d);
+#else
     simsimd_js_bf16_serial(a, b, n, d);
+#endif
 }
 SIMSIMD_PUBLIC void simsimd_js_f32(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n,
                                    simsimd_distance_t* d) {
@@ -1252,7 +2054,938 @@ SIMSIMD_PUBLIC void simsimd_js_f64(simsimd_f64_t const* a, simsimd_f64_t const*
     simsimd_js_f64_serial(a, b, n, d);
 }
 
+/*  Element-wise operations
+ *  - Weighted sum: `alpha * a + beta * b`, for interpolations and centroid updates.
+ *  - Fused multiply-add: `alpha * a * b + beta * c`, for masking and gating.
+ *  - Scale and shift: `alpha * a + beta`, for normalization and quantization.
+ *
+ *  @param a, b, c The input vectors.
+ *  @param n The number of elements in each vector.
+ *  @param alpha, beta The scaling factors.
+ *  @param result The output vector of `n` elements, that may alias any of the inputs.
+ *
+ *  @note Low-precision inputs are upcast to `f32` for the arithmetic.
+ *  @note Integer outputs are rounded to the nearest value and saturated to the [-128, 127] range.
+ */
+SIMSIMD_PUBLIC void simsimd_wsum_i8(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n,
+                                    simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_i8_t* result) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_wsum_i8_skylake(a, b, n, alpha, beta, result);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_wsum_i8_haswell(a, b, n, alpha, beta, result);
+#else
+    simsimd_wsum_i8_serial(a, b, n, alpha, beta, result);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_wsum_f16(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n,
+                                     simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f16_t* result) {
+#if SIMSIMD_TARGET_NEON_F16
+    simsimd_wsum_f16_neon(a, b, n, alpha, beta, result);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_wsum_f16_skylake(a, b, n, alpha, beta, result);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_wsum_f16_haswell(a, b, n, alpha, beta, result);
+#else
+    simsimd_wsum_f16_serial(a, b, n, alpha, beta, result);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_wsum_bf16(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n,
+                                      simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_bf16_t* result) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_wsum_bf16_skylake(a, b, n, alpha, beta, result);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_wsum_bf16_haswell(a, b, n, alpha, beta, result);
+#else
+    simsimd_wsum_bf16_serial(a, b, n, alpha, beta, result);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_wsum_f32(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n,
+                                     simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f32_t* result) {
+#if SIMSIMD_TARGET_NEON
+    simsimd_wsum_f32_neon(a, b, n, alpha, beta, result);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_wsum_f32_skylake(a, b, n, alpha, beta, result);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_wsum_f32_haswell(a, b, n, alpha, beta, result);
+#else
+    simsimd_wsum_f32_serial(a, b, n, alpha, beta, result);
 #endif
+}
+SIMSIMD_PUBLIC void simsimd_wsum_f64(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n,
+                                     simsimd_distance_t alpha, simsimd_distance_t beta, simsimd_f64_t* result) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_wsum_f64_skylake(a, b, n, alpha, beta, result);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_wsum_f64_haswell(a, b, n, alpha, beta, result);
+#else
+    simsimd_wsum_f64_serial(a, b, n, alpha, beta, result);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_fma_i8(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_i8_t const* c,
+                                   simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta,
+                                   simsimd_i8_t* result) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_fma_i8_skylake(a, b, c, n, alpha, beta, result);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_fma_i8_haswell(a, b, c, n, alpha, beta, result);
+#else
+    simsimd_fma_i8_serial(a, b, c, n, alpha, beta, result);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_fma_f16(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_f16_t const* c,
+                                    simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta,
+                                    simsimd_f16_t* result) {
+#if SIMSIMD_TARGET_NEON_F16
+    simsimd_fma_f16_neon(a, b, c, n, alpha, beta, result);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_fma_f16_skylake(a, b, c, n, alpha, beta, result);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_fma_f16_haswell(a, b, c, n, alpha, beta, result);
+#else
+    simsimd_fma_f16_serial(a, b, c, n, alpha, beta, result);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_fma_bf16(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_bf16_t const* c,
+                                     simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta,
+                                     simsimd_bf16_t* result) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_fma_bf16_skylake(a, b, c, n, alpha, beta, result);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_fma_bf16_haswell(a, b, c, n, alpha, beta, result);
+#else
+    simsimd_fma_bf16_serial(a, b, c, n, alpha, beta, result);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_fma_f32(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_f32_t const* c,
+                                    simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta,
+                                    simsimd_f32_t* result) {
+#if SIMSIMD_TARGET_NEON
+    simsimd_fma_f32_neon(a, b, c, n, alpha, beta, result);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_fma_f32_skylake(a, b, c, n, alpha, beta, result);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_fma_f32_haswell(a, b, c, n, alpha, beta, result);
+#else
+    simsimd_fma_f32_serial(a, b, c, n, alpha, beta, result);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_fma_f64(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_f64_t const* c,
+                                    simsimd_size_t n, simsimd_distance_t alpha, simsimd_distance_t beta,
+                                    simsimd_f64_t* result) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_fma_f64_skylake(a, b, c, n, alpha, beta, result);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_fma_f64_haswell(a, b, c, n, alpha, beta, result);
+#else
+    simsimd_fma_f64_serial(a, b, c, n, alpha, beta, result);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_scale_i8(simsimd_i8_t const* a, simsimd_size_t n, simsimd_distance_t alpha,
+                                     simsimd_distance_t beta, simsimd_i8_t* result) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_scale_i8_skylake(a, n, alpha, beta, result);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_scale_i8_haswell(a, n, alpha, beta, result);
+#else
+    simsimd_scale_i8_serial(a, n, alpha, beta, result);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_scale_f16(simsimd_f16_t const* a, simsimd_size_t n, simsimd_distance_t alpha,
+                                      simsimd_distance_t beta, simsimd_f16_t* result) {
+#if SIMSIMD_TARGET_NEON_F16
+    simsimd_scale_f16_neon(a, n, alpha, beta, result);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_scale_f16_skylake(a, n, alpha, beta, result);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_scale_f16_haswell(a, n, alpha, beta, result);
+#else
+    simsimd_scale_f16_serial(a, n, alpha, beta, result);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_scale_bf16(simsimd_bf16_t const* a, simsimd_size_t n, simsimd_distance_t alpha,
+                                       simsimd_distance_t beta, simsimd_bf16_t* result) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_scale_bf16_skylake(a, n, alpha, beta, result);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_scale_bf16_haswell(a, n, alpha, beta, result);
+#else
+    simsimd_scale_bf16_serial(a, n, alpha, beta, result);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_scale_f32(simsimd_f32_t const* a, simsimd_size_t n, simsimd_distance_t alpha,
+                                      simsimd_distance_t beta, simsimd_f32_t* result) {
+#if SIMSIMD_TARGET_NEON
+    simsimd_scale_f32_neon(a, n, alpha, beta, result);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_scale_f32_skylake(a, n, alpha, beta, result);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_scale_f32_haswell(a, n, alpha, beta, result);
+#else
+    simsimd_scale_f32_serial(a, n, alpha, beta, result);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_scale_f64(simsimd_f64_t const* a, simsimd_size_t n, simsimd_distance_t alpha,
+                                      simsimd_distance_t beta, simsimd_f64_t* result) {
+#if SIMSIMD_TARGET_SKYLAKE
+    simsimd_scale_f64_skylake(a, n, alpha, beta, result);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_scale_f64_haswell(a, n, alpha, beta, result);
+#else
+    simsimd_scale_f64_serial(a, n, alpha, beta, result);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_scale_f32_to_f16(simsimd_f32_t const* a, simsimd_size_t n, simsimd_distance_t alpha,
+                                             simsimd_distance_t beta, simsimd_f16_t* result) {
+#if SIMSIMD_TARGET_NEON_F16
+    simsimd_scale_f32_to_f16_neon(a, n, alpha, beta, result);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_scale_f32_to_f16_haswell(a, n, alpha, beta, result);
+#else
+    simsimd_scale_f32_to_f16_serial(a, n, alpha, beta, result);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_scale_f32_to_bf16(simsimd_f32_t const* a, simsimd_size_t n, simsimd_distance_t alpha,
+                                              simsimd_distance_t beta, simsimd_bf16_t* result) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_scale_f32_to_bf16_haswell(a, n, alpha, beta, result);
+#else
+    simsimd_scale_f32_to_bf16_serial(a, n, alpha, beta, result);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_scale_f16_to_f32(simsimd_f16_t const* a, simsimd_size_t n, simsimd_distance_t alpha,
+                                             simsimd_distance_t beta, simsimd_f32_t* result) {
+#if SIMSIMD_TARGET_NEON_F16
+    simsimd_scale_f16_to_f32_neon(a, n, alpha, beta, result);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_scale_f16_to_f32_haswell(a, n, alpha, beta, result);
+#else
+    simsimd_scale_f16_to_f32_serial(a, n, alpha, beta, result);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_scale_bf16_to_f32(simsimd_bf16_t const* a, simsimd_size_t n, simsimd_distance_t alpha,
+                                              simsimd_distance_t beta, simsimd_f32_t* result) {
+#if SIMSIMD_TARGET_HASWELL
+    simsimd_scale_bf16_to_f32_haswell(a, n, alpha, beta, result);
+#else
+    simsimd_scale_bf16_to_f32_serial(a, n, alpha, beta, result);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_scale_f32_to_i8(simsimd_f32_t const* a, simsimd_size_t n, simsimd_distance_t alpha,
+                                            simsimd_distance_t beta, simsimd_i8_t* result) {
+#if SIMSIMD_TARGET_NEON
+    simsimd_scale_f32_to_i8_neon(a, n, alpha, beta, result);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_scale_f32_to_i8_haswell(a, n, alpha, beta, result);
+#else
+    simsimd_scale_f32_to_i8_serial(a, n, alpha, beta, result);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_scale_i8_to_f32(simsimd_i8_t const* a, simsimd_size_t n, simsimd_distance_t alpha,
+                                            simsimd_distance_t beta, simsimd_f32_t* result) {
+#if SIMSIMD_TARGET_NEON
+    simsimd_scale_i8_to_f32_neon(a, n, alpha, beta, result);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_scale_i8_to_f32_haswell(a, n, alpha, beta, result);
+#else
+    simsimd_scale_i8_to_f32_serial(a, n, alpha, beta, result);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_affine_f32_to_i8(simsimd_f32_t const* a, simsimd_size_t n, simsimd_f32_t const* alphas,
+                                             simsimd_f32_t const* betas, simsimd_i8_t* result) {
+#if SIMSIMD_TARGET_NEON
+    simsimd_affine_f32_to_i8_neon(a, n, alphas, betas, result);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_affine_f32_to_i8_haswell(a, n, alphas, betas, result);
+#else
+    simsimd_affine_f32_to_i8_serial(a, n, alphas, betas, result);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_affine_i8_to_f32(simsimd_i8_t const* a, simsimd_size_t n, simsimd_f32_t const* alphas,
+                                             simsimd_f32_t const* betas, simsimd_f32_t* result) {
+#if SIMSIMD_TARGET_NEON
+    simsimd_affine_i8_to_f32_neon(a, n, alphas, betas, result);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_affine_i8_to_f32_haswell(a, n, alphas, betas, result);
+#else
+    simsimd_affine_i8_to_f32_serial(a, n, alphas, betas, result);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_assign_l2sq_f32(simsimd_f32_t const* a, simsimd_size_t count,
+                                            simsimd_f32_t const* centroids, simsimd_size_t k, simsimd_size_t n,
+                                            simsimd_size_t* assignments, simsimd_distance_t* distances) {
+#if SIMSIMD_TARGET_NEON
+    simsimd_assign_l2sq_f32_neon(a, count, centroids, k, n, assignments, distances);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_assign_l2sq_f32_skylake(a, count, centroids, k, n, assignments, distances);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_assign_l2sq_f32_haswell(a, count, centroids, k, n, assignments, distances);
+#else
+    simsimd_assign_l2sq_f32_serial(a, count, centroids, k, n, assignments, distances);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_assign_dot_f32(simsimd_f32_t const* a, simsimd_size_t count,
+                                           simsimd_f32_t const* centroids, simsimd_size_t k, simsimd_size_t n,
+                                           simsimd_size_t* assignments, simsimd_distance_t* distances) {
+#if SIMSIMD_TARGET_NEON
+    simsimd_assign_dot_f32_neon(a, count, centroids, k, n, assignments, distances);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_assign_dot_f32_skylake(a, count, centroids, k, n, assignments, distances);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_assign_dot_f32_haswell(a, count, centroids, k, n, assignments, distances);
+#else
+    simsimd_assign_dot_f32_serial(a, count, centroids, k, n, assignments, distances);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_assign_cos_f32(simsimd_f32_t const* a, simsimd_size_t count,
+                                           simsimd_f32_t const* centroids, simsimd_size_t k, simsimd_size_t n,
+                                           simsimd_size_t* assignments, simsimd_distance_t* distances) {
+#if SIMSIMD_TARGET_NEON
+    simsimd_assign_cos_f32_neon(a, count, centroids, k, n, assignments, distances);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_assign_cos_f32_skylake(a, count, centroids, k, n, assignments, distances);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_assign_cos_f32_haswell(a, count, centroids, k, n, assignments, distances);
+#else
+    simsimd_assign_cos_f32_serial(a, count, centroids, k, n, assignments, distances);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_packed_l2sq_f32(simsimd_f32_t const* a, simsimd_size_t a_count,
+                                            simsimd_f32_t const* packed, simsimd_size_t count, simsimd_size_t n,
+                                            simsimd_distance_t* results) {
+#if SIMSIMD_TARGET_NEON
+    simsimd_packed_l2sq_f32_neon(a, a_count, packed, count, n, results);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_packed_l2sq_f32_skylake(a, a_count, packed, count, n, results);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_packed_l2sq_f32_haswell(a, a_count, packed, count, n, results);
+#else
+    simsimd_packed_l2sq_f32_serial(a, a_count, packed, count, n, results);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_packed_dot_f32(simsimd_f32_t const* a, simsimd_size_t a_count,
+                                           simsimd_f32_t const* packed, simsimd_size_t count, simsimd_size_t n,
+                                           simsimd_distance_t* results) {
+#if SIMSIMD_TARGET_NEON
+    simsimd_packed_dot_f32_neon(a, a_count, packed, count, n, results);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_packed_dot_f32_skylake(a, a_count, packed, count, n, results);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_packed_dot_f32_haswell(a, a_count, packed, count, n, results);
+#else
+    simsimd_packed_dot_f32_serial(a, a_count, packed, count, n, results);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_packed_cos_f32(simsimd_f32_t const* a, simsimd_size_t a_count,
+                                           simsimd_f32_t const* packed, simsimd_size_t count, simsimd_size_t n,
+                                           simsimd_distance_t* results) {
+#if SIMSIMD_TARGET_NEON
+    simsimd_packed_cos_f32_neon(a, a_count, packed, count, n, results);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_packed_cos_f32_skylake(a, a_count, packed, count, n, results);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_packed_cos_f32_haswell(a, a_count, packed, count, n, results);
+#else
+    simsimd_packed_cos_f32_serial(a, a_count, packed, count, n, results);
+#endif
+}
+SIMSIMD_PUBLIC void simsimd_normalize_f32(simsimd_f32_t const* a, simsimd_size_t count, simsimd_size_t n,
+                                          simsimd_f32_t* result) {
+#if SIMSIMD_TARGET_NEON
+    simsimd_normalize_f32_neon(a, count, n, result);
+#elif SIMSIMD_TARGET_SKYLAKE
+    simsimd_normalize_f32_skylake(a, count, n, result);
+#elif SIMSIMD_TARGET_HASWELL
+    simsimd_normalize_f32_haswell(a, count, n, result);
+#else
+    simsimd_normalize_f32_serial(a, count, n, result);
+#endif
+}
+
+#endif
+
+/*  Norms of many vectors at once, to be cached alongside the vectors
+ *  - L2 norm: the square root of the dot-product of a vector with itself.
+ *  - Squared L2 norm: the dot-product of a vector with itself.
+ *
+ *  @param a The first of `count` contiguous vectors.
+ *  @param count The number of vectors.
+ *  @param n The number of elements in each vector.
+ *  @param norms The output array of `count` norms.
+ */
+#define SIMSIMD_MAKE_NORMS(input_type)                                                                                 \
+    SIMSIMD_PUBLIC void simsimd_norms_squared_##input_type(simsimd_##input_type##_t const* a,                          \
+                                                           simsimd_size_t count, simsimd_size_t n,                     \
+                                                           simsimd_distance_t* norms) {                                \
+        for (simsimd_size_t i = 0; i != count; ++i, a += n)                                                            \
+            simsimd_dot_##input_type(a, a, n, norms + i);                                                              \
+    }                                                                                                                  \
+    SIMSIMD_PUBLIC void simsimd_norms_##input_type(simsimd_##input_type##_t const* a, simsimd_size_t count,            \
+                                                   simsimd_size_t n, simsimd_distance_t* norms) {                      \
+        simsimd_norms_squared_##input_type(a, count, n, norms);                                                        \
+        for (simsimd_size_t i = 0; i != count; ++i)                                                                    \
+            norms[i] = SIMSIMD_SQRT(norms[i]);                                                                         \
+    }
+
+SIMSIMD_MAKE_NORMS(i8)   // simsimd_norms_i8, simsimd_norms_squared_i8
+SIMSIMD_MAKE_NORMS(f16)  // simsimd_norms_f16, simsimd_norms_squared_f16
+SIMSIMD_MAKE_NORMS(bf16) // simsimd_norms_bf16, simsimd_norms_squared_bf16
+SIMSIMD_MAKE_NORMS(f32)  // simsimd_norms_f32, simsimd_norms_squared_f32
+SIMSIMD_MAKE_NORMS(f64)  // simsimd_norms_f64, simsimd_norms_squared_f64
+
+/*  L2 normalization of many vectors at once, commonly applied to embeddings at ingestion
+ *  - Same type: `simsimd_normalize_*`, that can operate in-place, if `result == a`.
+ *  - Different type: `simsimd_normalize_*_to_*`, like `f32` embeddings into compact `f16` or `bf16` storage.
+ *
+ *  The `simsimd_normalize_f32` kernels fuse the squared norm and the scaling of every row, and are defined with
+ *  the other element-wise operations. The rest process every row in two dispatched passes: the `simsimd_dot_*`
+ *  kernel computes the squared norm, and the `simsimd_scale_*` kernel multiplies the row by the reciprocal square
+ *  root. For typical embedding sizes the row remains in the L1 cache between the passes.
+ *
+ *  @param a The first of `count` contiguous vectors.
+ *  @param count The number of vectors.
+ *  @param n The number of elements in each vector.
+ *  @param result The first of `count` contiguous output vectors. Rows with zero norm are exported as zeros.
+ */
+#define SIMSIMD_MAKE_NORMALIZE(name, input_type, output_type, scale)                                                   \
+    SIMSIMD_PUBLIC void simsimd_normalize_##name(simsimd_##input_type##_t const* a, simsimd_size_t count,              \
+                                                 simsimd_size_t n, simsimd_##output_type##_t* result) {                \
+        for (simsimd_size_t i = 0; i != count; ++i, a += n, result += n) {                                             \
+            simsimd_distance_t norm_squared;                                                                           \
+            simsimd_dot_##input_type(a, a, n, &norm_squared);                                                          \
+            scale(a, n, norm_squared > 0 ? 1 / SIMSIMD_SQRT(norm_squared) : 0, 0, result);                             \
+        }                                                                                                              \
+    }
+
+SIMSIMD_MAKE_NORMALIZE(f16, f16, f16, simsimd_scale_f16)                  // simsimd_normalize_f16
+SIMSIMD_MAKE_NORMALIZE(bf16, bf16, bf16, simsimd_scale_bf16)              // simsimd_normalize_bf16
+SIMSIMD_MAKE_NORMALIZE(f64, f64, f64, simsimd_scale_f64)                  // simsimd_normalize_f64
+SIMSIMD_MAKE_NORMALIZE(f32_to_f16, f32, f16, simsimd_scale_f32_to_f16)    // simsimd_normalize_f32_to_f16
+SIMSIMD_MAKE_NORMALIZE(f32_to_bf16, f32, bf16, simsimd_scale_f32_to_bf16) // simsimd_normalize_f32_to_bf16
+SIMSIMD_MAKE_NORMALIZE(f16_to_f32, f16, f32, simsimd_scale_f16_to_f32)    // simsimd_normalize_f16_to_f32
+SIMSIMD_MAKE_NORMALIZE(bf16_to_f32, bf16, f32, simsimd_scale_bf16_to_f32) // simsimd_normalize_bf16_to_f32
+
+/*  Spatial distances for vectors with precomputed L2 norms
+ *  - Cosine distance: `1 - ab / (|a| * |b|)`.
+ *  - L2 squared distance: `|a|^2 + |b|^2 - 2ab`, clamped to zero to absorb the cancellation error.
+ *
+ *  Only the dot-product is accumulated, skipping two of the three FMAs per element of `simsimd_cos_*`
+ *  and turning `simsimd_l2sq_*` into a pure dot-product. Both dispatch the `simsimd_dot_*` kernels,
+ *  in either static or dynamic mode, and accept the same L2 norms as produced by `simsimd_norms_*`.
+ *
+ *  - Single pair: `simsimd_{cos,l2sq}_prenormed_*`.
+ *  - One-to-many: `simsimd_{cos,l2sq}_prenormed_batch_*` compare `a` against `count` contiguous rows of `b`.
+ *  - Many-to-many: `simsimd_{cos,l2sq}_prenormed_cdist_*` fill a row-major `a_count` by `b_count` matrix.
+ *
+ *  @param a The first vector, or the first of `a_count` contiguous vectors.
+ *  @param b The second vector, or the first of `count` or `b_count` contiguous vectors.
+ *  @param n The number of elements in each vector.
+ *  @param a_norm The L2 norm of `a`. Pass 1 for unit vectors.
+ *  @param b_norm The L2 norm of `b`. Pass 1 for unit vectors.
+ *  @param a_norms, b_norms The L2 norms of each of the vectors in the multi-vector variants.
+ *  @param d The output distance value, or an array of them.
+ *
+ *  @note The output is identical to `simsimd_{cos,l2sq}_*` up to rounding, if the norms are exact.
+ */
+#define SIMSIMD_MAKE_PRENORMED(name, input_type, finalize)                                                             \
+    SIMSIMD_PUBLIC void simsimd_##name##_prenormed_##input_type(simsimd_##input_type##_t const* a,                     \
+                                                                simsimd_##input_type##_t const* b, simsimd_size_t n,   \
+                                                                simsimd_distance_t a_norm, simsimd_distance_t b_norm,  \
+                                                                simsimd_distance_t* d) {                               \
+        simsimd_distance_t ab;                                                                                         \
+        simsimd_dot_##input_type(a, b, n, &ab);                                                                        \
+        *d = finalize(ab, a_norm, b_norm);                                                                             \
+    }                                                                                                                  \
+    SIMSIMD_PUBLIC void simsimd_##name##_prenormed_batch_##input_type(                                                 \
+        simsimd_##input_type##_t const* a, simsimd_##input_type##_t const* b, simsimd_size_t count, simsimd_size_t n,  \
+        simsimd_distance_t a_norm, simsimd_distance_t const* b_norms, simsimd_distance_t* d) {                         \
+        for (simsimd_size_t i = 0; i != count; ++i, b += n)                                                            \
+            simsimd_##name##_prenormed_##input_type(a, b, n, a_norm, b_norms[i], d + i);                               \
+    }                                                                                                                  \
+    SIMSIMD_PUBLIC void simsimd_##name##_prenormed_cdist_##input_type(                                                 \
+        simsimd_##input_type##_t const* a, simsimd_size_t a_count, simsimd_distance_t const* a_norms,                  \
+        simsimd_##input_type##_t const* b, simsimd_size_t b_count, simsimd_distance_t const* b_norms,                  \
+        simsimd_size_t n, simsimd_distance_t* d) {                                                                     \
+        for (simsimd_size_t i = 0; i != a_count; ++i, a += n, d += b_count)                                            \
+            simsimd_##name##_prenormed_batch_##input_type(a, b, b_count, n, a_norms[i], b_norms, d);                   \
+    }
+
+SIMSIMD_INTERNAL simsimd_distance_t simsimd_cos_from_dot(simsimd_distance_t ab, simsimd_distance_t a_norm,
+                                                         simsimd_distance_t b_norm) {
+    return ab != 0 ? 1 - ab / (a_norm * b_norm) : 1;
+}
+
+SIMSIMD_INTERNAL simsimd_distance_t simsimd_l2sq_from_dot(simsimd_distance_t ab, simsimd_distance_t a_norm,
+                                                          simsimd_distance_t b_norm) {
+    simsimd_distance_t d2 = a_norm * a_norm + b_norm * b_norm - 2 * ab;
+    return d2 > 0 ? d2 : 0;
+}
+
+SIMSIMD_MAKE_PRENORMED(cos, i8, simsimd_cos_from_dot)   // simsimd_cos_prenormed{,_batch,_cdist}_i8
+SIMSIMD_MAKE_PRENORMED(cos, f16, simsimd_cos_from_dot)  // simsimd_cos_prenormed{,_batch,_cdist}_f16
+SIMSIMD_MAKE_PRENORMED(cos, bf16, simsimd_cos_from_dot) // simsimd_cos_prenormed{,_batch,_cdist}_bf16
+SIMSIMD_MAKE_PRENORMED(cos, f32, simsimd_cos_from_dot)  // simsimd_cos_prenormed{,_batch,_cdist}_f32
+SIMSIMD_MAKE_PRENORMED(cos, f64, simsimd_cos_from_dot)  // simsimd_cos_prenormed{,_batch,_cdist}_f64
+SIMSIMD_MAKE_PRENORMED(l2sq, i8, simsimd_l2sq_from_dot)   // simsimd_l2sq_prenormed{,_batch,_cdist}_i8
+SIMSIMD_MAKE_PRENORMED(l2sq, f16, simsimd_l2sq_from_dot)  // simsimd_l2sq_prenormed{,_batch,_cdist}_f16
+SIMSIMD_MAKE_PRENORMED(l2sq, bf16, simsimd_l2sq_from_dot) // simsimd_l2sq_prenormed{,_batch,_cdist}_bf16
+SIMSIMD_MAKE_PRENORMED(l2sq, f32, simsimd_l2sq_from_dot)  // simsimd_l2sq_prenormed{,_batch,_cdist}_f32
+SIMSIMD_MAKE_PRENORMED(l2sq, f64, simsimd_l2sq_from_dot)  // simsimd_l2sq_prenormed{,_batch,_cdist}_f64
+
+/*  Scalar quantization of `f32` vectors into `i8` codes, where every scalar is approximated with an affine
+ *  transform `x[i] ~ scale * code[i] + offset`, mapping the `[min, max]` range onto the `[-128, 127]` codes.
+ *
+ *  Per-dimension quantization learns the `scale` and `offset` of every dimension over a training set:
+ *  - `simsimd_quantize_minmax_f32` finds the range of every dimension.
+ *  - `simsimd_quantize_percentiles_f32` does the same, but clips the `clip` fraction of outliers on both
+ *    sides of every dimension, using a caller-provided `buffer` of `count` scalars.
+ *  - `simsimd_quantize_ranges_f32` turns the ranges into the decoding `scales` and `offsets` for the
+ *    `simsimd_affine_i8_to_f32` kernel, and their encoding counterparts for `simsimd_affine_f32_to_i8`.
+ *  - `simsimd_quantize_query_f32` folds the per-dimension `scales` and `offsets` into a symmetrically quantized
+ *    query, so that `simsimd_dot_i8_query` is a single `simsimd_dot_i8` call followed by a scalar correction.
+ *
+ *  Per-vector quantization picks the `scale` and `offset` for every vector separately, storing them with
+ *  the code sum and the norm in a `simsimd_i8_affine_t` header:
+ *  - `simsimd_quantize_vector_f32` and `simsimd_dequantize_vector_f32` encode and decode a single vector.
+ *  - `simsimd_{dot,l2sq,cos}_i8_affine` accumulate the dot-product of two encoded vectors in integers,
+ *    and apply the corrections from the headers afterwards.
+ */
+typedef struct simsimd_i8_affine_t {
+    simsimd_f32_t scale;        ///< Decoding multiplier, so that `x[i] ~ scale * code[i] + offset`
+    simsimd_f32_t offset;       ///< Decoding offset, shared by all dimensions
+    simsimd_f32_t sum;          ///< Sum of all the codes, to fold the offsets into the dot-products
+    simsimd_f32_t norm_squared; ///< Squared L2 norm of the decoded vector
+} simsimd_i8_affine_t;
+
+SIMSIMD_INTERNAL void simsimd_i8_affine_from_range(simsimd_f32_t min, simsimd_f32_t max, simsimd_f32_t* scale,
+                                                   simsimd_f32_t* offset) {
+    simsimd_f32_t range = max - min;
+    *scale = range > 0 ? range / 255 : 1;
+    *offset = min + 128 * *scale;
+}
+
+SIMSIMD_INTERNAL simsimd_f32_t simsimd_select_f32(simsimd_f32_t* x, simsimd_size_t count, simsimd_size_t k) {
+    // Hoare's selection, partially reordering the array, until the `k`-th smallest element is in place
+    simsimd_i64_t left = 0, right = (simsimd_i64_t)count - 1, target = (simsimd_i64_t)k;
+    while (left < right) {
+        simsimd_f32_t pivot = x[left + (right - left) / 2];
+        simsimd_i64_t i = left, j = right;
+        while (i <= j) {
+            while (x[i] < pivot)
+                ++i;
+            while (x[j] > pivot)
+                --j;
+            if (i <= j) {
+                simsimd_f32_t temporary = x[i];
+                x[i] = x[j], x[j] = temporary;
+                ++i, --j;
+            }
+        }
+        if (target <= j)
+            right = j;
+        else if (target >= i)
+            left = i;
+        else
+            break;
+    }
+    return x[k];
+}
+
+SIMSIMD_PUBLIC void simsimd_quantize_minmax_f32(simsimd_f32_t const* a, simsimd_size_t count, simsimd_size_t n,
+                                                simsimd_f32_t* mins, simsimd_f32_t* maxs) {
+    for (simsimd_size_t j = 0; j != n; ++j)
+        mins[j] = maxs[j] = count ? a[j] : 0;
+    for (simsimd_size_t i = 1; i < count; ++i) {
+        simsimd_f32_t const* row = a + i * n;
+        for (simsimd_size_t j = 0; j != n; ++j) {
+            mins[j] = row[j] < mins[j] ? row[j] : mins[j];
+            maxs[j] = row[j] > maxs[j] ? row[j] : maxs[j];
+        }
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_quantize_percentiles_f32(simsimd_f32_t const* a, simsimd_size_t count, simsimd_size_t n,
+                                                     simsimd_distance_t clip, simsimd_f32_t* buffer,
+                                                     simsimd_f32_t* mins, simsimd_f32_t* maxs) {
+    if (!count) {
+        simsimd_quantize_minmax_f32(a, count, n, mins, maxs);
+        return;
+    }
+    simsimd_size_t low = (simsimd_size_t)(clip * (count - 1)), high = count - 1 - low;
+    for (simsimd_size_t j = 0; j != n; ++j) {
+        for (simsimd_size_t i = 0; i != count; ++i)
+            buffer[i] = a[i * n + j];
+        mins[j] = simsimd_select_f32(buffer, count, low);
+        maxs[j] = simsimd_select_f32(buffer, count, high);
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_quantize_ranges_f32(simsimd_f32_t const* mins, simsimd_f32_t const* maxs, simsimd_size_t n,
+                                                simsimd_f32_t* scales, simsimd_f32_t* offsets,
+                                                simsimd_f32_t* encode_scales, simsimd_f32_t* encode_offsets) {
+    for (simsimd_size_t j = 0; j != n; ++j) {
+        simsimd_i8_affine_from_range(mins[j], maxs[j], scales + j, offsets + j);
+        encode_scales[j] = 1 / scales[j];
+        encode_offsets[j] = -offsets[j] / scales[j];
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_quantize_query_f32(simsimd_f32_t const* query, simsimd_size_t n,
+                                               simsimd_f32_t const* scales, simsimd_f32_t const* offsets,
+                                               simsimd_i8_t* codes, simsimd_distance_t* query_scale,
+                                               simsimd_distance_t* query_bias) {
+    // The inner product with `scales[i] * code[i] + offsets[i]` splits into the dot-product of the codes
+    // with `query[i] * scales[i]`, and the sum of `query[i] * offsets[i]`, independent from the codes.
+    simsimd_f32_t max_abs = 0;
+    simsimd_distance_t bias = 0;
+    for (simsimd_size_t i = 0; i != n; ++i) {
+        simsimd_f32_t weighted = query[i] * scales[i];
+        simsimd_f32_t weighted_abs = weighted < 0 ? -weighted : weighted;
+        max_abs = weighted_abs > max_abs ? weighted_abs : max_abs;
+        bias += (simsimd_distance_t)query[i] * offsets[i];
+    }
+    simsimd_f32_t scale = max_abs > 0 ? max_abs / 127 : 1, scale_inv = 1 / scale;
+    for (simsimd_size_t i = 0; i != n; ++i)
+        codes[i] = simsimd_saturate_i8(query[i] * scales[i] * scale_inv);
+    *query_scale = scale, *query_bias = bias;
+}
+
+SIMSIMD_PUBLIC void simsimd_dot_i8_query(simsimd_i8_t const* query_codes, simsimd_i8_t const* codes, simsimd_size_t n,
+                                         simsimd_distance_t query_scale, simsimd_distance_t query_bias,
+                                         simsimd_distance_t* d) {
+    simsimd_distance_t ab;
+    simsimd_dot_i8(query_codes, codes, n, &ab);
+    *d = query_scale * ab + query_bias;
+}
+
+SIMSIMD_PUBLIC void simsimd_quantize_vector_f32(simsimd_f32_t const* a, simsimd_size_t n, simsimd_i8_t* codes,
+                                                simsimd_i8_affine_t* header) {
+    simsimd_f32_t min = n ? a[0] : 0, max = min, scale, offset;
+    for (simsimd_size_t i = 1; i < n; ++i)
+        min = a[i] < min ? a[i] : min, max = a[i] > max ? a[i] : max;
+    simsimd_i8_affine_from_range(min, max, &scale, &offset);
+    simsimd_scale_f32_to_i8(a, n, 1.0 / scale, -(simsimd_distance_t)offset / scale, codes);
+
+    simsimd_i64_t sum = 0;
+    simsimd_distance_t sum_squares;
+    for (simsimd_size_t i = 0; i != n; ++i)
+        sum += codes[i];
+    simsimd_dot_i8(codes, codes, n, &sum_squares);
+    header->scale = scale, header->offset = offset, header->sum = (simsimd_f32_t)sum;
+    header->norm_squared =
+        (simsimd_f32_t)(scale * scale * sum_squares + 2.0 * scale * offset * sum + 1.0 * n * offset * offset);
+}
+
+SIMSIMD_PUBLIC void simsimd_dequantize_vector_f32(simsimd_i8_t const* codes, simsimd_size_t n,
+                                                  simsimd_i8_affine_t const* header, simsimd_f32_t* result) {
+    simsimd_scale_i8_to_f32(codes, n, header->scale, header->offset, result);
+}
+
+SIMSIMD_PUBLIC void simsimd_dot_i8_affine(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n,
+                                          simsimd_i8_affine_t const* a_header, simsimd_i8_affine_t const* b_header,
+                                          simsimd_distance_t* d) {
+    simsimd_distance_t ab;
+    simsimd_dot_i8(a, b, n, &ab);
+    simsimd_distance_t a_scale = a_header->scale, a_offset = a_header->offset;
+    simsimd_distance_t b_scale = b_header->scale, b_offset = b_header->offset;
+    *d = a_scale * b_scale * ab + a_scale * b_offset * a_header->sum + b_scale * a_offset * b_header->sum +
+         a_offset * b_offset * n;
+}
+
+SIMSIMD_PUBLIC void simsimd_l2sq_i8_affine(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n,
+                                           simsimd_i8_affine_t const* a_header, simsimd_i8_affine_t const* b_header,
+                                           simsimd_distance_t* d) {
+    simsimd_distance_t ab;
+    simsimd_dot_i8_affine(a, b, n, a_header, b_header, &ab);
+    simsimd_distance_t d2 = (simsimd_distance_t)a_header->norm_squared + b_header->norm_squared - 2 * ab;
+    *d = d2 > 0 ? d2 : 0;
+}
+
+SIMSIMD_PUBLIC void simsimd_cos_i8_affine(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n,
+                                          simsimd_i8_affine_t const* a_header, simsimd_i8_affine_t const* b_header,
+                                          simsimd_distance_t* d) {
+    simsimd_distance_t ab;
+    simsimd_dot_i8_affine(a, b, n, a_header, b_header, &ab);
+    *d = simsimd_cos_from_dot(ab, SIMSIMD_SQRT(a_header->norm_squared), SIMSIMD_SQRT(b_header->norm_squared));
+}
+
+/*  Scoring a query against a scattered list of rows of a matrix, like the candidates in graph and IVF searches
+ *  - `simsimd_gather_{cos,l2sq,dot}_*` compute `d[i] = metric(q, base + ids[i] * stride)` for every ID.
+ *  - `simsimd_gather_{hamming,jaccard}_b8` do the same for binary vectors.
+ *
+ *  Before scoring a candidate, the rows of the candidates `SIMSIMD_GATHER_PREFETCH_DISTANCE` positions ahead
+ *  are prefetched, hiding the latency of the random memory accesses behind the arithmetic. The default
+ *  distance of 4 rows suits typical embeddings, while shorter vectors may benefit from a larger value.
+ *
+ *  @param q The query vector.
+ *  @param base The address of the first row of the matrix.
+ *  @param stride The number of bytes between the starts of consecutive rows.
+ *  @param ids The array of `count` row indices.
+ *  @param count The number of rows to score.
+ *  @param n The number of elements in each vector.
+ *  @param d The output array of `count` distances.
+ */
+#ifndef SIMSIMD_GATHER_PREFETCH_DISTANCE
+#define SIMSIMD_GATHER_PREFETCH_DISTANCE 4
+#endif
+
+SIMSIMD_INTERNAL void simsimd_prefetch_row(void const* row, simsimd_size_t bytes) {
+    char const* row_bytes = (char const*)row;
+    for (simsimd_size_t offset = 0; offset < bytes; offset += 64)
+        SIMSIMD_PREFETCH(row_bytes + offset);
+    // Unaligned rows may spill into one more cache line
+    if (bytes)
+        SIMSIMD_PREFETCH(row_bytes + bytes - 1);
+}
+
+/**
+ *  @brief  Type-punned core of the `simsimd_gather_*` kernels, scoring the query against `count` rows of `bytes`
+ *          each with the given `kernel`. Also used by the graph indexes, that pick the kernel at run-time.
+ */
+SIMSIMD_INTERNAL void simsimd_gather_punned(simsimd_metric_punned_t kernel, void const* q, void const* base,
+                                            simsimd_size_t stride, simsimd_u32_t const* ids, simsimd_size_t count,
+                                            simsimd_size_t n, simsimd_size_t bytes, simsimd_distance_t* d) {
+    char const* rows = (char const*)base;
+    for (simsimd_size_t i = 0; i != count && i != SIMSIMD_GATHER_PREFETCH_DISTANCE; ++i)
+        simsimd_prefetch_row(rows + ids[i] * stride, bytes);
+    for (simsimd_size_t i = 0; i != count; ++i) {
+        if (i + SIMSIMD_GATHER_PREFETCH_DISTANCE < count)
+            simsimd_prefetch_row(rows + ids[i + SIMSIMD_GATHER_PREFETCH_DISTANCE] * stride, bytes);
+        kernel(q, rows + ids[i] * stride, n, d + i);
+    }
+}
+
+#define SIMSIMD_MAKE_GATHER(name, input_type)                                                                          \
+    SIMSIMD_PUBLIC void simsimd_gather_##name##_##input_type(                                                          \
+        simsimd_##input_type##_t const* q, void const* base, simsimd_size_t stride, simsimd_u32_t const* ids,          \
+        simsimd_size_t count, simsimd_size_t n, simsimd_distance_t* d) {                                               \
+        simsimd_gather_punned((simsimd_metric_punned_t)&simsimd_##name##_##input_type, q, base, stride, ids, count, n, \
+                              n * sizeof(simsimd_##input_type##_t), d);                                                \
+    }
+
+SIMSIMD_MAKE_GATHER(cos, i8)     // simsimd_gather_cos_i8
+SIMSIMD_MAKE_GATHER(cos, f16)    // simsimd_gather_cos_f16
+SIMSIMD_MAKE_GATHER(cos, bf16)   // simsimd_gather_cos_bf16
+SIMSIMD_MAKE_GATHER(cos, f32)    // simsimd_gather_cos_f32
+SIMSIMD_MAKE_GATHER(cos, f64)    // simsimd_gather_cos_f64
+SIMSIMD_MAKE_GATHER(l2sq, i8)    // simsimd_gather_l2sq_i8
+SIMSIMD_MAKE_GATHER(l2sq, f16)   // simsimd_gather_l2sq_f16
+SIMSIMD_MAKE_GATHER(l2sq, bf16)  // simsimd_gather_l2sq_bf16
+SIMSIMD_MAKE_GATHER(l2sq, f32)   // simsimd_gather_l2sq_f32
+SIMSIMD_MAKE_GATHER(l2sq, f64)   // simsimd_gather_l2sq_f64
+SIMSIMD_MAKE_GATHER(dot, i8)     // simsimd_gather_dot_i8
+SIMSIMD_MAKE_GATHER(dot, f16)    // simsimd_gather_dot_f16
+SIMSIMD_MAKE_GATHER(dot, bf16)   // simsimd_gather_dot_bf16
+SIMSIMD_MAKE_GATHER(dot, f32)    // simsimd_gather_dot_f32
+SIMSIMD_MAKE_GATHER(dot, f64)    // simsimd_gather_dot_f64
+SIMSIMD_MAKE_GATHER(hamming, b8) // simsimd_gather_hamming_b8
+SIMSIMD_MAKE_GATHER(jaccard, b8) // simsimd_gather_jaccard_b8
+
+/*  Bounded selection of the `k` smallest distances, shared by the search routines below
+ *  - `simsimd_topk_push` keeps up to `k` candidates in a max-heap, with the farthest one at the root.
+ *  - `simsimd_topk_sort` turns the heap of `size` candidates into arrays sorted by ascending distance.
+ *
+ *  @param distances The array of `k` distances, forming the heap.
+ *  @param ids The array of `k` identifiers, permuted together with the distances.
+ *  @param k The maximum number of candidates to keep.
+ *  @param size The number of candidates currently in the heap, updated on every push.
+ */
+SIMSIMD_INTERNAL void simsimd_topk_sift_down(simsimd_distance_t* distances, simsimd_size_t* ids, simsimd_size_t size,
+                                             simsimd_size_t i) {
+    simsimd_distance_t distance = distances[i];
+    simsimd_size_t id = ids[i];
+    for (simsimd_size_t child = 2 * i + 1; child < size; i = child, child = 2 * i + 1) {
+        if (child + 1 < size && distances[child + 1] > distances[child])
+            ++child;
+        if (distances[child] <= distance)
+            break;
+        distances[i] = distances[child], ids[i] = ids[child];
+    }
+    distances[i] = distance, ids[i] = id;
+}
+
+SIMSIMD_PUBLIC void simsimd_topk_push(simsimd_distance_t* distances, simsimd_size_t* ids, simsimd_size_t k,
+                                      simsimd_size_t* size, simsimd_distance_t distance, simsimd_size_t id) {
+    simsimd_size_t i = *size;
+    if (i < k) {
+        // Sift up the new candidate from the first free leaf
+        for (; i && distances[(i - 1) / 2] < distance; i = (i - 1) / 2)
+            distances[i] = distances[(i - 1) / 2], ids[i] = ids[(i - 1) / 2];
+        distances[i] = distance, ids[i] = id;
+        ++*size;
+    }
+    else if (k && distance < distances[0]) {
+        distances[0] = distance, ids[0] = id;
+        simsimd_topk_sift_down(distances, ids, k, 0);
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_topk_sort(simsimd_distance_t* distances, simsimd_size_t* ids, simsimd_size_t size) {
+    for (; size > 1; --size) {
+        simsimd_distance_t farthest_distance = distances[0];
+        simsimd_size_t farthest_id = ids[0];
+        distances[0] = distances[size - 1], ids[0] = ids[size - 1];
+        distances[size - 1] = farthest_distance, ids[size - 1] = farthest_id;
+        simsimd_topk_sift_down(distances, ids, size - 1, 0);
+    }
+}
+
+/*  Brute-force scans over `count` contiguous rows of `b`, skipping the rows disallowed by a bitmap filter
+ *  - `simsimd_{cos,l2sq,dot}_filtered_*` export the distances to the allowed rows and their indices,
+ *    returning the number of allowed rows.
+ *  - `simsimd_{cos,l2sq}_topk_*` export up to `k` nearest allowed rows, sorted by ascending distance,
+ *    returning the number of exported rows.
+ *  - `simsimd_{hamming,jaccard}_{filtered,topk}_b8` do the same for binary vectors.
+ *
+ *  The filter is tested 64 rows at a time, so runs of disallowed rows cost a single comparison,
+ *  and the distance kernels are only called for the set bits of every word.
+ *
+ *  @param q The query vector.
+ *  @param b The first of `count` contiguous vectors.
+ *  @param count The number of rows.
+ *  @param n The number of elements in each vector.
+ *  @param allowed The bitmap of `count` bits, where the row `i` is allowed if the bit `i % 8` of the byte `i / 8`
+ *                 is set. Pass NULL to allow all rows.
+ *  @param k The maximum number of rows to export from the top-k variants.
+ *  @param ids The output array of row indices.
+ *  @param d The output array of distances.
+ */
+SIMSIMD_INTERNAL simsimd_u64_t simsimd_bitmap_word(simsimd_b8_t const* bitmap, simsimd_size_t first,
+                                                   simsimd_size_t count) {
+    // Assembles the 64 bits starting at `first`, which must be a multiple of 64, masking the bits past `count`
+    simsimd_size_t bits = count - first < 64 ? count - first : 64;
+    simsimd_u64_t word = 0;
+    if (!bitmap)
+        word = ~word;
+    else if (bits == 64)
+        for (simsimd_size_t j = 0; j != 8; ++j)
+            word |= (simsimd_u64_t)bitmap[first / 8 + j] << (8 * j);
+    else
+        for (simsimd_size_t j = 0; j * 8 < bits; ++j)
+            word |= (simsimd_u64_t)bitmap[first / 8 + j] << (8 * j);
+    return bits == 64 ? word : word & ((1ull << bits) - 1);
+}
+
+#define SIMSIMD_MAKE_FILTERED(name, input_type)                                                                        \
+    SIMSIMD_PUBLIC simsimd_size_t simsimd_##name##_filtered_##input_type(                                              \
+        simsimd_##input_type##_t const* q, simsimd_##input_type##_t const* b, simsimd_size_t count, simsimd_size_t n,  \
+        simsimd_b8_t const* allowed, simsimd_size_t* ids, simsimd_distance_t* d) {                                     \
+        simsimd_size_t found = 0;                                                                                      \
+        for (simsimd_size_t first = 0; first < count; first += 64)                                                     \
+            for (simsimd_u64_t word = simsimd_bitmap_word(allowed, first, count); word; word &= word - 1) {            \
+                simsimd_size_t i = first + simsimd_ctz_u64(word);                                                      \
+                simsimd_##name##_##input_type(q, b + i * n, n, d + found);                                             \
+                ids[found++] = i;                                                                                      \
+            }                                                                                                          \
+        return found;                                                                                                  \
+    }
+
+#define SIMSIMD_MAKE_TOPK(name, input_type)                                                                            \
+    SIMSIMD_PUBLIC simsimd_size_t simsimd_##name##_topk_##input_type(                                                  \
+        simsimd_##input_type##_t const* q, simsimd_##input_type##_t const* b, simsimd_size_t count, simsimd_size_t n,  \
+        simsimd_b8_t const* allowed, simsimd_size_t k, simsimd_size_t* ids, simsimd_distance_t* d) {                   \
+        simsimd_size_t size = 0;                                                                                       \
+        for (simsimd_size_t first = 0; first < count; first += 64)                                                     \
+            for (simsimd_u64_t word = simsimd_bitmap_word(allowed, first, count); word; word &= word - 1) {            \
+                simsimd_size_t i = first + simsimd_ctz_u64(word);                                                      \
+                simsimd_distance_t distance;                                                                           \
+                simsimd_##name##_##input_type(q, b + i * n, n, &distance);                                             \
+                simsimd_topk_push(d, ids, k, &size, distance, i);                                                      \
+            }                                                                                                          \
+        simsimd_topk_sort(d, ids, size);                                                                               \
+        return size;                                                                                                   \
+    }
+
+SIMSIMD_MAKE_FILTERED(cos, i8)     // simsimd_cos_filtered_i8
+SIMSIMD_MAKE_FILTERED(cos, f16)    // simsimd_cos_filtered_f16
+SIMSIMD_MAKE_FILTERED(cos, bf16)   // simsimd_cos_filtered_bf16
+SIMSIMD_MAKE_FILTERED(cos, f32)    // simsimd_cos_filtered_f32
+SIMSIMD_MAKE_FILTERED(cos, f64)    // simsimd_cos_filtered_f64
+SIMSIMD_MAKE_FILTERED(l2sq, i8)    // simsimd_l2sq_filtered_i8
+SIMSIMD_MAKE_FILTERED(l2sq, f16)   // simsimd_l2sq_filtered_f16
+SIMSIMD_MAKE_FILTERED(l2sq, bf16)  // simsimd_l2sq_filtered_bf16
+SIMSIMD_MAKE_FILTERED(l2sq, f32)   // simsimd_l2sq_filtered_f32
+SIMSIMD_MAKE_FILTERED(l2sq, f64)   // simsimd_l2sq_filtered_f64
+SIMSIMD_MAKE_FILTERED(dot, i8)     // simsimd_dot_filtered_i8
+SIMSIMD_MAKE_FILTERED(dot, f16)    // simsimd_dot_filtered_f16
+SIMSIMD_MAKE_FILTERED(dot, bf16)   // simsimd_dot_filtered_bf16
+SIMSIMD_MAKE_FILTERED(dot, f32)    // simsimd_dot_filtered_f32
+SIMSIMD_MAKE_FILTERED(dot, f64)    // simsimd_dot_filtered_f64
+SIMSIMD_MAKE_FILTERED(hamming, b8) // simsimd_hamming_filtered_b8
+SIMSIMD_MAKE_FILTERED(jaccard, b8) // simsimd_jaccard_filtered_b8
+
+SIMSIMD_MAKE_TOPK(cos, i8)     // simsimd_cos_topk_i8
+SIMSIMD_MAKE_TOPK(cos, f16)    // simsimd_cos_topk_f16
+SIMSIMD_MAKE_TOPK(cos, bf16)   // simsimd_cos_topk_bf16
+SIMSIMD_MAKE_TOPK(cos, f32)    // simsimd_cos_topk_f32
+SIMSIMD_MAKE_TOPK(cos, f64)    // simsimd_cos_topk_f64
+SIMSIMD_MAKE_TOPK(l2sq, i8)    // simsimd_l2sq_topk_i8
+SIMSIMD_MAKE_TOPK(l2sq, f16)   // simsimd_l2sq_topk_f16
+SIMSIMD_MAKE_TOPK(l2sq, bf16)  // simsimd_l2sq_topk_bf16
+SIMSIMD_MAKE_TOPK(l2sq, f32)   // simsimd_l2sq_topk_f32
+SIMSIMD_MAKE_TOPK(l2sq, f64)   // simsimd_l2sq_topk_f64
+SIMSIMD_MAKE_TOPK(hamming, b8) // simsimd_hamming_topk_b8
+SIMSIMD_MAKE_TOPK(jaccard, b8) // simsimd_jaccard_topk_b8
+
+/*  Range searches over `count` contiguous rows of `b`, exporting all allowed rows within the `radius`
+ *  - `simsimd_{cos,l2sq}_range_*` for real and integral vectors.
+ *  - `simsimd_{hamming,jaccard}_range_b8` for binary vectors.
+ *
+ *  The scan starts at row `start` and writes the matches in ascending row order, until the `capacity` of
+ *  the output arrays is exhausted. It returns the row to resume from, which is `count` once every row was
+ *  scanned, or the first match that didn't fit. Passing it back as `start` continues the search, without
+ *  re-scoring the rows before it.
+ *
+ *  @param q The query vector.
+ *  @param b The first of `count` contiguous vectors.
+ *  @param count The number of rows.
+ *  @param n The number of elements in each vector.
+ *  @param allowed The bitmap of `count` allowed rows, or NULL to allow all rows.
+ *  @param radius The largest distance to be exported, inclusive.
+ *  @param start The first row to scan.
+ *  @param capacity The number of entries in the `ids` and `d` arrays.
+ *  @param ids The output array of row indices.
+ *  @param d The output array of distances.
+ *  @param found The output number of exported matches.
+ */
+#define SIMSIMD_MAKE_RANGE(name, input_type)                                                                           \
+    SIMSIMD_PUBLIC simsimd_size_t simsimd_##name##_range_##input_type(                                                 \
+        simsimd_##input_type##_t const* q, simsimd_##input_type##_t const* b, simsimd_size_t count, simsimd_size_t n,  \
+        simsimd_b8_t const* allowed, simsimd_distance_t radius, simsimd_size_t start, simsimd_size_t capacity,         \
+        simsimd_size_t* ids, simsimd_distance_t* d, simsimd_size_t* found) {                                           \
+        simsimd_size_t exported = 0;                                                                                   \
+        for (simsimd_size_t first = start - start % 64; first < count; first += 64) {                                  \
+            simsimd_u64_t word = simsimd_bitmap_word(allowed, first, count);                                           \
+            if (first < start)                                                                                         \
+                word &= ~(simsimd_u64_t)0 << (start - first);                                                          \
+            for (; word; word &= word - 1) {                                                                           \
+                simsimd_size_t i = first + simsimd_ctz_u64(word);                                                      \
+                simsimd_distance_t distance;                                                                           \
+                simsimd_##name##_##input_type(q, b + i * n, n, &distance);                                             \
+                if (distance > radius)                                                                                 \
+                    continue;                                                                                          \
+                if (exported == capacity) {                                                                            \
+                    *found = exported;                                                                                 \
+                    return i;                                                                                          \
+                }                                                                                                      \
+                ids[exported] = i, d[exported++] = distance;                                                           \
+            }                                                                                                          \
+        }                                                                                                              \
+        *found = exported;                                                                                             \
+        return count;                                                                                                  \
+    }
+
+SIMSIMD_MAKE_RANGE(cos, i8)     // simsimd_cos_range_i8
+SIMSIMD_MAKE_RANGE(cos, f16)    // simsimd_cos_range_f16
+SIMSIMD_MAKE_RANGE(cos, bf16)   // simsimd_cos_range_bf16
+SIMSIMD_MAKE_RANGE(cos, f32)    // simsimd_cos_range_f32
+SIMSIMD_MAKE_RANGE(cos, f64)    // simsimd_cos_range_f64
+SIMSIMD_MAKE_RANGE(l2sq, i8)    // simsimd_l2sq_range_i8
+SIMSIMD_MAKE_RANGE(l2sq, f16)   // simsimd_l2sq_range_f16
+SIMSIMD_MAKE_RANGE(l2sq, bf16)  // simsimd_l2sq_range_bf16
+SIMSIMD_MAKE_RANGE(l2sq, f32)   // simsimd_l2sq_range_f32
+SIMSIMD_MAKE_RANGE(l2sq, f64)   // simsimd_l2sq_range_f64
+SIMSIMD_MAKE_RANGE(hamming, b8) // simsimd_hamming_range_b8
+SIMSIMD_MAKE_RANGE(jaccard, b8) // simsimd_jaccard_range_b8
 
 #ifdef __cplusplus
 }
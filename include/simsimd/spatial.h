@@ -25,6 +25,8 @@
 #ifndef SIMSIMD_SPATIAL_H
 #define SIMSIMD_SPATIAL_H
 
+#include <float.h> // `FLT_MIN`
+
 #include "types.h"
 
 #ifdef __cplusplus
@@ -80,6 +82,10 @@ SIMSIMD_PUBLIC void simsimd_l2sq_f16_sve(simsimd_f16_t const* a, simsimd_f16_t c
 SIMSIMD_PUBLIC void simsimd_cos_f16_sve(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n, simsimd_distance_t*);
 SIMSIMD_PUBLIC void simsimd_l2sq_f64_sve(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n, simsimd_distance_t*);
 SIMSIMD_PUBLIC void simsimd_cos_f64_sve(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n, simsimd_distance_t*);
+SIMSIMD_PUBLIC void simsimd_l2sq_i8_sve(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_distance_t*);
+SIMSIMD_PUBLIC void simsimd_cos_i8_sve(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_distance_t*);
+SIMSIMD_PUBLIC void simsimd_l2sq_bf16_sve(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n, simsimd_distance_t*);
+SIMSIMD_PUBLIC void simsimd_cos_bf16_sve(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n, simsimd_distance_t*);
 
 /*  SIMD-powered backends for AVX2 CPUs of Haswell generation and newer, using 32-bit arithmetic over 256-bit words.
  *  First demonstrated in 2011, at least one Haswell-based processor was still being sold in 2022 — the Pentium G3420.
@@ -94,6 +100,12 @@ SIMSIMD_PUBLIC void simsimd_cos_f16_haswell(simsimd_f16_t const* a, simsimd_f16_
 SIMSIMD_PUBLIC void simsimd_l2sq_bf16_haswell(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n, simsimd_distance_t*);
 SIMSIMD_PUBLIC void simsimd_cos_bf16_haswell(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n, simsimd_distance_t*);
 
+/*  SIMD-powered backends for AVX-VNNI CPUs of Alder Lake generation and newer, using 32-bit integer arithmetic over 256-bit words.
+ *  Those cover the hybrid Intel client chips and E-core only Sierra Forest servers, that have no AVX512 support.
+ */
+SIMSIMD_PUBLIC void simsimd_l2sq_i8_alder(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_distance_t*);
+SIMSIMD_PUBLIC void simsimd_cos_i8_alder(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n, simsimd_distance_t*);
+
 /*  SIMD-powered backends for AVX512 CPUs of Skylake generation and newer, using 32-bit arithmetic over 512-bit words.
  *  Skylake was launched in 2015, and discontinued in 2019. Skylake had support for F, CD, VL, DQ, and BW extensions,
  *  as well as masked operations. This is enough to supersede auto-vectorization on `f32` and `f64` types.
@@ -114,6 +126,40 @@ SIMSIMD_PUBLIC void simsimd_cos_bf16_genoa(simsimd_bf16_t const* a, simsimd_bf16
 SIMSIMD_PUBLIC void simsimd_l2sq_f16_sapphire(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n, simsimd_distance_t*);
 SIMSIMD_PUBLIC void simsimd_cos_f16_sapphire(simsimd_f16_t const* a, simsimd_f16_t const* b, simsimd_size_t n, simsimd_distance_t*);
 
+/*  Fused nearest-centroid assignment, returning only the index of the closest of `k` centroids for each of the
+ *  `count` rows, and optionally the distance to it, without materializing the `count * k` distance matrix.
+ *  The `dot` variants select the centroid with the largest inner product, the others the smallest distance.
+ */
+SIMSIMD_PUBLIC void simsimd_assign_l2sq_f32_serial(simsimd_f32_t const* a, simsimd_size_t count, simsimd_f32_t const* centroids, simsimd_size_t k, simsimd_size_t n, simsimd_size_t* assignments, simsimd_distance_t* distances);
+SIMSIMD_PUBLIC void simsimd_assign_dot_f32_serial(simsimd_f32_t const* a, simsimd_size_t count, simsimd_f32_t const* centroids, simsimd_size_t k, simsimd_size_t n, simsimd_size_t* assignments, simsimd_distance_t* distances);
+SIMSIMD_PUBLIC void simsimd_assign_cos_f32_serial(simsimd_f32_t const* a, simsimd_size_t count, simsimd_f32_t const* centroids, simsimd_size_t k, simsimd_size_t n, simsimd_size_t* assignments, simsimd_distance_t* distances);
+SIMSIMD_PUBLIC void simsimd_assign_l2sq_f32_neon(simsimd_f32_t const* a, simsimd_size_t count, simsimd_f32_t const* centroids, simsimd_size_t k, simsimd_size_t n, simsimd_size_t* assignments, simsimd_distance_t* distances);
+SIMSIMD_PUBLIC void simsimd_assign_dot_f32_neon(simsimd_f32_t const* a, simsimd_size_t count, simsimd_f32_t const* centroids, simsimd_size_t k, simsimd_size_t n, simsimd_size_t* assignments, simsimd_distance_t* distances);
+SIMSIMD_PUBLIC void simsimd_assign_cos_f32_neon(simsimd_f32_t const* a, simsimd_size_t count, simsimd_f32_t const* centroids, simsimd_size_t k, simsimd_size_t n, simsimd_size_t* assignments, simsimd_distance_t* distances);
+SIMSIMD_PUBLIC void simsimd_assign_l2sq_f32_haswell(simsimd_f32_t const* a, simsimd_size_t count, simsimd_f32_t const* centroids, simsimd_size_t k, simsimd_size_t n, simsimd_size_t* assignments, simsimd_distance_t* distances);
+SIMSIMD_PUBLIC void simsimd_assign_dot_f32_haswell(simsimd_f32_t const* a, simsimd_size_t count, simsimd_f32_t const* centroids, simsimd_size_t k, simsimd_size_t n, simsimd_size_t* assignments, simsimd_distance_t* distances);
+SIMSIMD_PUBLIC void simsimd_assign_cos_f32_haswell(simsimd_f32_t const* a, simsimd_size_t count, simsimd_f32_t const* centroids, simsimd_size_t k, simsimd_size_t n, simsimd_size_t* assignments, simsimd_distance_t* distances);
+SIMSIMD_PUBLIC void simsimd_assign_l2sq_f32_skylake(simsimd_f32_t const* a, simsimd_size_t count, simsimd_f32_t const* centroids, simsimd_size_t k, simsimd_size_t n, simsimd_size_t* assignments, simsimd_distance_t* distances);
+SIMSIMD_PUBLIC void simsimd_assign_dot_f32_skylake(simsimd_f32_t const* a, simsimd_size_t count, simsimd_f32_t const* centroids, simsimd_size_t k, simsimd_size_t n, simsimd_size_t* assignments, simsimd_distance_t* distances);
+SIMSIMD_PUBLIC void simsimd_assign_cos_f32_skylake(simsimd_f32_t const* a, simsimd_size_t count, simsimd_f32_t const* centroids, simsimd_size_t k, simsimd_size_t n, simsimd_size_t* assignments, simsimd_distance_t* distances);
+
+/*  Distances between `a_count` contiguous query rows and `count` rows packed by `simsimd_pack_f32` into panels of
+ *  `SIMSIMD_PANEL_ROWS` interleaved rows, exported as a row-major `a_count * count` matrix. Every vector operation
+ *  updates the distances to all rows of a panel at once, so no horizontal reductions are needed.
+ */
+SIMSIMD_PUBLIC void simsimd_packed_l2sq_f32_serial(simsimd_f32_t const* a, simsimd_size_t a_count, simsimd_f32_t const* packed, simsimd_size_t count, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_packed_dot_f32_serial(simsimd_f32_t const* a, simsimd_size_t a_count, simsimd_f32_t const* packed, simsimd_size_t count, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_packed_cos_f32_serial(simsimd_f32_t const* a, simsimd_size_t a_count, simsimd_f32_t const* packed, simsimd_size_t count, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_packed_l2sq_f32_neon(simsimd_f32_t const* a, simsimd_size_t a_count, simsimd_f32_t const* packed, simsimd_size_t count, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_packed_dot_f32_neon(simsimd_f32_t const* a, simsimd_size_t a_count, simsimd_f32_t const* packed, simsimd_size_t count, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_packed_cos_f32_neon(simsimd_f32_t const* a, simsimd_size_t a_count, simsimd_f32_t const* packed, simsimd_size_t count, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_packed_l2sq_f32_haswell(simsimd_f32_t const* a, simsimd_size_t a_count, simsimd_f32_t const* packed, simsimd_size_t count, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_packed_dot_f32_haswell(simsimd_f32_t const* a, simsimd_size_t a_count, simsimd_f32_t const* packed, simsimd_size_t count, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_packed_cos_f32_haswell(simsimd_f32_t const* a, simsimd_size_t a_count, simsimd_f32_t const* packed, simsimd_size_t count, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_packed_l2sq_f32_skylake(simsimd_f32_t const* a, simsimd_size_t a_count, simsimd_f32_t const* packed, simsimd_size_t count, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_packed_dot_f32_skylake(simsimd_f32_t const* a, simsimd_size_t a_count, simsimd_f32_t const* packed, simsimd_size_t count, simsimd_size_t n, simsimd_distance_t* results);
+SIMSIMD_PUBLIC void simsimd_packed_cos_f32_skylake(simsimd_f32_t const* a, simsimd_size_t a_count, simsimd_f32_t const* packed, simsimd_size_t count, simsimd_size_t n, simsimd_distance_t* results);
+
 // clang-format on
 
 #define SIMSIMD_MAKE_L2SQ(name, input_type, accumulator_type, converter)                                               \
@@ -171,12 +217,240 @@ SIMSIMD_MAKE_COS(accurate, bf16, f64, SIMSIMD_UNCOMPRESS_BF16)  // simsimd_cos_b
 SIMSIMD_MAKE_L2SQ(accurate, i8, i32, SIMSIMD_IDENTIFY) // simsimd_l2sq_i8_accurate
 SIMSIMD_MAKE_COS(accurate, i8, i32, SIMSIMD_IDENTIFY)  // simsimd_cos_i8_accurate
 
+/*  Number of rows compared against every group of 4 centroids in `simsimd_assign_*` kernels.
+ *  The centroids group stays in L1 while the rows tile is processed, and the running minimums stay in registers.
+ */
+#ifndef SIMSIMD_ASSIGN_ROWS
+#define SIMSIMD_ASSIGN_ROWS 8
+#endif
+
+/*  Wraps a micro-kernel, computing the distances from one row to 4 centroids at once, into an assignment kernel.
+ *  The `sign` is -1 for similarities, like the inner product, and +1 for distances. On ties the lower index wins.
+ *  The tail of the centroids is padded by repeating the first centroid of the group, which is then ignored.
+ */
+#define SIMSIMD_MAKE_ASSIGN(metric, name, sign)                                                                        \
+    SIMSIMD_PUBLIC void simsimd_assign_##metric##_f32_##name(                                                          \
+        simsimd_f32_t const* a, simsimd_size_t count, simsimd_f32_t const* centroids, simsimd_size_t k,                \
+        simsimd_size_t n, simsimd_size_t* assignments, simsimd_distance_t* distances) {                                \
+        simsimd_distance_t best[SIMSIMD_ASSIGN_ROWS], results[4];                                                      \
+        for (simsimd_size_t first = 0; first < count; first += SIMSIMD_ASSIGN_ROWS) {                                  \
+            simsimd_size_t rows = count - first < SIMSIMD_ASSIGN_ROWS ? count - first : SIMSIMD_ASSIGN_ROWS;           \
+            simsimd_size_t* rows_assignments = assignments + first;                                                    \
+            for (simsimd_size_t r = 0; r != rows; ++r)                                                                 \
+                rows_assignments[r] = k, best[r] = 0;                                                                  \
+            for (simsimd_size_t j = 0; j < k; j += 4) {                                                                \
+                simsimd_f32_t const* c0 = centroids + j * n;                                                           \
+                simsimd_f32_t const* c1 = j + 1 < k ? c0 + n : c0;                                                     \
+                simsimd_f32_t const* c2 = j + 2 < k ? c0 + 2 * n : c0;                                                 \
+                simsimd_f32_t const* c3 = j + 3 < k ? c0 + 3 * n : c0;                                                 \
+                simsimd_size_t group = k - j < 4 ? k - j : 4;                                                          \
+                for (simsimd_size_t r = 0; r != rows; ++r) {                                                           \
+                    simsimd_##metric##_f32x4_##name(a + (first + r) * n, c0, c1, c2, c3, n, results);                  \
+                    for (simsimd_size_t i = 0; i != group; ++i)                                                        \
+                        if (rows_assignments[r] == k || (sign) * results[i] < (sign) * best[r])                        \
+                            rows_assignments[r] = j + i, best[r] = results[i];                                         \
+                }                                                                                                      \
+            }                                                                                                          \
+            if (distances)                                                                                             \
+                for (simsimd_size_t r = 0; r != rows; ++r)                                                             \
+                    distances[first + r] = best[r];                                                                    \
+        }                                                                                                              \
+    }
+
+SIMSIMD_PUBLIC void simsimd_l2sq_f32x4_serial(simsimd_f32_t const* a, simsimd_f32_t const* c0, simsimd_f32_t const* c1,
+                                              simsimd_f32_t const* c2, simsimd_f32_t const* c3, simsimd_size_t n,
+                                              simsimd_distance_t* results) {
+    simsimd_f32_t d0 = 0, d1 = 0, d2 = 0, d3 = 0;
+    for (simsimd_size_t i = 0; i != n; ++i) {
+        simsimd_f32_t ai = a[i];
+        d0 += (ai - c0[i]) * (ai - c0[i]), d1 += (ai - c1[i]) * (ai - c1[i]);
+        d2 += (ai - c2[i]) * (ai - c2[i]), d3 += (ai - c3[i]) * (ai - c3[i]);
+    }
+    results[0] = d0, results[1] = d1, results[2] = d2, results[3] = d3;
+}
+
+SIMSIMD_PUBLIC void simsimd_dot_f32x4_serial(simsimd_f32_t const* a, simsimd_f32_t const* c0, simsimd_f32_t const* c1,
+                                             simsimd_f32_t const* c2, simsimd_f32_t const* c3, simsimd_size_t n,
+                                             simsimd_distance_t* results) {
+    simsimd_f32_t ab0 = 0, ab1 = 0, ab2 = 0, ab3 = 0;
+    for (simsimd_size_t i = 0; i != n; ++i) {
+        simsimd_f32_t ai = a[i];
+        ab0 += ai * c0[i], ab1 += ai * c1[i], ab2 += ai * c2[i], ab3 += ai * c3[i];
+    }
+    results[0] = ab0, results[1] = ab1, results[2] = ab2, results[3] = ab3;
+}
+
+SIMSIMD_PUBLIC void simsimd_cos_f32x4_serial(simsimd_f32_t const* a, simsimd_f32_t const* c0, simsimd_f32_t const* c1,
+                                             simsimd_f32_t const* c2, simsimd_f32_t const* c3, simsimd_size_t n,
+                                             simsimd_distance_t* results) {
+    simsimd_f32_t a2 = 0, ab[4] = {0, 0, 0, 0}, b2[4] = {0, 0, 0, 0};
+    for (simsimd_size_t i = 0; i != n; ++i) {
+        simsimd_f32_t ai = a[i], b0 = c0[i], b1 = c1[i], b2i = c2[i], b3 = c3[i];
+        a2 += ai * ai;
+        ab[0] += ai * b0, ab[1] += ai * b1, ab[2] += ai * b2i, ab[3] += ai * b3;
+        b2[0] += b0 * b0, b2[1] += b1 * b1, b2[2] += b2i * b2i, b2[3] += b3 * b3;
+    }
+    for (int i = 0; i != 4; ++i)
+        results[i] = ab[i] != 0 ? (1 - ab[i] * SIMSIMD_RSQRT(a2) * SIMSIMD_RSQRT(b2[i])) : 1;
+}
+
+SIMSIMD_MAKE_ASSIGN(l2sq, serial, 1) // simsimd_assign_l2sq_f32_serial
+SIMSIMD_MAKE_ASSIGN(dot, serial, -1) // simsimd_assign_dot_f32_serial
+SIMSIMD_MAKE_ASSIGN(cos, serial, 1)  // simsimd_assign_cos_f32_serial
+
+/*  Number of rows interleaved in every panel of `simsimd_pack_f32`, matching a single AVX-512 register,
+ *  two AVX2 registers, or four NEON registers of single-precision lanes. Unlike the tiling constants,
+ *  it defines the memory layout, so it can't be overridden.
+ */
+#define SIMSIMD_PANEL_ROWS 16
+
+/**
+ *  @brief  Returns the size of the buffer `simsimd_pack_f32` needs to pack `count` rows of `n` dimensions.
+ */
+SIMSIMD_PUBLIC simsimd_size_t simsimd_pack_bytes_f32(simsimd_size_t count, simsimd_size_t n) {
+    simsimd_size_t panels = (count + SIMSIMD_PANEL_ROWS - 1) / SIMSIMD_PANEL_ROWS;
+    return panels * SIMSIMD_PANEL_ROWS * n * sizeof(simsimd_f32_t);
+}
+
+/**
+ *  @brief  Rearranges `count` contiguous rows of `b` into panels of `SIMSIMD_PANEL_ROWS` rows, storing the same
+ *          dimension of all rows of a panel next to each other. The last panel is padded with zero rows.
+ */
+SIMSIMD_PUBLIC void simsimd_pack_f32(simsimd_f32_t const* b, simsimd_size_t count, simsimd_size_t n,
+                                     simsimd_f32_t* packed) {
+    for (simsimd_size_t first = 0; first < count; first += SIMSIMD_PANEL_ROWS) {
+        simsimd_size_t rows = count - first < SIMSIMD_PANEL_ROWS ? count - first : SIMSIMD_PANEL_ROWS;
+        simsimd_f32_t* panel = packed + first * n;
+        for (simsimd_size_t i = 0; i != n; ++i, panel += SIMSIMD_PANEL_ROWS) {
+            simsimd_size_t r = 0;
+            for (; r != rows; ++r)
+                panel[r] = b[(first + r) * n + i];
+            for (; r != SIMSIMD_PANEL_ROWS; ++r)
+                panel[r] = 0;
+        }
+    }
+}
+
+/*  Wraps a micro-kernel, computing the distances from 4 queries to all rows of a panel, into a packed kernel.
+ *  The micro-kernel exports `4 * SIMSIMD_PANEL_ROWS` single-precision lanes, of which only the ones of the present
+ *  queries and rows are kept. The tail of the queries is padded by repeating the first query of the group.
+ */
+#define SIMSIMD_MAKE_PACKED(metric, name)                                                                              \
+    SIMSIMD_PUBLIC void simsimd_packed_##metric##_f32_##name(simsimd_f32_t const* a, simsimd_size_t a_count,           \
+                                                             simsimd_f32_t const* packed, simsimd_size_t count,        \
+                                                             simsimd_size_t n, simsimd_distance_t* results) {          \
+        simsimd_f32_t lanes[4 * SIMSIMD_PANEL_ROWS];                                                                   \
+        for (simsimd_size_t q = 0; q < a_count; q += 4) {                                                              \
+            simsimd_f32_t const* a0 = a + q * n;                                                                       \
+            simsimd_f32_t const* a1 = q + 1 < a_count ? a0 + n : a0;                                                   \
+            simsimd_f32_t const* a2 = q + 2 < a_count ? a0 + 2 * n : a0;                                               \
+            simsimd_f32_t const* a3 = q + 3 < a_count ? a0 + 3 * n : a0;                                               \
+            simsimd_size_t group = a_count - q < 4 ? a_count - q : 4;                                                  \
+            for (simsimd_size_t first = 0; first < count; first += SIMSIMD_PANEL_ROWS) {                               \
+                simsimd_size_t rows = count - first < SIMSIMD_PANEL_ROWS ? count - first : SIMSIMD_PANEL_ROWS;         \
+                simsimd_##metric##_f32_panel_##name(a0, a1, a2, a3, packed + first * n, n, lanes);                     \
+                for (simsimd_size_t j = 0; j != group; ++j)                                                            \
+                    for (simsimd_size_t r = 0; r != rows; ++r)                                                         \
+                        results[(q + j) * count + first + r] = lanes[j * SIMSIMD_PANEL_ROWS + r];                      \
+            }                                                                                                          \
+        }                                                                                                              \
+    }
+
+SIMSIMD_PUBLIC void simsimd_l2sq_f32_panel_serial(simsimd_f32_t const* a0, simsimd_f32_t const* a1,
+                                                  simsimd_f32_t const* a2, simsimd_f32_t const* a3,
+                                                  simsimd_f32_t const* panel, simsimd_size_t n, simsimd_f32_t* lanes) {
+    simsimd_f32_t const* as[4] = {a0, a1, a2, a3};
+    for (int r = 0; r != 4 * SIMSIMD_PANEL_ROWS; ++r)
+        lanes[r] = 0;
+    for (simsimd_size_t i = 0; i != n; ++i, panel += SIMSIMD_PANEL_ROWS)
+        for (int j = 0; j != 4; ++j)
+            for (int r = 0; r != SIMSIMD_PANEL_ROWS; ++r) {
+                simsimd_f32_t e = as[j][i] - panel[r];
+                lanes[j * SIMSIMD_PANEL_ROWS + r] += e * e;
+            }
+}
+
+SIMSIMD_PUBLIC void simsimd_dot_f32_panel_serial(simsimd_f32_t const* a0, simsimd_f32_t const* a1,
+                                                 simsimd_f32_t const* a2, simsimd_f32_t const* a3,
+                                                 simsimd_f32_t const* panel, simsimd_size_t n, simsimd_f32_t* lanes) {
+    simsimd_f32_t const* as[4] = {a0, a1, a2, a3};
+    for (int r = 0; r != 4 * SIMSIMD_PANEL_ROWS; ++r)
+        lanes[r] = 0;
+    for (simsimd_size_t i = 0; i != n; ++i, panel += SIMSIMD_PANEL_ROWS)
+        for (int j = 0; j != 4; ++j)
+            for (int r = 0; r != SIMSIMD_PANEL_ROWS; ++r)
+                lanes[j * SIMSIMD_PANEL_ROWS + r] += as[j][i] * panel[r];
+}
+
+SIMSIMD_PUBLIC void simsimd_cos_f32_panel_serial(simsimd_f32_t const* a0, simsimd_f32_t const* a1,
+                                                 simsimd_f32_t const* a2, simsimd_f32_t const* a3,
+                                                 simsimd_f32_t const* panel, simsimd_size_t n, simsimd_f32_t* lanes) {
+    simsimd_f32_t const* as[4] = {a0, a1, a2, a3};
+    simsimd_f32_t a2s[4] = {0, 0, 0, 0}, b2s[SIMSIMD_PANEL_ROWS];
+    for (int r = 0; r != SIMSIMD_PANEL_ROWS; ++r)
+        b2s[r] = 0;
+    for (int r = 0; r != 4 * SIMSIMD_PANEL_ROWS; ++r)
+        lanes[r] = 0;
+    for (simsimd_size_t i = 0; i != n; ++i, panel += SIMSIMD_PANEL_ROWS) {
+        for (int r = 0; r != SIMSIMD_PANEL_ROWS; ++r)
+            b2s[r] += panel[r] * panel[r];
+        for (int j = 0; j != 4; ++j) {
+            a2s[j] += as[j][i] * as[j][i];
+            for (int r = 0; r != SIMSIMD_PANEL_ROWS; ++r)
+                lanes[j * SIMSIMD_PANEL_ROWS + r] += as[j][i] * panel[r];
+        }
+    }
+    for (int j = 0; j != 4; ++j)
+        for (int r = 0; r != SIMSIMD_PANEL_ROWS; ++r) {
+            simsimd_f32_t ab = lanes[j * SIMSIMD_PANEL_ROWS + r];
+            lanes[j * SIMSIMD_PANEL_ROWS + r] = ab != 0 ? (1 - ab * SIMSIMD_RSQRT(a2s[j]) * SIMSIMD_RSQRT(b2s[r])) : 1;
+        }
+}
+
+SIMSIMD_MAKE_PACKED(l2sq, serial) // simsimd_packed_l2sq_f32_serial
+SIMSIMD_MAKE_PACKED(dot, serial)  // simsimd_packed_dot_f32_serial
+SIMSIMD_MAKE_PACKED(cos, serial)  // simsimd_packed_cos_f32_serial
+
 #if SIMSIMD_TARGET_ARM
 #if SIMSIMD_TARGET_NEON
 #pragma GCC push_options
 #pragma GCC target("+simd")
 #pragma clang attribute push(__attribute__((target("+simd"))), apply_to = function)
 
+/*  Turns the accumulated dot-product and squared norms into the cosine distance.
+ *  The `vrsqrte` estimate is only accurate to 8 bits, so it's refined with two Newton-Raphson steps,
+ *  bringing it to full single precision at the cost of a few scalar operations per call.
+ */
+SIMSIMD_INTERNAL simsimd_distance_t simsimd_cos_normalize_f32_neon(simsimd_f32_t ab, simsimd_f32_t a2,
+                                                                   simsimd_f32_t b2) {
+    if (ab == 0)
+        return 1;
+    // The estimate of a subnormal is infinite, and the Newton-Raphson step would turn it into NaN,
+    // so those rare inputs take the exact square roots, dividing in double precision to avoid underflows
+    if (a2 < FLT_MIN || b2 < FLT_MIN)
+        return 1 - ab / (SIMSIMD_SQRT((simsimd_f64_t)a2) * SIMSIMD_SQRT((simsimd_f64_t)b2));
+    simsimd_f32_t a2_b2_arr[2] = {a2, b2};
+    float32x2_t a2_b2 = vld1_f32(a2_b2_arr);
+    float32x2_t rsqrts = vrsqrte_f32(a2_b2);
+    // The `vrsqrts_f32(x * y, y)` computes the `(3 - x * y * y) / 2` correction factor
+    rsqrts = vmul_f32(rsqrts, vrsqrts_f32(vmul_f32(a2_b2, rsqrts), rsqrts));
+    rsqrts = vmul_f32(rsqrts, vrsqrts_f32(vmul_f32(a2_b2, rsqrts), rsqrts));
+    vst1_f32(a2_b2_arr, rsqrts);
+    return 1 - ab * a2_b2_arr[0] * a2_b2_arr[1];
+}
+
+/*  Double-precision variant of `simsimd_cos_normalize_f32_neon`, using the exact `vsqrtq_f64`,
+ *  as refining an 8-bit estimate to 53 bits would take more steps than the square root itself.
+ */
+SIMSIMD_INTERNAL simsimd_distance_t simsimd_cos_normalize_f64_neon(simsimd_f64_t ab, simsimd_f64_t a2,
+                                                                   simsimd_f64_t b2) {
+    if (ab == 0)
+        return 1;
+    simsimd_f64_t a2_b2_arr[2] = {a2, b2};
+    vst1q_f64(a2_b2_arr, vsqrtq_f64(vld1q_f64(a2_b2_arr)));
+    return 1 - ab / (a2_b2_arr[0] * a2_b2_arr[1]);
+}
+
 SIMSIMD_PUBLIC void simsimd_l2sq_f32_neon(simsimd_f32_t const* a, simsimd_f32_t const* b, simsimd_size_t n,
                                           simsimd_distance_t* result) {
     float32x4_t sum_vec = vdupq_n_f32(0);
@@ -212,15 +486,182 @@ SIMSIMD_PUBLIC void simsimd_cos_f32_neon(simsimd_f32_t const* a, simsimd_f32_t c
         ab += ai * bi, a2 += ai * ai, b2 += bi * bi;
     }
 
-    // Avoid `simsimd_approximate_inverse_square_root` on Arm NEON
-    simsimd_f32_t a2_b2_arr[2] = {a2, b2};
-    vst1_f32(a2_b2_arr, vrsqrte_f32(vld1_f32(a2_b2_arr)));
-    *result = ab != 0 ? 1 - ab * a2_b2_arr[0] * a2_b2_arr[1] : 1;
+    *result = simsimd_cos_normalize_f32_neon(ab, a2, b2);
 }
 
+SIMSIMD_PUBLIC void simsimd_l2sq_f32x4_neon(simsimd_f32_t const* a, simsimd_f32_t const* c0, simsimd_f32_t const* c1,
+                                            simsimd_f32_t const* c2, simsimd_f32_t const* c3, simsimd_size_t n,
+                                            simsimd_distance_t* results) {
+    float32x4_t d0_vec = vdupq_n_f32(0), d1_vec = vdupq_n_f32(0), d2_vec = vdupq_n_f32(0), d3_vec = vdupq_n_f32(0);
+    simsimd_size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        float32x4_t a_vec = vld1q_f32(a + i);
+        float32x4_t e0_vec = vsubq_f32(a_vec, vld1q_f32(c0 + i)), e1_vec = vsubq_f32(a_vec, vld1q_f32(c1 + i));
+        float32x4_t e2_vec = vsubq_f32(a_vec, vld1q_f32(c2 + i)), e3_vec = vsubq_f32(a_vec, vld1q_f32(c3 + i));
+        d0_vec = vfmaq_f32(d0_vec, e0_vec, e0_vec), d1_vec = vfmaq_f32(d1_vec, e1_vec, e1_vec);
+        d2_vec = vfmaq_f32(d2_vec, e2_vec, e2_vec), d3_vec = vfmaq_f32(d3_vec, e3_vec, e3_vec);
+    }
+    simsimd_f32_t d0 = vaddvq_f32(d0_vec), d1 = vaddvq_f32(d1_vec), d2 = vaddvq_f32(d2_vec), d3 = vaddvq_f32(d3_vec);
+    for (; i < n; ++i) {
+        simsimd_f32_t ai = a[i];
+        d0 += (ai - c0[i]) * (ai - c0[i]), d1 += (ai - c1[i]) * (ai - c1[i]);
+        d2 += (ai - c2[i]) * (ai - c2[i]), d3 += (ai - c3[i]) * (ai - c3[i]);
+    }
+    results[0] = d0, results[1] = d1, results[2] = d2, results[3] = d3;
+}
+
+SIMSIMD_PUBLIC void simsimd_dot_f32x4_neon(simsimd_f32_t const* a, simsimd_f32_t const* c0, simsimd_f32_t const* c1,
+                                           simsimd_f32_t const* c2, simsimd_f32_t const* c3, simsimd_size_t n,
+                                           simsimd_distance_t* results) {
+    float32x4_t ab0_vec = vdupq_n_f32(0), ab1_vec = vdupq_n_f32(0), ab2_vec = vdupq_n_f32(0), ab3_vec = vdupq_n_f32(0);
+    simsimd_size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        float32x4_t a_vec = vld1q_f32(a + i);
+        ab0_vec = vfmaq_f32(ab0_vec, a_vec, vld1q_f32(c0 + i)), ab1_vec = vfmaq_f32(ab1_vec, a_vec, vld1q_f32(c1 + i));
+        ab2_vec = vfmaq_f32(ab2_vec, a_vec, vld1q_f32(c2 + i)), ab3_vec = vfmaq_f32(ab3_vec, a_vec, vld1q_f32(c3 + i));
+    }
+    simsimd_f32_t ab0 = vaddvq_f32(ab0_vec), ab1 = vaddvq_f32(ab1_vec);
+    simsimd_f32_t ab2 = vaddvq_f32(ab2_vec), ab3 = vaddvq_f32(ab3_vec);
+    for (; i < n; ++i) {
+        simsimd_f32_t ai = a[i];
+        ab0 += ai * c0[i], ab1 += ai * c1[i], ab2 += ai * c2[i], ab3 += ai * c3[i];
+    }
+    results[0] = ab0, results[1] = ab1, results[2] = ab2, results[3] = ab3;
+}
+
+SIMSIMD_PUBLIC void simsimd_cos_f32x4_neon(simsimd_f32_t const* a, simsimd_f32_t const* c0, simsimd_f32_t const* c1,
+                                           simsimd_f32_t const* c2, simsimd_f32_t const* c3, simsimd_size_t n,
+                                           simsimd_distance_t* results) {
+    simsimd_f32_t const* cs[4] = {c0, c1, c2, c3};
+    float32x4_t a2_vec = vdupq_n_f32(0), ab_vecs[4], b2_vecs[4];
+    for (int j = 0; j != 4; ++j)
+        ab_vecs[j] = vdupq_n_f32(0), b2_vecs[j] = vdupq_n_f32(0);
+    simsimd_size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        float32x4_t a_vec = vld1q_f32(a + i);
+        a2_vec = vfmaq_f32(a2_vec, a_vec, a_vec);
+        for (int j = 0; j != 4; ++j) {
+            float32x4_t b_vec = vld1q_f32(cs[j] + i);
+            ab_vecs[j] = vfmaq_f32(ab_vecs[j], a_vec, b_vec);
+            b2_vecs[j] = vfmaq_f32(b2_vecs[j], b_vec, b_vec);
+        }
+    }
+    simsimd_f32_t a2 = vaddvq_f32(a2_vec), ab[4], b2[4];
+    for (int j = 0; j != 4; ++j)
+        ab[j] = vaddvq_f32(ab_vecs[j]), b2[j] = vaddvq_f32(b2_vecs[j]);
+    for (; i < n; ++i) {
+        simsimd_f32_t ai = a[i];
+        a2 += ai * ai;
+        for (int j = 0; j != 4; ++j)
+            ab[j] += ai * cs[j][i], b2[j] += cs[j][i] * cs[j][i];
+    }
+    for (int j = 0; j != 4; ++j)
+        results[j] = simsimd_cos_normalize_f32_neon(ab[j], a2, b2[j]);
+}
+
+SIMSIMD_MAKE_ASSIGN(l2sq, neon, 1) // simsimd_assign_l2sq_f32_neon
+SIMSIMD_MAKE_ASSIGN(dot, neon, -1) // simsimd_assign_dot_f32_neon
+SIMSIMD_MAKE_ASSIGN(cos, neon, 1)  // simsimd_assign_cos_f32_neon
+
+/*  Refines the 8-bit `vrsqrteq` estimate with two Newton-Raphson steps, like `simsimd_cos_normalize_f32_neon`,
+ *  replacing the lanes with subnormal inputs, where the estimate is infinite, with the exact reciprocal square roots.
+ */
+SIMSIMD_INTERNAL float32x4_t simsimd_rsqrt_f32x4_neon(float32x4_t x) {
+    float32x4_t rsqrts = vrsqrteq_f32(x);
+    rsqrts = vmulq_f32(rsqrts, vrsqrtsq_f32(vmulq_f32(x, rsqrts), rsqrts));
+    rsqrts = vmulq_f32(rsqrts, vrsqrtsq_f32(vmulq_f32(x, rsqrts), rsqrts));
+    uint32x4_t subnormal = vcltq_f32(x, vdupq_n_f32(FLT_MIN));
+    if (vmaxvq_u32(subnormal))
+        rsqrts = vbslq_f32(subnormal, vdivq_f32(vdupq_n_f32(1), vsqrtq_f32(x)), rsqrts);
+    return rsqrts;
+}
+
+SIMSIMD_PUBLIC void simsimd_l2sq_f32_panel_neon(simsimd_f32_t const* a0, simsimd_f32_t const* a1,
+                                                simsimd_f32_t const* a2, simsimd_f32_t const* a3,
+                                                simsimd_f32_t const* panel, simsimd_size_t n, simsimd_f32_t* lanes) {
+    simsimd_f32_t const* as[4] = {a0, a1, a2, a3};
+    float32x4_t d_vecs[4][4];
+    for (int j = 0; j != 4; ++j)
+        for (int v = 0; v != 4; ++v)
+            d_vecs[j][v] = vdupq_n_f32(0);
+    for (simsimd_size_t i = 0; i != n; ++i, panel += SIMSIMD_PANEL_ROWS) {
+        float32x4_t b_vecs[4] = {vld1q_f32(panel), vld1q_f32(panel + 4), vld1q_f32(panel + 8), vld1q_f32(panel + 12)};
+        for (int j = 0; j != 4; ++j) {
+            float32x4_t a_vec = vdupq_n_f32(as[j][i]);
+            for (int v = 0; v != 4; ++v) {
+                float32x4_t e_vec = vsubq_f32(a_vec, b_vecs[v]);
+                d_vecs[j][v] = vfmaq_f32(d_vecs[j][v], e_vec, e_vec);
+            }
+        }
+    }
+    for (int j = 0; j != 4; ++j)
+        for (int v = 0; v != 4; ++v)
+            vst1q_f32(lanes + j * SIMSIMD_PANEL_ROWS + v * 4, d_vecs[j][v]);
+}
+
+SIMSIMD_PUBLIC void simsimd_dot_f32_panel_neon(simsimd_f32_t const* a0, simsimd_f32_t const* a1,
+                                               simsimd_f32_t const* a2, simsimd_f32_t const* a3,
+                                               simsimd_f32_t const* panel, simsimd_size_t n, simsimd_f32_t* lanes) {
+    simsimd_f32_t const* as[4] = {a0, a1, a2, a3};
+    float32x4_t ab_vecs[4][4];
+    for (int j = 0; j != 4; ++j)
+        for (int v = 0; v != 4; ++v)
+            ab_vecs[j][v] = vdupq_n_f32(0);
+    for (simsimd_size_t i = 0; i != n; ++i, panel += SIMSIMD_PANEL_ROWS) {
+        float32x4_t b_vecs[4] = {vld1q_f32(panel), vld1q_f32(panel + 4), vld1q_f32(panel + 8), vld1q_f32(panel + 12)};
+        for (int j = 0; j != 4; ++j)
+            for (int v = 0; v != 4; ++v)
+                ab_vecs[j][v] = vfmaq_n_f32(ab_vecs[j][v], b_vecs[v], as[j][i]);
+    }
+    for (int j = 0; j != 4; ++j)
+        for (int v = 0; v != 4; ++v)
+            vst1q_f32(lanes + j * SIMSIMD_PANEL_ROWS + v * 4, ab_vecs[j][v]);
+}
+
+SIMSIMD_PUBLIC void simsimd_cos_f32_panel_neon(simsimd_f32_t const* a0, simsimd_f32_t const* a1,
+                                               simsimd_f32_t const* a2, simsimd_f32_t const* a3,
+                                               simsimd_f32_t const* panel, simsimd_size_t n, simsimd_f32_t* lanes) {
+    simsimd_f32_t const* as[4] = {a0, a1, a2, a3};
+    simsimd_f32_t a2s[4] = {0, 0, 0, 0};
+    float32x4_t ab_vecs[4][4], b2_vecs[4];
+    for (int v = 0; v != 4; ++v) {
+        b2_vecs[v] = vdupq_n_f32(0);
+        for (int j = 0; j != 4; ++j)
+            ab_vecs[j][v] = vdupq_n_f32(0);
+    }
+    for (simsimd_size_t i = 0; i != n; ++i, panel += SIMSIMD_PANEL_ROWS) {
+        float32x4_t b_vecs[4] = {vld1q_f32(panel), vld1q_f32(panel + 4), vld1q_f32(panel + 8), vld1q_f32(panel + 12)};
+        for (int v = 0; v != 4; ++v)
+            b2_vecs[v] = vfmaq_f32(b2_vecs[v], b_vecs[v], b_vecs[v]);
+        for (int j = 0; j != 4; ++j) {
+            simsimd_f32_t ai = as[j][i];
+            a2s[j] += ai * ai;
+            for (int v = 0; v != 4; ++v)
+                ab_vecs[j][v] = vfmaq_n_f32(ab_vecs[j][v], b_vecs[v], ai);
+        }
+    }
+    // Rows with a zero dot-product, including the zero padding rows, are at the maximum distance of 1
+    float32x4_t ones_vec = vdupq_n_f32(1), zeros_vec = vdupq_n_f32(0);
+    for (int v = 0; v != 4; ++v)
+        b2_vecs[v] = simsimd_rsqrt_f32x4_neon(b2_vecs[v]);
+    for (int j = 0; j != 4; ++j) {
+        float32x4_t rsqrt_a2_vec = simsimd_rsqrt_f32x4_neon(vdupq_n_f32(a2s[j]));
+        for (int v = 0; v != 4; ++v) {
+            float32x4_t cos_vec = vmulq_f32(vmulq_f32(ab_vecs[j][v], rsqrt_a2_vec), b2_vecs[v]);
+            cos_vec = vbslq_f32(vceqq_f32(ab_vecs[j][v], zeros_vec), ones_vec, vsubq_f32(ones_vec, cos_vec));
+            vst1q_f32(lanes + j * SIMSIMD_PANEL_ROWS + v * 4, cos_vec);
+        }
+    }
+}
+
+SIMSIMD_MAKE_PACKED(l2sq, neon) // simsimd_packed_l2sq_f32_neon
+SIMSIMD_MAKE_PACKED(dot, neon)  // simsimd_packed_dot_f32_neon
+SIMSIMD_MAKE_PACKED(cos, neon)  // simsimd_packed_cos_f32_neon
+
 #pragma clang attribute pop
 #pragma GCC pop_options
 
+#if SIMSIMD_TARGET_NEON_F16
 #pragma GCC push_options
 #pragma GCC target("+simd+fp16")
 #pragma clang attribute push(__attribute__((target("+simd+fp16"))), apply_to = function)
@@ -289,13 +730,8 @@ SIMSIMD_PUBLIC void simsimd_cos_f16_neon(simsimd_f16_t const* a, simsimd_f16_t c
         b2_vec = vfmaq_f32(b2_vec, b_vec, b_vec);
     }
 
-    // Avoid `simsimd_approximate_inverse_square_root` on Arm NEON
     simsimd_f32_t ab = vaddvq_f32(ab_vec), a2 = vaddvq_f32(a2_vec), b2 = vaddvq_f32(b2_vec);
-    simsimd_f32_t a2_b2_arr[2] = {a2, b2};
-    float32x2_t a2_b2 = vld1_f32(a2_b2_arr);
-    a2_b2 = vrsqrte_f32(a2_b2);
-    vst1_f32(a2_b2_arr, a2_b2);
-    *result = ab != 0 ? 1 - ab * a2_b2_arr[0] * a2_b2_arr[1] : 1;
+    *result = simsimd_cos_normalize_f32_neon(ab, a2, b2);
 }
 
 #if SIMSIMD_TARGET_NEON_BF16_IMPLEMENTED
@@ -337,15 +773,10 @@ SIMSIMD_PUBLIC void simsimd_cos_bf16_neon(simsimd_bf16_t const* a, simsimd_bf16_
         b2_low_vec = vbfmlalbq_f32(b2_low_vec, b_padded_tail.bf16_vec, b_padded_tail.bf16_vec);
     }
 
-    // Avoid `simsimd_approximate_inverse_square_root` on Arm NEON
     simsimd_f32_t ab = vaddvq_f32(vaddq_f32(ab_high_vec, ab_low_vec)),
                   a2 = vaddvq_f32(vaddq_f32(a2_high_vec, a2_low_vec)),
                   b2 = vaddvq_f32(vaddq_f32(b2_high_vec, b2_low_vec));
-    simsimd_f32_t a2_b2_arr[2] = {a2, b2};
-    float32x2_t a2_b2 = vld1_f32(a2_b2_arr);
-    a2_b2 = vrsqrte_f32(a2_b2);
-    vst1_f32(a2_b2_arr, a2_b2);
-    *result = ab != 0 ? 1 - ab * a2_b2_arr[0] * a2_b2_arr[1] : 1;
+    *result = simsimd_cos_normalize_f32_neon(ab, a2, b2);
 }
 
 SIMSIMD_PUBLIC void simsimd_l2sq_bf16_neon(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n,
@@ -392,7 +823,9 @@ SIMSIMD_PUBLIC void simsimd_l2sq_bf16_neon(simsimd_bf16_t const* a, simsimd_bf16
 #endif
 #pragma clang attribute pop
 #pragma GCC pop_options
+#endif // SIMSIMD_TARGET_NEON_F16
 
+#if SIMSIMD_TARGET_NEON_I8
 #pragma GCC push_options
 #pragma GCC target("arch=armv8.2-a+dotprod")
 #pragma clang attribute push(__attribute__((target("arch=armv8.2-a+dotprod"))), apply_to = function)
@@ -459,16 +892,12 @@ SIMSIMD_PUBLIC void simsimd_cos_i8_neon(simsimd_i8_t const* a, simsimd_i8_t cons
         ab += ai * bi, a2 += ai * ai, b2 += bi * bi;
     }
 
-    // Avoid `simsimd_approximate_inverse_square_root` on Arm NEON
-    simsimd_f32_t a2_b2_arr[2] = {(simsimd_f32_t)a2, (simsimd_f32_t)b2};
-    float32x2_t a2_b2 = vld1_f32(a2_b2_arr);
-    a2_b2 = vrsqrte_f32(a2_b2);
-    vst1_f32(a2_b2_arr, a2_b2);
-    *result = ab != 0 ? 1 - ab * a2_b2_arr[0] * a2_b2_arr[1] : 1;
+    *result = simsimd_cos_normalize_f32_neon(ab, a2, b2);
 }
 
 #pragma clang attribute pop
 #pragma GCC pop_options
+#endif // SIMSIMD_TARGET_NEON_I8
 #endif // SIMSIMD_TARGET_NEON
 
 #if SIMSIMD_TARGET_SVE
@@ -512,12 +941,7 @@ SIMSIMD_PUBLIC void simsimd_cos_f32_sve(simsimd_f32_t const* a, simsimd_f32_t co
     simsimd_f32_t a2 = svaddv_f32(svptrue_b32(), a2_vec);
     simsimd_f32_t b2 = svaddv_f32(svptrue_b32(), b2_vec);
 
-    // Avoid `simsimd_approximate_inverse_square_root` on Arm NEON
-    simsimd_f32_t a2_b2_arr[2] = {a2, b2};
-    float32x2_t a2_b2 = vld1_f32(a2_b2_arr);
-    a2_b2 = vrsqrte_f32(a2_b2);
-    vst1_f32(a2_b2_arr, a2_b2);
-    *result = ab != 0 ? 1 - ab * a2_b2_arr[0] * a2_b2_arr[1] : 1;
+    *result = simsimd_cos_normalize_f32_neon(ab, a2, b2);
 }
 
 SIMSIMD_PUBLIC void simsimd_l2sq_f64_sve(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n,
@@ -556,12 +980,7 @@ SIMSIMD_PUBLIC void simsimd_cos_f64_sve(simsimd_f64_t const* a, simsimd_f64_t co
     simsimd_f64_t a2 = svaddv_f64(svptrue_b32(), a2_vec);
     simsimd_f64_t b2 = svaddv_f64(svptrue_b32(), b2_vec);
 
-    // Avoid `simsimd_approximate_inverse_square_root` on Arm NEON
-    simsimd_f64_t a2_b2_arr[2] = {a2, b2};
-    float64x2_t a2_b2 = vld1q_f64(a2_b2_arr);
-    a2_b2 = vrsqrteq_f64(a2_b2);
-    vst1q_f64(a2_b2_arr, a2_b2);
-    *result = ab != 0 ? 1 - ab * a2_b2_arr[0] * a2_b2_arr[1] : 1;
+    *result = simsimd_cos_normalize_f64_neon(ab, a2, b2);
 }
 
 #pragma clang attribute pop
@@ -611,20 +1030,155 @@ SIMSIMD_PUBLIC void simsimd_cos_f16_sve(simsimd_f16_t const* a_enum, simsimd_f16
     simsimd_f16_for_arm_simd_t a2 = svaddv_f16(svptrue_b16(), a2_vec);
     simsimd_f16_for_arm_simd_t b2 = svaddv_f16(svptrue_b16(), b2_vec);
 
-    // Avoid `simsimd_approximate_inverse_square_root` on Arm NEON
-    simsimd_f32_t a2_b2_arr[2] = {a2, b2};
-    float32x2_t a2_b2 = vld1_f32(a2_b2_arr);
-    a2_b2 = vrsqrte_f32(a2_b2);
-    vst1_f32(a2_b2_arr, a2_b2);
-    *result = ab != 0 ? 1 - ab * a2_b2_arr[0] * a2_b2_arr[1] : 1;
+    *result = simsimd_cos_normalize_f32_neon(ab, a2, b2);
+}
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("+sve")
+#pragma clang attribute push(__attribute__((target("+sve"))), apply_to = function)
+
+SIMSIMD_PUBLIC void simsimd_l2sq_i8_sve(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n,
+                                        simsimd_distance_t* result) {
+    simsimd_size_t i = 0;
+    svuint32_t d2_vec = svdup_n_u32(0);
+    do {
+        svbool_t pg_vec = svwhilelt_b8((unsigned int)i, (unsigned int)n);
+        svint8_t a_vec = svld1_s8(pg_vec, a + i);
+        svint8_t b_vec = svld1_s8(pg_vec, b + i);
+        // The absolute difference of two signed bytes always fits into an unsigned byte,
+        // so we can square and accumulate it with a single unsigned dot-product.
+        svuint8_t d_vec = svreinterpret_u8_s8(svabd_s8_z(pg_vec, a_vec, b_vec));
+        d2_vec = svdot_u32(d2_vec, d_vec, d_vec);
+        i += svcntb();
+    } while (i < n);
+    *result = svaddv_u32(svptrue_b32(), d2_vec);
+}
+
+SIMSIMD_PUBLIC void simsimd_cos_i8_sve(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n,
+                                       simsimd_distance_t* result) {
+    simsimd_size_t i = 0;
+    svint32_t ab_vec = svdup_n_s32(0);
+    svint32_t a2_vec = svdup_n_s32(0);
+    svint32_t b2_vec = svdup_n_s32(0);
+    do {
+        svbool_t pg_vec = svwhilelt_b8((unsigned int)i, (unsigned int)n);
+        svint8_t a_vec = svld1_s8(pg_vec, a + i);
+        svint8_t b_vec = svld1_s8(pg_vec, b + i);
+        ab_vec = svdot_s32(ab_vec, a_vec, b_vec);
+        a2_vec = svdot_s32(a2_vec, a_vec, a_vec);
+        b2_vec = svdot_s32(b2_vec, b_vec, b_vec);
+        i += svcntb();
+    } while (i < n);
+
+    simsimd_i32_t ab = (simsimd_i32_t)svaddv_s32(svptrue_b32(), ab_vec);
+    simsimd_i32_t a2 = (simsimd_i32_t)svaddv_s32(svptrue_b32(), a2_vec);
+    simsimd_i32_t b2 = (simsimd_i32_t)svaddv_s32(svptrue_b32(), b2_vec);
+
+    *result = simsimd_cos_normalize_f32_neon(ab, a2, b2);
+}
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+
+#if SIMSIMD_TARGET_NEON_BF16
+#pragma GCC push_options
+#pragma GCC target("+sve+bf16")
+#pragma clang attribute push(__attribute__((target("+sve+bf16"))), apply_to = function)
+
+SIMSIMD_PUBLIC void simsimd_l2sq_bf16_sve(simsimd_bf16_t const* a_enum, simsimd_bf16_t const* b_enum, simsimd_size_t n,
+                                          simsimd_distance_t* result) {
+    simsimd_size_t i = 0;
+    svfloat32_t d2_vec = svdup_n_f32(0.f);
+    unsigned short const* a = (unsigned short const*)(a_enum);
+    unsigned short const* b = (unsigned short const*)(b_enum);
+    do {
+        svbool_t pg_vec = svwhilelt_b16((unsigned int)i, (unsigned int)n);
+        svuint16_t a_vec = svld1_u16(pg_vec, a + i);
+        svuint16_t b_vec = svld1_u16(pg_vec, b + i);
+        // There is no `bf16` subtraction, so upcast both halves to `f32`, shifting the bits into the high half.
+        svfloat32_t a_low_vec = svreinterpret_f32_u32(svlsl_n_u32_x(svptrue_b32(), svunpklo_u32(a_vec), 16));
+        svfloat32_t a_high_vec = svreinterpret_f32_u32(svlsl_n_u32_x(svptrue_b32(), svunpkhi_u32(a_vec), 16));
+        svfloat32_t b_low_vec = svreinterpret_f32_u32(svlsl_n_u32_x(svptrue_b32(), svunpklo_u32(b_vec), 16));
+        svfloat32_t b_high_vec = svreinterpret_f32_u32(svlsl_n_u32_x(svptrue_b32(), svunpkhi_u32(b_vec), 16));
+        svfloat32_t d_low_vec = svsub_f32_x(svptrue_b32(), a_low_vec, b_low_vec);
+        svfloat32_t d_high_vec = svsub_f32_x(svptrue_b32(), a_high_vec, b_high_vec);
+        d2_vec = svmla_f32_x(svptrue_b32(), d2_vec, d_low_vec, d_low_vec);
+        d2_vec = svmla_f32_x(svptrue_b32(), d2_vec, d_high_vec, d_high_vec);
+        i += svcnth();
+    } while (i < n);
+    *result = svaddv_f32(svptrue_b32(), d2_vec);
+}
+
+SIMSIMD_PUBLIC void simsimd_cos_bf16_sve(simsimd_bf16_t const* a_enum, simsimd_bf16_t const* b_enum, simsimd_size_t n,
+                                         simsimd_distance_t* result) {
+    simsimd_size_t i = 0;
+    svfloat32_t ab_vec = svdup_n_f32(0.f);
+    svfloat32_t a2_vec = svdup_n_f32(0.f);
+    svfloat32_t b2_vec = svdup_n_f32(0.f);
+    simsimd_bf16_for_arm_simd_t const* a = (simsimd_bf16_for_arm_simd_t const*)(a_enum);
+    simsimd_bf16_for_arm_simd_t const* b = (simsimd_bf16_for_arm_simd_t const*)(b_enum);
+    do {
+        svbool_t pg_vec = svwhilelt_b16((unsigned int)i, (unsigned int)n);
+        svbfloat16_t a_vec = svld1_bf16(pg_vec, a + i);
+        svbfloat16_t b_vec = svld1_bf16(pg_vec, b + i);
+        ab_vec = svbfdot_f32(ab_vec, a_vec, b_vec);
+        a2_vec = svbfdot_f32(a2_vec, a_vec, a_vec);
+        b2_vec = svbfdot_f32(b2_vec, b_vec, b_vec);
+        i += svcnth();
+    } while (i < n);
+
+    simsimd_f32_t ab = svaddv_f32(svptrue_b32(), ab_vec);
+    simsimd_f32_t a2 = svaddv_f32(svptrue_b32(), a2_vec);
+    simsimd_f32_t b2 = svaddv_f32(svptrue_b32(), b2_vec);
+
+    *result = simsimd_cos_normalize_f32_neon(ab, a2, b2);
 }
 
 #pragma clang attribute pop
 #pragma GCC pop_options
+#endif // SIMSIMD_TARGET_NEON_BF16
 #endif // SIMSIMD_TARGET_SVE
 #endif // SIMSIMD_TARGET_ARM
 
 #if SIMSIMD_TARGET_X86
+
+/*  Turns the accumulated dot-product and squared norms into the cosine distance.
+ *  Uses only SSE instructions, available on every x86-64 CPU, so it can be inlined into any of the kernels below.
+ *  The `rsqrtps` estimate is only accurate to 12 bits, so it's refined with one Newton-Raphson step.
+ */
+SIMSIMD_INTERNAL simsimd_distance_t simsimd_cos_normalize_f32_x86(simsimd_f32_t ab, simsimd_f32_t a2,
+                                                                  simsimd_f32_t b2) {
+    if (ab == 0)
+        return 1;
+    // The `rsqrtps` of a subnormal is infinite, and the Newton-Raphson step would turn it into NaN,
+    // so those rare inputs take the exact square roots, dividing in double precision to avoid underflows
+    if (a2 < FLT_MIN || b2 < FLT_MIN)
+        return 1 - ab / (SIMSIMD_SQRT((simsimd_f64_t)a2) * SIMSIMD_SQRT((simsimd_f64_t)b2));
+    __m128 a2_b2 = _mm_set_ps(0.f, 0.f, a2, b2);
+    __m128 rsqrts = _mm_rsqrt_ps(a2_b2);
+    // One iteration of `y = y * (1.5 - 0.5 * x * y * y)`
+    __m128 half_a2_b2 = _mm_mul_ps(a2_b2, _mm_set1_ps(0.5f));
+    rsqrts = _mm_mul_ps(rsqrts, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(half_a2_b2, _mm_mul_ps(rsqrts, rsqrts))));
+    simsimd_f32_t rsqrt_b2 = _mm_cvtss_f32(rsqrts);
+    simsimd_f32_t rsqrt_a2 = _mm_cvtss_f32(_mm_shuffle_ps(rsqrts, rsqrts, _MM_SHUFFLE(0, 0, 0, 1)));
+    return 1 - ab * rsqrt_a2 * rsqrt_b2;
+}
+
+/*  Double-precision variant of `simsimd_cos_normalize_f32_x86`, using the exact `sqrtpd`.
+ */
+SIMSIMD_INTERNAL simsimd_distance_t simsimd_cos_normalize_f64_x86(simsimd_f64_t ab, simsimd_f64_t a2,
+                                                                  simsimd_f64_t b2) {
+    if (ab == 0)
+        return 1;
+    __m128d sqrts = _mm_sqrt_pd(_mm_set_pd(a2, b2));
+    simsimd_f64_t sqrt_b2 = _mm_cvtsd_f64(sqrts);
+    simsimd_f64_t sqrt_a2 = _mm_cvtsd_f64(_mm_unpackhi_pd(sqrts, sqrts));
+    return 1 - ab / (sqrt_a2 * sqrt_b2);
+}
+
 #if SIMSIMD_TARGET_HASWELL
 #pragma GCC push_options
 #pragma GCC target("avx2", "f16c", "fma")
@@ -720,13 +1274,7 @@ SIMSIMD_PUBLIC void simsimd_cos_f16_haswell(simsimd_f16_t const* a, simsimd_f16_
     _mm_store_ss(&a2, _mm256_castps256_ps128(a2_vec));
     _mm_store_ss(&b2, _mm256_castps256_ps128(b2_vec));
 
-    // Replace simsimd_approximate_inverse_square_root with `rsqrtss`
-    __m128 a2_sqrt_recip = _mm_rsqrt_ss(_mm_set_ss((float)a2));
-    __m128 b2_sqrt_recip = _mm_rsqrt_ss(_mm_set_ss((float)b2));
-    __m128 result_vec = _mm_mul_ss(a2_sqrt_recip, b2_sqrt_recip); // Multiply the reciprocal square roots
-    result_vec = _mm_mul_ss(result_vec, _mm_set_ss((float)ab));   // Multiply by ab
-    result_vec = _mm_sub_ss(_mm_set_ss(1.0f), result_vec);        // Subtract from 1
-    *result = ab != 0 ? _mm_cvtss_f32(result_vec) : 1;            // Extract the final result
+    *result = simsimd_cos_normalize_f32_x86(ab, a2, b2);
 }
 
 SIMSIMD_PUBLIC void simsimd_l2sq_bf16_haswell(simsimd_bf16_t const* a, simsimd_bf16_t const* b, simsimd_size_t n,
@@ -827,13 +1375,7 @@ SIMSIMD_PUBLIC void simsimd_cos_bf16_haswell(simsimd_bf16_t const* a, simsimd_bf
     _mm_store_ss(&a2, _mm256_castps256_ps128(a2_vec));
     _mm_store_ss(&b2, _mm256_castps256_ps128(b2_vec));
 
-    // Replace simsimd_approximate_inverse_square_root with `rsqrtss`
-    __m128 a2_sqrt_recip = _mm_rsqrt_ss(_mm_set_ss((float)a2));
-    __m128 b2_sqrt_recip = _mm_rsqrt_ss(_mm_set_ss((float)b2));
-    __m128 result_vec = _mm_mul_ss(a2_sqrt_recip, b2_sqrt_recip); // Multiply the reciprocal square roots
-    result_vec = _mm_mul_ss(result_vec, _mm_set_ss((float)ab));   // Multiply by ab
-    result_vec = _mm_sub_ss(_mm_set_ss(1.0f), result_vec);        // Subtract from 1
-    *result = ab != 0 ? _mm_cvtss_f32(result_vec) : 1;            // Extract the final result
+    *result = simsimd_cos_normalize_f32_x86(ab, a2, b2);
 }
 
 SIMSIMD_PUBLIC void simsimd_l2sq_i8_haswell(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n,
@@ -937,20 +1479,294 @@ SIMSIMD_PUBLIC void simsimd_cos_i8_haswell(simsimd_i8_t const* a, simsimd_i8_t c
         ab += ai * bi, a2 += ai * ai, b2 += bi * bi;
     }
 
-    // Compute the reciprocal of the square roots
-    __m128 a2_sqrt_recip = _mm_rsqrt_ss(_mm_set_ss((float)a2));
-    __m128 b2_sqrt_recip = _mm_rsqrt_ss(_mm_set_ss((float)b2));
+    *result = simsimd_cos_normalize_f32_x86((simsimd_f32_t)ab, (simsimd_f32_t)a2, (simsimd_f32_t)b2);
+}
 
-    // Compute cosine similarity: ab / sqrt(a2 * b2)
-    __m128 denom = _mm_mul_ss(a2_sqrt_recip, b2_sqrt_recip);      // Reciprocal of sqrt(a2 * b2)
-    __m128 result_vec = _mm_mul_ss(_mm_set_ss((float)ab), denom); // ab * reciprocal of sqrt(a2 * b2)
-    *result = ab != 0 ? 1 - _mm_cvtss_f32(result_vec) : 0;        // Extract the final result
+/*  Horizontal sum of 8 single-precision lanes, folding the halves of the register twice before the final `hadd`.
+ */
+SIMSIMD_INTERNAL simsimd_f32_t simsimd_reduce_f32x8_haswell(__m256 vec) {
+    __m128 sum = _mm_add_ps(_mm256_castps256_ps128(vec), _mm256_extractf128_ps(vec, 1));
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_movehdup_ps(sum));
+    return _mm_cvtss_f32(sum);
 }
 
+SIMSIMD_PUBLIC void simsimd_l2sq_f32x4_haswell(simsimd_f32_t const* a, simsimd_f32_t const* c0,
+                                               simsimd_f32_t const* c1, simsimd_f32_t const* c2,
+                                               simsimd_f32_t const* c3, simsimd_size_t n,
+                                               simsimd_distance_t* results) {
+    __m256 d0_vec = _mm256_setzero_ps(), d1_vec = _mm256_setzero_ps();
+    __m256 d2_vec = _mm256_setzero_ps(), d3_vec = _mm256_setzero_ps();
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 a_vec = _mm256_loadu_ps(a + i);
+        __m256 e0_vec = _mm256_sub_ps(a_vec, _mm256_loadu_ps(c0 + i));
+        __m256 e1_vec = _mm256_sub_ps(a_vec, _mm256_loadu_ps(c1 + i));
+        __m256 e2_vec = _mm256_sub_ps(a_vec, _mm256_loadu_ps(c2 + i));
+        __m256 e3_vec = _mm256_sub_ps(a_vec, _mm256_loadu_ps(c3 + i));
+        d0_vec = _mm256_fmadd_ps(e0_vec, e0_vec, d0_vec), d1_vec = _mm256_fmadd_ps(e1_vec, e1_vec, d1_vec);
+        d2_vec = _mm256_fmadd_ps(e2_vec, e2_vec, d2_vec), d3_vec = _mm256_fmadd_ps(e3_vec, e3_vec, d3_vec);
+    }
+    simsimd_f32_t d0 = simsimd_reduce_f32x8_haswell(d0_vec), d1 = simsimd_reduce_f32x8_haswell(d1_vec);
+    simsimd_f32_t d2 = simsimd_reduce_f32x8_haswell(d2_vec), d3 = simsimd_reduce_f32x8_haswell(d3_vec);
+    for (; i < n; ++i) {
+        simsimd_f32_t ai = a[i];
+        d0 += (ai - c0[i]) * (ai - c0[i]), d1 += (ai - c1[i]) * (ai - c1[i]);
+        d2 += (ai - c2[i]) * (ai - c2[i]), d3 += (ai - c3[i]) * (ai - c3[i]);
+    }
+    results[0] = d0, results[1] = d1, results[2] = d2, results[3] = d3;
+}
+
+SIMSIMD_PUBLIC void simsimd_dot_f32x4_haswell(simsimd_f32_t const* a, simsimd_f32_t const* c0, simsimd_f32_t const* c1,
+                                              simsimd_f32_t const* c2, simsimd_f32_t const* c3, simsimd_size_t n,
+                                              simsimd_distance_t* results) {
+    __m256 ab0_vec = _mm256_setzero_ps(), ab1_vec = _mm256_setzero_ps();
+    __m256 ab2_vec = _mm256_setzero_ps(), ab3_vec = _mm256_setzero_ps();
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 a_vec = _mm256_loadu_ps(a + i);
+        ab0_vec = _mm256_fmadd_ps(a_vec, _mm256_loadu_ps(c0 + i), ab0_vec);
+        ab1_vec = _mm256_fmadd_ps(a_vec, _mm256_loadu_ps(c1 + i), ab1_vec);
+        ab2_vec = _mm256_fmadd_ps(a_vec, _mm256_loadu_ps(c2 + i), ab2_vec);
+        ab3_vec = _mm256_fmadd_ps(a_vec, _mm256_loadu_ps(c3 + i), ab3_vec);
+    }
+    simsimd_f32_t ab0 = simsimd_reduce_f32x8_haswell(ab0_vec), ab1 = simsimd_reduce_f32x8_haswell(ab1_vec);
+    simsimd_f32_t ab2 = simsimd_reduce_f32x8_haswell(ab2_vec), ab3 = simsimd_reduce_f32x8_haswell(ab3_vec);
+    for (; i < n; ++i) {
+        simsimd_f32_t ai = a[i];
+        ab0 += ai * c0[i], ab1 += ai * c1[i], ab2 += ai * c2[i], ab3 += ai * c3[i];
+    }
+    results[0] = ab0, results[1] = ab1, results[2] = ab2, results[3] = ab3;
+}
+
+SIMSIMD_PUBLIC void simsimd_cos_f32x4_haswell(simsimd_f32_t const* a, simsimd_f32_t const* c0, simsimd_f32_t const* c1,
+                                              simsimd_f32_t const* c2, simsimd_f32_t const* c3, simsimd_size_t n,
+                                              simsimd_distance_t* results) {
+    simsimd_f32_t const* cs[4] = {c0, c1, c2, c3};
+    __m256 a2_vec = _mm256_setzero_ps(), ab_vecs[4], b2_vecs[4];
+    for (int j = 0; j != 4; ++j)
+        ab_vecs[j] = _mm256_setzero_ps(), b2_vecs[j] = _mm256_setzero_ps();
+    simsimd_size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 a_vec = _mm256_loadu_ps(a + i);
+        a2_vec = _mm256_fmadd_ps(a_vec, a_vec, a2_vec);
+        for (int j = 0; j != 4; ++j) {
+            __m256 b_vec = _mm256_loadu_ps(cs[j] + i);
+            ab_vecs[j] = _mm256_fmadd_ps(a_vec, b_vec, ab_vecs[j]);
+            b2_vecs[j] = _mm256_fmadd_ps(b_vec, b_vec, b2_vecs[j]);
+        }
+    }
+    simsimd_f32_t a2 = simsimd_reduce_f32x8_haswell(a2_vec), ab[4], b2[4];
+    for (int j = 0; j != 4; ++j)
+        ab[j] = simsimd_reduce_f32x8_haswell(ab_vecs[j]), b2[j] = simsimd_reduce_f32x8_haswell(b2_vecs[j]);
+    for (; i < n; ++i) {
+        simsimd_f32_t ai = a[i];
+        a2 += ai * ai;
+        for (int j = 0; j != 4; ++j)
+            ab[j] += ai * cs[j][i], b2[j] += cs[j][i] * cs[j][i];
+    }
+    for (int j = 0; j != 4; ++j)
+        results[j] = simsimd_cos_normalize_f32_x86(ab[j], a2, b2[j]);
+}
+
+SIMSIMD_MAKE_ASSIGN(l2sq, haswell, 1) // simsimd_assign_l2sq_f32_haswell
+SIMSIMD_MAKE_ASSIGN(dot, haswell, -1) // simsimd_assign_dot_f32_haswell
+SIMSIMD_MAKE_ASSIGN(cos, haswell, 1)  // simsimd_assign_cos_f32_haswell
+
+/*  Refines the 12-bit `rsqrtps` estimate with one Newton-Raphson step, like `simsimd_cos_normalize_f32_x86`,
+ *  replacing the lanes with subnormal inputs, where the estimate is infinite, with the exact reciprocal square roots.
+ */
+SIMSIMD_INTERNAL __m256 simsimd_rsqrt_f32x8_haswell(__m256 x) {
+    __m256 rsqrts = _mm256_rsqrt_ps(x);
+    __m256 half_x = _mm256_mul_ps(x, _mm256_set1_ps(0.5f));
+    rsqrts = _mm256_mul_ps(rsqrts, _mm256_fnmadd_ps(half_x, _mm256_mul_ps(rsqrts, rsqrts), _mm256_set1_ps(1.5f)));
+    __m256 subnormal = _mm256_cmp_ps(x, _mm256_set1_ps(FLT_MIN), _CMP_LT_OQ);
+    if (_mm256_movemask_ps(subnormal))
+        rsqrts = _mm256_blendv_ps(rsqrts, _mm256_div_ps(_mm256_set1_ps(1), _mm256_sqrt_ps(x)), subnormal);
+    return rsqrts;
+}
+
+SIMSIMD_PUBLIC void simsimd_l2sq_f32_panel_haswell(simsimd_f32_t const* a0, simsimd_f32_t const* a1,
+                                                   simsimd_f32_t const* a2, simsimd_f32_t const* a3,
+                                                   simsimd_f32_t const* panel, simsimd_size_t n,
+                                                   simsimd_f32_t* lanes) {
+    simsimd_f32_t const* as[4] = {a0, a1, a2, a3};
+    __m256 d_low_vecs[4], d_high_vecs[4];
+    for (int j = 0; j != 4; ++j)
+        d_low_vecs[j] = _mm256_setzero_ps(), d_high_vecs[j] = _mm256_setzero_ps();
+    for (simsimd_size_t i = 0; i != n; ++i, panel += SIMSIMD_PANEL_ROWS) {
+        __m256 b_low_vec = _mm256_loadu_ps(panel), b_high_vec = _mm256_loadu_ps(panel + 8);
+        for (int j = 0; j != 4; ++j) {
+            __m256 a_vec = _mm256_broadcast_ss(as[j] + i);
+            __m256 e_low_vec = _mm256_sub_ps(a_vec, b_low_vec), e_high_vec = _mm256_sub_ps(a_vec, b_high_vec);
+            d_low_vecs[j] = _mm256_fmadd_ps(e_low_vec, e_low_vec, d_low_vecs[j]);
+            d_high_vecs[j] = _mm256_fmadd_ps(e_high_vec, e_high_vec, d_high_vecs[j]);
+        }
+    }
+    for (int j = 0; j != 4; ++j) {
+        _mm256_storeu_ps(lanes + j * SIMSIMD_PANEL_ROWS, d_low_vecs[j]);
+        _mm256_storeu_ps(lanes + j * SIMSIMD_PANEL_ROWS + 8, d_high_vecs[j]);
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_dot_f32_panel_haswell(simsimd_f32_t const* a0, simsimd_f32_t const* a1,
+                                                  simsimd_f32_t const* a2, simsimd_f32_t const* a3,
+                                                  simsimd_f32_t const* panel, simsimd_size_t n, simsimd_f32_t* lanes) {
+    simsimd_f32_t const* as[4] = {a0, a1, a2, a3};
+    __m256 ab_low_vecs[4], ab_high_vecs[4];
+    for (int j = 0; j != 4; ++j)
+        ab_low_vecs[j] = _mm256_setzero_ps(), ab_high_vecs[j] = _mm256_setzero_ps();
+    for (simsimd_size_t i = 0; i != n; ++i, panel += SIMSIMD_PANEL_ROWS) {
+        __m256 b_low_vec = _mm256_loadu_ps(panel), b_high_vec = _mm256_loadu_ps(panel + 8);
+        for (int j = 0; j != 4; ++j) {
+            __m256 a_vec = _mm256_broadcast_ss(as[j] + i);
+            ab_low_vecs[j] = _mm256_fmadd_ps(a_vec, b_low_vec, ab_low_vecs[j]);
+            ab_high_vecs[j] = _mm256_fmadd_ps(a_vec, b_high_vec, ab_high_vecs[j]);
+        }
+    }
+    for (int j = 0; j != 4; ++j) {
+        _mm256_storeu_ps(lanes + j * SIMSIMD_PANEL_ROWS, ab_low_vecs[j]);
+        _mm256_storeu_ps(lanes + j * SIMSIMD_PANEL_ROWS + 8, ab_high_vecs[j]);
+    }
+}
+
+SIMSIMD_PUBLIC void simsimd_cos_f32_panel_haswell(simsimd_f32_t const* a0, simsimd_f32_t const* a1,
+                                                  simsimd_f32_t const* a2, simsimd_f32_t const* a3,
+                                                  simsimd_f32_t const* panel, simsimd_size_t n, simsimd_f32_t* lanes) {
+    simsimd_f32_t const* as[4] = {a0, a1, a2, a3};
+    simsimd_f32_t a2s[4] = {0, 0, 0, 0};
+    __m256 ab_low_vecs[4], ab_high_vecs[4], b2_low_vec = _mm256_setzero_ps(), b2_high_vec = _mm256_setzero_ps();
+    for (int j = 0; j != 4; ++j)
+        ab_low_vecs[j] = _mm256_setzero_ps(), ab_high_vecs[j] = _mm256_setzero_ps();
+    for (simsimd_size_t i = 0; i != n; ++i, panel += SIMSIMD_PANEL_ROWS) {
+        __m256 b_low_vec = _mm256_loadu_ps(panel), b_high_vec = _mm256_loadu_ps(panel + 8);
+        b2_low_vec = _mm256_fmadd_ps(b_low_vec, b_low_vec, b2_low_vec);
+        b2_high_vec = _mm256_fmadd_ps(b_high_vec, b_high_vec, b2_high_vec);
+        for (int j = 0; j != 4; ++j) {
+            __m256 a_vec = _mm256_broadcast_ss(as[j] + i);
+            a2s[j] += as[j][i] * as[j][i];
+            ab_low_vecs[j] = _mm256_fmadd_ps(a_vec, b_low_vec, ab_low_vecs[j]);
+            ab_high_vecs[j] = _mm256_fmadd_ps(a_vec, b_high_vec, ab_high_vecs[j]);
+        }
+    }
+    // Rows with a zero dot-product, including the zero padding rows, are at the maximum distance of 1
+    __m256 ones_vec = _mm256_set1_ps(1), zeros_vec = _mm256_setzero_ps();
+    __m256 rsqrt_b2_low_vec = simsimd_rsqrt_f32x8_haswell(b2_low_vec);
+    __m256 rsqrt_b2_high_vec = simsimd_rsqrt_f32x8_haswell(b2_high_vec);
+    for (int j = 0; j != 4; ++j) {
+        __m256 rsqrt_a2_vec = simsimd_rsqrt_f32x8_haswell(_mm256_set1_ps(a2s[j]));
+        __m256 low_vec = _mm256_mul_ps(_mm256_mul_ps(ab_low_vecs[j], rsqrt_a2_vec), rsqrt_b2_low_vec);
+        __m256 high_vec = _mm256_mul_ps(_mm256_mul_ps(ab_high_vecs[j], rsqrt_a2_vec), rsqrt_b2_high_vec);
+        low_vec = _mm256_blendv_ps(_mm256_sub_ps(ones_vec, low_vec), ones_vec,
+                                   _mm256_cmp_ps(ab_low_vecs[j], zeros_vec, _CMP_EQ_OQ));
+        high_vec = _mm256_blendv_ps(_mm256_sub_ps(ones_vec, high_vec), ones_vec,
+                                    _mm256_cmp_ps(ab_high_vecs[j], zeros_vec, _CMP_EQ_OQ));
+        _mm256_storeu_ps(lanes + j * SIMSIMD_PANEL_ROWS, low_vec);
+        _mm256_storeu_ps(lanes + j * SIMSIMD_PANEL_ROWS + 8, high_vec);
+    }
+}
+
+SIMSIMD_MAKE_PACKED(l2sq, haswell) // simsimd_packed_l2sq_f32_haswell
+SIMSIMD_MAKE_PACKED(dot, haswell)  // simsimd_packed_dot_f32_haswell
+SIMSIMD_MAKE_PACKED(cos, haswell)  // simsimd_packed_cos_f32_haswell
+
 #pragma clang attribute pop
 #pragma GCC pop_options
 #endif // SIMSIMD_TARGET_HASWELL
 
+#if SIMSIMD_TARGET_ALDER
+#pragma GCC push_options
+#pragma GCC target("avx2", "avxvnni")
+#pragma clang attribute push(__attribute__((target("avx2,avxvnni"))), apply_to = function)
+
+SIMSIMD_PUBLIC void simsimd_l2sq_i8_alder(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n,
+                                          simsimd_distance_t* result) {
+
+    // Differences of 8-bit integers don't fit into 8 bits, so we upcast to 16-bit integers
+    // and use the `_mm256_dpwssd_avx_epi32` to square and accumulate pairs of adjacent values.
+    __m256i d2_vec = _mm256_setzero_si256();
+
+    simsimd_size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i a_vec = _mm256_loadu_si256((__m256i const*)(a + i));
+        __m256i b_vec = _mm256_loadu_si256((__m256i const*)(b + i));
+        __m256i d_low_vec = _mm256_sub_epi16(_mm256_cvtepi8_epi16(_mm256_castsi256_si128(a_vec)),
+                                             _mm256_cvtepi8_epi16(_mm256_castsi256_si128(b_vec)));
+        __m256i d_high_vec = _mm256_sub_epi16(_mm256_cvtepi8_epi16(_mm256_extracti128_si256(a_vec, 1)),
+                                              _mm256_cvtepi8_epi16(_mm256_extracti128_si256(b_vec, 1)));
+        d2_vec = _mm256_dpwssd_avx_epi32(d2_vec, d_low_vec, d_low_vec);
+        d2_vec = _mm256_dpwssd_avx_epi32(d2_vec, d_high_vec, d_high_vec);
+    }
+
+    __m128i d2_sum = _mm_add_epi32(_mm256_castsi256_si128(d2_vec), _mm256_extracti128_si256(d2_vec, 1));
+    d2_sum = _mm_hadd_epi32(d2_sum, d2_sum);
+    d2_sum = _mm_hadd_epi32(d2_sum, d2_sum);
+    int d2 = _mm_cvtsi128_si32(d2_sum);
+
+    // Take care of the tail:
+    for (; i < n; ++i) {
+        int d = a[i] - b[i];
+        d2 += d * d;
+    }
+    *result = (simsimd_f64_t)d2;
+}
+
+SIMSIMD_PUBLIC void simsimd_cos_i8_alder(simsimd_i8_t const* a, simsimd_i8_t const* b, simsimd_size_t n,
+                                         simsimd_distance_t* result) {
+
+    // The `_mm256_dpbusd_avx_epi32` multiplies unsigned bytes of the first argument by signed bytes of the second.
+    // Flipping the sign bit maps a signed byte `x` into an unsigned `x + 128`, so each product gets biased
+    // by `128 * y`, which we can subtract after the loop, knowing the sums of both vectors.
+    __m256i const sign_vec = _mm256_set1_epi8((char)0x80);
+    __m256i const ones_vec = _mm256_set1_epi8(1);
+    __m256i ab_biased_vec = _mm256_setzero_si256();
+    __m256i a2_biased_vec = _mm256_setzero_si256();
+    __m256i b2_biased_vec = _mm256_setzero_si256();
+    __m256i a_sum_vec = _mm256_setzero_si256();
+    __m256i b_sum_vec = _mm256_setzero_si256();
+
+    simsimd_size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i a_vec = _mm256_loadu_si256((__m256i const*)(a + i));
+        __m256i b_vec = _mm256_loadu_si256((__m256i const*)(b + i));
+        __m256i a_unsigned_vec = _mm256_xor_si256(a_vec, sign_vec);
+        __m256i b_unsigned_vec = _mm256_xor_si256(b_vec, sign_vec);
+        ab_biased_vec = _mm256_dpbusd_avx_epi32(ab_biased_vec, a_unsigned_vec, b_vec);
+        a2_biased_vec = _mm256_dpbusd_avx_epi32(a2_biased_vec, a_unsigned_vec, a_vec);
+        b2_biased_vec = _mm256_dpbusd_avx_epi32(b2_biased_vec, b_unsigned_vec, b_vec);
+        a_sum_vec = _mm256_dpbusd_avx_epi32(a_sum_vec, ones_vec, a_vec);
+        b_sum_vec = _mm256_dpbusd_avx_epi32(b_sum_vec, ones_vec, b_vec);
+    }
+
+    // Remove the bias
+    __m256i ab_vec = _mm256_sub_epi32(ab_biased_vec, _mm256_slli_epi32(b_sum_vec, 7));
+    __m256i a2_vec = _mm256_sub_epi32(a2_biased_vec, _mm256_slli_epi32(a_sum_vec, 7));
+    __m256i b2_vec = _mm256_sub_epi32(b2_biased_vec, _mm256_slli_epi32(b_sum_vec, 7));
+
+    // Horizontal sums across the 256-bit registers
+    __m128i ab_sum = _mm_add_epi32(_mm256_castsi256_si128(ab_vec), _mm256_extracti128_si256(ab_vec, 1));
+    __m128i a2_sum = _mm_add_epi32(_mm256_castsi256_si128(a2_vec), _mm256_extracti128_si256(a2_vec, 1));
+    __m128i b2_sum = _mm_add_epi32(_mm256_castsi256_si128(b2_vec), _mm256_extracti128_si256(b2_vec, 1));
+    ab_sum = _mm_hadd_epi32(ab_sum, ab_sum), ab_sum = _mm_hadd_epi32(ab_sum, ab_sum);
+    a2_sum = _mm_hadd_epi32(a2_sum, a2_sum), a2_sum = _mm_hadd_epi32(a2_sum, a2_sum);
+    b2_sum = _mm_hadd_epi32(b2_sum, b2_sum), b2_sum = _mm_hadd_epi32(b2_sum, b2_sum);
+    int ab = _mm_cvtsi128_si32(ab_sum);
+    int a2 = _mm_cvtsi128_si32(a2_sum);
+    int b2 = _mm_cvtsi128_si32(b2_sum);
+
+    // Take care of the tail:
+    for (; i < n; ++i) {
+        int ai = a[i], bi = b[i];
+        ab += ai * bi, a2 += ai * ai, b2 += bi * bi;
+    }
+
+    *result = simsimd_cos_normalize_f32_x86((simsimd_f32_t)ab, (simsimd_f32_t)a2, (simsimd_f32_t)b2);
+}
+
+#pragma clang attribute pop
+#pragma GCC pop_options
+#endif // SIMSIMD_TARGET_ALDER
+
 #if SIMSIMD_TARGET_SKYLAKE
 #pragma GCC push_options
 #pragma GCC target("avx512f", "avx512vl", "bmi2")
@@ -1008,13 +1824,7 @@ simsimd_cos_f32_skylake_cycle:
     simsimd_f32_t a2 = _mm512_reduce_add_ps(a2_vec);
     simsimd_f32_t b2 = _mm512_reduce_add_ps(b2_vec);
 
-    // Compute the reciprocal square roots of a2 and b2
-    // Mysteriously, MSVC has no `_mm_rsqrt14_ps` intrinsic, but has it's masked variants,
-    // so let's use `_mm_maskz_rsqrt14_ps(0xFF, ...)` instead.
-    __m128 rsqrts = _mm_maskz_rsqrt14_ps(0xFF, _mm_set_ps(0.f, 0.f, a2 + 1.e-9f, b2 + 1.e-9f));
-    simsimd_f32_t rsqrt_a2 = _mm_cvtss_f32(rsqrts);
-    simsimd_f32_t rsqrt_b2 = _mm_cvtss_f32(_mm_shuffle_ps(rsqrts, rsqrts, _MM_SHUFFLE(0, 0, 0, 1)));
-    *result = 1 - ab * rsqrt_a2 * rsqrt_b2;
+    *result = simsimd_cos_normalize_f32_x86(ab, a2, b2);
 }
 
 SIMSIMD_PUBLIC void simsimd_l2sq_f64_skylake(simsimd_f64_t const* a, simsimd_f64_t const* b, simsimd_size_t n,
@@ -1065,19 +1875,154 @@ simsimd_cos_f64_skylake_cycle:
     if (n)
         goto simsimd_cos_f64_skylake_cycle;
 
-    simsimd_f32_t ab = (simsimd_f32_t)_mm512_reduce_add_pd(ab_vec);
-    simsimd_f32_t a2 = (simsimd_f32_t)_mm512_reduce_add_pd(a2_vec);
-    simsimd_f32_t b2 = (simsimd_f32_t)_mm512_reduce_add_pd(b2_vec);
+    simsimd_f64_t ab = _mm512_reduce_add_pd(ab_vec);
+    simsimd_f64_t a2 = _mm512_reduce_add_pd(a2_vec);
+    simsimd_f64_t b2 = _mm512_reduce_add_pd(b2_vec);
+    *result = simsimd_cos_normalize_f64_x86(ab, a2, b2);
+}
+
+SIMSIMD_PUBLIC void simsimd_l2sq_f32x4_skylake(simsimd_f32_t const* a, simsimd_f32_t const* c0,
+                                               simsimd_f32_t const* c1, simsimd_f32_t const* c2,
+                                               simsimd_f32_t const* c3, simsimd_size_t n,
+                                               simsimd_distance_t* results) {
+    __m512 d0_vec = _mm512_setzero(), d1_vec = _mm512_setzero(), d2_vec = _mm512_setzero(), d3_vec = _mm512_setzero();
+    for (simsimd_size_t i = 0; i < n; i += 16) {
+        __mmask16 mask = n - i < 16 ? (__mmask16)_bzhi_u32(0xFFFFFFFF, (unsigned int)(n - i)) : (__mmask16)0xFFFF;
+        __m512 a_vec = _mm512_maskz_loadu_ps(mask, a + i);
+        __m512 e0_vec = _mm512_sub_ps(a_vec, _mm512_maskz_loadu_ps(mask, c0 + i));
+        __m512 e1_vec = _mm512_sub_ps(a_vec, _mm512_maskz_loadu_ps(mask, c1 + i));
+        __m512 e2_vec = _mm512_sub_ps(a_vec, _mm512_maskz_loadu_ps(mask, c2 + i));
+        __m512 e3_vec = _mm512_sub_ps(a_vec, _mm512_maskz_loadu_ps(mask, c3 + i));
+        d0_vec = _mm512_fmadd_ps(e0_vec, e0_vec, d0_vec), d1_vec = _mm512_fmadd_ps(e1_vec, e1_vec, d1_vec);
+        d2_vec = _mm512_fmadd_ps(e2_vec, e2_vec, d2_vec), d3_vec = _mm512_fmadd_ps(e3_vec, e3_vec, d3_vec);
+    }
+    results[0] = _mm512_reduce_add_ps(d0_vec), results[1] = _mm512_reduce_add_ps(d1_vec);
+    results[2] = _mm512_reduce_add_ps(d2_vec), results[3] = _mm512_reduce_add_ps(d3_vec);
+}
+
+SIMSIMD_PUBLIC void simsimd_dot_f32x4_skylake(simsimd_f32_t const* a, simsimd_f32_t const* c0, simsimd_f32_t const* c1,
+                                              simsimd_f32_t const* c2, simsimd_f32_t const* c3, simsimd_size_t n,
+                                              simsimd_distance_t* results) {
+    __m512 ab0_vec = _mm512_setzero(), ab1_vec = _mm512_setzero();
+    __m512 ab2_vec = _mm512_setzero(), ab3_vec = _mm512_setzero();
+    for (simsimd_size_t i = 0; i < n; i += 16) {
+        __mmask16 mask = n - i < 16 ? (__mmask16)_bzhi_u32(0xFFFFFFFF, (unsigned int)(n - i)) : (__mmask16)0xFFFF;
+        __m512 a_vec = _mm512_maskz_loadu_ps(mask, a + i);
+        ab0_vec = _mm512_fmadd_ps(a_vec, _mm512_maskz_loadu_ps(mask, c0 + i), ab0_vec);
+        ab1_vec = _mm512_fmadd_ps(a_vec, _mm512_maskz_loadu_ps(mask, c1 + i), ab1_vec);
+        ab2_vec = _mm512_fmadd_ps(a_vec, _mm512_maskz_loadu_ps(mask, c2 + i), ab2_vec);
+        ab3_vec = _mm512_fmadd_ps(a_vec, _mm512_maskz_loadu_ps(mask, c3 + i), ab3_vec);
+    }
+    results[0] = _mm512_reduce_add_ps(ab0_vec), results[1] = _mm512_reduce_add_ps(ab1_vec);
+    results[2] = _mm512_reduce_add_ps(ab2_vec), results[3] = _mm512_reduce_add_ps(ab3_vec);
+}
+
+SIMSIMD_PUBLIC void simsimd_cos_f32x4_skylake(simsimd_f32_t const* a, simsimd_f32_t const* c0, simsimd_f32_t const* c1,
+                                              simsimd_f32_t const* c2, simsimd_f32_t const* c3, simsimd_size_t n,
+                                              simsimd_distance_t* results) {
+    simsimd_f32_t const* cs[4] = {c0, c1, c2, c3};
+    __m512 a2_vec = _mm512_setzero(), ab_vecs[4], b2_vecs[4];
+    for (int j = 0; j != 4; ++j)
+        ab_vecs[j] = _mm512_setzero(), b2_vecs[j] = _mm512_setzero();
+    for (simsimd_size_t i = 0; i < n; i += 16) {
+        __mmask16 mask = n - i < 16 ? (__mmask16)_bzhi_u32(0xFFFFFFFF, (unsigned int)(n - i)) : (__mmask16)0xFFFF;
+        __m512 a_vec = _mm512_maskz_loadu_ps(mask, a + i);
+        a2_vec = _mm512_fmadd_ps(a_vec, a_vec, a2_vec);
+        for (int j = 0; j != 4; ++j) {
+            __m512 b_vec = _mm512_maskz_loadu_ps(mask, cs[j] + i);
+            ab_vecs[j] = _mm512_fmadd_ps(a_vec, b_vec, ab_vecs[j]);
+            b2_vecs[j] = _mm512_fmadd_ps(b_vec, b_vec, b2_vecs[j]);
+        }
+    }
+    simsimd_f32_t a2 = _mm512_reduce_add_ps(a2_vec);
+    for (int j = 0; j != 4; ++j)
+        results[j] =
+            simsimd_cos_normalize_f32_x86(_mm512_reduce_add_ps(ab_vecs[j]), a2, _mm512_reduce_add_ps(b2_vecs[j]));
+}
+
+SIMSIMD_MAKE_ASSIGN(l2sq, skylake, 1) // simsimd_assign_l2sq_f32_skylake
+SIMSIMD_MAKE_ASSIGN(dot, skylake, -1) // simsimd_assign_dot_f32_skylake
+SIMSIMD_MAKE_ASSIGN(cos, skylake, 1)  // simsimd_assign_cos_f32_skylake
 
-    // Compute the reciprocal square roots of a2 and b2
-    // Mysteriously, MSVC has no `_mm_rsqrt14_ps` intrinsic, but has it's masked variants,
-    // so let's use `_mm_maskz_rsqrt14_ps(0xFF, ...)` instead.
-    __m128 rsqrts = _mm_maskz_rsqrt14_ps(0xFF, _mm_set_ps(0.f, 0.f, a2 + 1.e-9f, b2 + 1.e-9f));
-    simsimd_f32_t rsqrt_a2 = _mm_cvtss_f32(rsqrts);
-    simsimd_f32_t rsqrt_b2 = _mm_cvtss_f32(_mm_shuffle_ps(rsqrts, rsqrts, _MM_SHUFFLE(0, 0, 0, 1)));
-    *result = 1 - ab * rsqrt_a2 * rsqrt_b2;
+/*  Refines the 14-bit `rsqrt14ps` estimate with one Newton-Raphson step, replacing the lanes with subnormal
+ *  inputs with the exact reciprocal square roots, like `simsimd_rsqrt_f32x8_haswell`.
+ */
+SIMSIMD_INTERNAL __m512 simsimd_rsqrt_f32x16_skylake(__m512 x) {
+    __m512 rsqrts = _mm512_rsqrt14_ps(x);
+    __m512 half_x = _mm512_mul_ps(x, _mm512_set1_ps(0.5f));
+    rsqrts = _mm512_mul_ps(rsqrts, _mm512_fnmadd_ps(half_x, _mm512_mul_ps(rsqrts, rsqrts), _mm512_set1_ps(1.5f)));
+    __mmask16 subnormal = _mm512_cmp_ps_mask(x, _mm512_set1_ps(FLT_MIN), _CMP_LT_OQ);
+    if (subnormal)
+        rsqrts = _mm512_mask_div_ps(rsqrts, subnormal, _mm512_set1_ps(1), _mm512_sqrt_ps(x));
+    return rsqrts;
+}
+
+SIMSIMD_PUBLIC void simsimd_l2sq_f32_panel_skylake(simsimd_f32_t const* a0, simsimd_f32_t const* a1,
+                                                   simsimd_f32_t const* a2, simsimd_f32_t const* a3,
+                                                   simsimd_f32_t const* panel, simsimd_size_t n,
+                                                   simsimd_f32_t* lanes) {
+    __m512 d0_vec = _mm512_setzero(), d1_vec = _mm512_setzero(), d2_vec = _mm512_setzero(), d3_vec = _mm512_setzero();
+    for (simsimd_size_t i = 0; i != n; ++i, panel += SIMSIMD_PANEL_ROWS) {
+        __m512 b_vec = _mm512_loadu_ps(panel);
+        __m512 e0_vec = _mm512_sub_ps(_mm512_set1_ps(a0[i]), b_vec);
+        __m512 e1_vec = _mm512_sub_ps(_mm512_set1_ps(a1[i]), b_vec);
+        __m512 e2_vec = _mm512_sub_ps(_mm512_set1_ps(a2[i]), b_vec);
+        __m512 e3_vec = _mm512_sub_ps(_mm512_set1_ps(a3[i]), b_vec);
+        d0_vec = _mm512_fmadd_ps(e0_vec, e0_vec, d0_vec), d1_vec = _mm512_fmadd_ps(e1_vec, e1_vec, d1_vec);
+        d2_vec = _mm512_fmadd_ps(e2_vec, e2_vec, d2_vec), d3_vec = _mm512_fmadd_ps(e3_vec, e3_vec, d3_vec);
+    }
+    _mm512_storeu_ps(lanes, d0_vec), _mm512_storeu_ps(lanes + SIMSIMD_PANEL_ROWS, d1_vec);
+    _mm512_storeu_ps(lanes + 2 * SIMSIMD_PANEL_ROWS, d2_vec), _mm512_storeu_ps(lanes + 3 * SIMSIMD_PANEL_ROWS, d3_vec);
 }
 
+SIMSIMD_PUBLIC void simsimd_dot_f32_panel_skylake(simsimd_f32_t const* a0, simsimd_f32_t const* a1,
+                                                  simsimd_f32_t const* a2, simsimd_f32_t const* a3,
+                                                  simsimd_f32_t const* panel, simsimd_size_t n, simsimd_f32_t* lanes) {
+    __m512 ab0_vec = _mm512_setzero(), ab1_vec = _mm512_setzero();
+    __m512 ab2_vec = _mm512_setzero(), ab3_vec = _mm512_setzero();
+    for (simsimd_size_t i = 0; i != n; ++i, panel += SIMSIMD_PANEL_ROWS) {
+        __m512 b_vec = _mm512_loadu_ps(panel);
+        ab0_vec = _mm512_fmadd_ps(_mm512_set1_ps(a0[i]), b_vec, ab0_vec);
+        ab1_vec = _mm512_fmadd_ps(_mm512_set1_ps(a1[i]), b_vec, ab1_vec);
+        ab2_vec = _mm512_fmadd_ps(_mm512_set1_ps(a2[i]), b_vec, ab2_vec);
+        ab3_vec = _mm512_fmadd_ps(_mm512_set1_ps(a3[i]), b_vec, ab3_vec);
+    }
+    _mm512_storeu_ps(lanes, ab0_vec), _mm512_storeu_ps(lanes + SIMSIMD_PANEL_ROWS, ab1_vec);
+    _mm512_storeu_ps(lanes + 2 * SIMSIMD_PANEL_ROWS, ab2_vec);
+    _mm512_storeu_ps(lanes + 3 * SIMSIMD_PANEL_ROWS, ab3_vec);
+}
+
+SIMSIMD_PUBLIC void simsimd_cos_f32_panel_skylake(simsimd_f32_t const* a0, simsimd_f32_t const* a1,
+                                                  simsimd_f32_t const* a2, simsimd_f32_t const* a3,
+                                                  simsimd_f32_t const* panel, simsimd_size_t n, simsimd_f32_t* lanes) {
+    simsimd_f32_t const* as[4] = {a0, a1, a2, a3};
+    simsimd_f32_t a2s[4] = {0, 0, 0, 0};
+    __m512 ab_vecs[4], b2_vec = _mm512_setzero();
+    for (int j = 0; j != 4; ++j)
+        ab_vecs[j] = _mm512_setzero();
+    for (simsimd_size_t i = 0; i != n; ++i, panel += SIMSIMD_PANEL_ROWS) {
+        __m512 b_vec = _mm512_loadu_ps(panel);
+        b2_vec = _mm512_fmadd_ps(b_vec, b_vec, b2_vec);
+        for (int j = 0; j != 4; ++j) {
+            a2s[j] += as[j][i] * as[j][i];
+            ab_vecs[j] = _mm512_fmadd_ps(_mm512_set1_ps(as[j][i]), b_vec, ab_vecs[j]);
+        }
+    }
+    // Rows with a zero dot-product, including the zero padding rows, are at the maximum distance of 1
+    __m512 ones_vec = _mm512_set1_ps(1), rsqrt_b2_vec = simsimd_rsqrt_f32x16_skylake(b2_vec);
+    for (int j = 0; j != 4; ++j) {
+        __m512 rsqrt_a2_vec = simsimd_rsqrt_f32x16_skylake(_mm512_set1_ps(a2s[j]));
+        __m512 cos_vec = _mm512_mul_ps(_mm512_mul_ps(ab_vecs[j], rsqrt_a2_vec), rsqrt_b2_vec);
+        __mmask16 zeros = _mm512_cmp_ps_mask(ab_vecs[j], _mm512_setzero(), _CMP_EQ_OQ);
+        cos_vec = _mm512_mask_blend_ps(zeros, _mm512_sub_ps(ones_vec, cos_vec), ones_vec);
+        _mm512_storeu_ps(lanes + j * SIMSIMD_PANEL_ROWS, cos_vec);
+    }
+}
+
+SIMSIMD_MAKE_PACKED(l2sq, skylake) // simsimd_packed_l2sq_f32_skylake
+SIMSIMD_MAKE_PACKED(dot, skylake)  // simsimd_packed_dot_f32_skylake
+SIMSIMD_MAKE_PACKED(cos, skylake)  // simsimd_packed_cos_f32_skylake
+
 #pragma clang attribute pop
 #pragma GCC pop_options
 #endif // SIMSIMD_TARGET_SKYLAKE
@@ -1164,11 +2109,7 @@ simsimd_cos_bf16_genoa_cycle:
     simsimd_f32_t a2 = _mm512_reduce_add_ps(a2_vec);
     simsimd_f32_t b2 = _mm512_reduce_add_ps(b2_vec);
 
-    // Compute the reciprocal square roots of a2 and b2
-    __m128 rsqrts = _mm_rsqrt14_ps(_mm_set_ps(0.f, 0.f, a2 + 1.e-9f, b2 + 1.e-9f));
-    simsimd_f32_t rsqrt_a2 = _mm_cvtss_f32(rsqrts);
-    simsimd_f32_t rsqrt_b2 = _mm_cvtss_f32(_mm_shuffle_ps(rsqrts, rsqrts, _MM_SHUFFLE(0, 0, 0, 1)));
-    *result = ab != 0 ? 1 - ab * rsqrt_a2 * rsqrt_b2 : 0;
+    *result = simsimd_cos_normalize_f32_x86(ab, a2, b2);
 }
 
 #pragma clang attribute pop
@@ -1232,11 +2173,7 @@ simsimd_cos_f16_sapphire_cycle:
     simsimd_f32_t a2 = _mm512_reduce_add_ph(a2_vec);
     simsimd_f32_t b2 = _mm512_reduce_add_ph(b2_vec);
 
-    // Compute the reciprocal square roots of a2 and b2
-    __m128 rsqrts = _mm_rsqrt14_ps(_mm_set_ps(0.f, 0.f, a2 + 1.e-9f, b2 + 1.e-9f));
-    simsimd_f32_t rsqrt_a2 = _mm_cvtss_f32(rsqrts);
-    simsimd_f32_t rsqrt_b2 = _mm_cvtss_f32(_mm_shuffle_ps(rsqrts, rsqrts, _MM_SHUFFLE(0, 0, 0, 1)));
-    *result = ab != 0 ? 1 - ab * rsqrt_a2 * rsqrt_b2 : 0;
+    *result = simsimd_cos_normalize_f32_x86(ab, a2, b2);
 }
 
 #pragma clang attribute pop
@@ -1320,13 +2257,7 @@ simsimd_cos_i8_ice_cycle:
     int a2 = _mm512_reduce_add_epi32(a2_i32s_vec);
     int b2 = _mm512_reduce_add_epi32(b2_i32s_vec);
 
-    // Compute the reciprocal square roots of a2 and b2
-    // Mysteriously, MSVC has no `_mm_rsqrt14_ps` intrinsic, but has it's masked variants,
-    // so let's use `_mm_maskz_rsqrt14_ps(0xFF, ...)` instead.
-    __m128 rsqrts = _mm_maskz_rsqrt14_ps(0xFF, _mm_set_ps(0.f, 0.f, a2 + 1.e-9f, b2 + 1.e-9f));
-    simsimd_f32_t rsqrt_a2 = _mm_cvtss_f32(rsqrts);
-    simsimd_f32_t rsqrt_b2 = _mm_cvtss_f32(_mm_shuffle_ps(rsqrts, rsqrts, _MM_SHUFFLE(0, 0, 0, 1)));
-    *result = ab != 0 ? 1 - ab * rsqrt_a2 * rsqrt_b2 : 0;
+    *result = simsimd_cos_normalize_f32_x86(ab, a2, b2);
 }
 
 #pragma clang attribute pop
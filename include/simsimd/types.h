@@ -69,6 +69,37 @@
 #endif // defined(__ARM_FEATURE_SVE)
 #endif // !defined(SIMSIMD_TARGET_SVE)
 
+// Compiling for Arm: SIMSIMD_TARGET_NEON_F16, SIMSIMD_TARGET_NEON_BF16, SIMSIMD_TARGET_NEON_I8
+//
+// NEON itself is mandatory on every 64-bit Arm core, but the extensions our kernels rely on are not.
+// Cortex-A72 and A53 are plain Armv8.0 and lack both `fp16` arithmetic and the `sdot`/`udot` instructions
+// of the `dotprod` extension, which became common only with Armv8.2 cores, like Cortex-A55 and A76.
+// The `bf16` extension arrived even later, with Armv8.6, in Neoverse V1 and Apple M2.
+#if !defined(SIMSIMD_TARGET_NEON_F16) || (SIMSIMD_TARGET_NEON_F16 && !SIMSIMD_TARGET_NEON)
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+#define SIMSIMD_TARGET_NEON_F16 SIMSIMD_TARGET_NEON
+#else
+#undef SIMSIMD_TARGET_NEON_F16
+#define SIMSIMD_TARGET_NEON_F16 0
+#endif // defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+#endif // !defined(SIMSIMD_TARGET_NEON_F16)
+#if !defined(SIMSIMD_TARGET_NEON_BF16) || (SIMSIMD_TARGET_NEON_BF16 && !SIMSIMD_TARGET_NEON)
+#if defined(__ARM_FEATURE_BF16_VECTOR_ARITHMETIC)
+#define SIMSIMD_TARGET_NEON_BF16 SIMSIMD_TARGET_NEON
+#else
+#undef SIMSIMD_TARGET_NEON_BF16
+#define SIMSIMD_TARGET_NEON_BF16 0
+#endif // defined(__ARM_FEATURE_BF16_VECTOR_ARITHMETIC)
+#endif // !defined(SIMSIMD_TARGET_NEON_BF16)
+#if !defined(SIMSIMD_TARGET_NEON_I8) || (SIMSIMD_TARGET_NEON_I8 && !SIMSIMD_TARGET_NEON)
+#if defined(__ARM_FEATURE_DOTPROD)
+#define SIMSIMD_TARGET_NEON_I8 SIMSIMD_TARGET_NEON
+#else
+#undef SIMSIMD_TARGET_NEON_I8
+#define SIMSIMD_TARGET_NEON_I8 0
+#endif // defined(__ARM_FEATURE_DOTPROD)
+#endif // !defined(SIMSIMD_TARGET_NEON_I8)
+
 // Compiling for x86: SIMSIMD_TARGET_HASWELL
 //
 // Starting with Ivy Bridge, Intel supports the `F16C` extensions for fast half-precision
@@ -85,6 +116,19 @@
 #endif // defined(__AVX2__)
 #endif // !defined(SIMSIMD_TARGET_HASWELL)
 
+// Compiling for x86: SIMSIMD_TARGET_ALDER
+//
+// Alder Lake brought the VEX-encoded AVX-VNNI to CPUs without AVX512, including all the following
+// hybrid client chips, like Raptor Lake and Arrow Lake, and the E-core only Sierra Forest servers.
+#if !defined(SIMSIMD_TARGET_ALDER) || (SIMSIMD_TARGET_ALDER && !SIMSIMD_TARGET_X86)
+#if defined(__AVX2__) && defined(__AVXVNNI__)
+#define SIMSIMD_TARGET_ALDER 1
+#else
+#undef SIMSIMD_TARGET_ALDER
+#define SIMSIMD_TARGET_ALDER 0
+#endif // defined(__AVXVNNI__)
+#endif // !defined(SIMSIMD_TARGET_ALDER)
+
 // Compiling for x86: SIMSIMD_TARGET_SKYLAKE, SIMSIMD_TARGET_ICE, SIMSIMD_TARGET_SAPPHIRE
 //
 // It's important to provide fine-grained controls over AVX512 families, as they are very fragmented:
@@ -160,7 +204,7 @@
 #include <arm_sve.h>
 #endif
 
-#if SIMSIMD_TARGET_HASWELL || SIMSIMD_TARGET_SKYLAKE
+#if SIMSIMD_TARGET_X86
 #include <immintrin.h>
 #endif
 
@@ -171,11 +215,30 @@
 #define SIMSIMD_RSQRT(x) (1 / sqrtf(x))
 #endif
 
+#ifndef SIMSIMD_SQRT
+#include <math.h>
+#define SIMSIMD_SQRT(x) (sqrt(x))
+#endif
+
 #ifndef SIMSIMD_LOG
 #include <math.h>
 #define SIMSIMD_LOG(x) (logf(x))
 #endif
 
+/**
+ *  @brief  Hints the CPU to load the cache line containing `ptr` into all cache levels, ahead of its use.
+ *          Expands into nothing on compilers without a portable intrinsic.
+ */
+#ifndef SIMSIMD_PREFETCH
+#if defined(__GNUC__) || defined(__clang__)
+#define SIMSIMD_PREFETCH(ptr) __builtin_prefetch((ptr), 0, 3)
+#elif defined(_MSC_VER) && SIMSIMD_TARGET_X86
+#define SIMSIMD_PREFETCH(ptr) _mm_prefetch((char const*)(ptr), _MM_HINT_T0)
+#else
+#define SIMSIMD_PREFETCH(ptr) ((void)(ptr))
+#endif
+#endif
+
 #ifndef SIMSIMD_F32_DIVISION_EPSILON
 #define SIMSIMD_F32_DIVISION_EPSILON (1e-7)
 #endif
@@ -189,6 +252,7 @@ extern "C" {
 #endif
 
 typedef int simsimd_i32_t;
+typedef unsigned int simsimd_u32_t;
 typedef float simsimd_f32_t;
 typedef double simsimd_f64_t;
 typedef signed char simsimd_i8_t;
@@ -306,6 +370,30 @@ typedef unsigned short simsimd_bf16_t;
 #endif
 #endif
 
+/**
+ *  @brief  Converts a single-precision value into a half-precision floating-point number,
+ *          potentially compressing it into a 16-bit unsigned integer.
+ */
+#ifndef SIMSIMD_COMPRESS_F16
+#if SIMSIMD_NATIVE_F16
+#define SIMSIMD_COMPRESS_F16(x) ((simsimd_f16_t)(x))
+#else
+#define SIMSIMD_COMPRESS_F16(x) (simsimd_compress_f16(x))
+#endif
+#endif
+
+/**
+ *  @brief  Converts a single-precision value into a half-precision brain floating-point number,
+ *          potentially compressing it into a 16-bit unsigned integer.
+ */
+#ifndef SIMSIMD_COMPRESS_BF16
+#if SIMSIMD_NATIVE_BF16
+#define SIMSIMD_COMPRESS_BF16(x) ((simsimd_bf16_t)(x))
+#else
+#define SIMSIMD_COMPRESS_BF16(x) (simsimd_compress_bf16(x))
+#endif
+#endif
+
 typedef union {
     unsigned i;
     float f;
@@ -416,6 +504,32 @@ SIMSIMD_PUBLIC unsigned short simsimd_compress_bf16(simsimd_f32_t x) {
     return (unsigned short)value.i;
 }
 
+/**
+ *  @brief  Rounds a `float` to the nearest 8-bit signed integer, saturating values outside of [-128, 127].
+ */
+SIMSIMD_PUBLIC simsimd_i8_t simsimd_saturate_i8(simsimd_f32_t x) {
+    x = x > 127 ? 127 : (x < -128 ? -128 : x);
+    return (simsimd_i8_t)(x < 0 ? x - 0.5f : x + 0.5f);
+}
+
+/**
+ *  @brief  Counts the trailing zero bits in a non-zero 64-bit word, to iterate over the set bits of bitmaps.
+ */
+SIMSIMD_PUBLIC int simsimd_ctz_u64(simsimd_u64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(x);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long index;
+    _BitScanForward64(&index, x);
+    return (int)index;
+#else
+    int count = 0;
+    for (; !(x & 1); x >>= 1)
+        ++count;
+    return count;
+#endif
+}
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
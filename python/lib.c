@@ -13,6 +13,7 @@
 
 #define SIMSIMD_RSQRT(x) (1 / sqrtf(x))
 #define SIMSIMD_LOG(x) (logf(x))
+#include <simsimd/parallel.h> // `simsimd_cdist_tiles`, `simsimd_pdist_parallel`
 #include <simsimd/simsimd.h>
 
 #define PY_SSIZE_T_CLEAN
@@ -181,12 +182,22 @@ static PyObject* api_enable_capability(PyObject* self, PyObject* args) {
 
     if (same_string(cap_name, "neon")) {
         static_capabilities |= simsimd_cap_neon_k;
+    } else if (same_string(cap_name, "neon_f16")) {
+        static_capabilities |= simsimd_cap_neon_f16_k;
+    } else if (same_string(cap_name, "neon_bf16")) {
+        static_capabilities |= simsimd_cap_neon_bf16_k;
+    } else if (same_string(cap_name, "neon_i8")) {
+        static_capabilities |= simsimd_cap_neon_i8_k;
+    } else if (same_string(cap_name, "neon_i8mm")) {
+        static_capabilities |= simsimd_cap_neon_i8mm_k;
     } else if (same_string(cap_name, "sve")) {
         static_capabilities |= simsimd_cap_sve_k;
     } else if (same_string(cap_name, "sve2")) {
         static_capabilities |= simsimd_cap_sve2_k;
     } else if (same_string(cap_name, "haswell")) {
         static_capabilities |= simsimd_cap_haswell_k;
+    } else if (same_string(cap_name, "alder")) {
+        static_capabilities |= simsimd_cap_alder_k;
     } else if (same_string(cap_name, "skylake")) {
         static_capabilities |= simsimd_cap_skylake_k;
     } else if (same_string(cap_name, "ice")) {
@@ -214,12 +225,22 @@ static PyObject* api_disable_capability(PyObject* self, PyObject* args) {
 
     if (same_string(cap_name, "neon")) {
         static_capabilities &= ~simsimd_cap_neon_k;
+    } else if (same_string(cap_name, "neon_f16")) {
+        static_capabilities &= ~simsimd_cap_neon_f16_k;
+    } else if (same_string(cap_name, "neon_bf16")) {
+        static_capabilities &= ~simsimd_cap_neon_bf16_k;
+    } else if (same_string(cap_name, "neon_i8")) {
+        static_capabilities &= ~simsimd_cap_neon_i8_k;
+    } else if (same_string(cap_name, "neon_i8mm")) {
+        static_capabilities &= ~simsimd_cap_neon_i8mm_k;
     } else if (same_string(cap_name, "sve")) {
         static_capabilities &= ~simsimd_cap_sve_k;
     } else if (same_string(cap_name, "sve2")) {
         static_capabilities &= ~simsimd_cap_sve2_k;
     } else if (same_string(cap_name, "haswell")) {
         static_capabilities &= ~simsimd_cap_haswell_k;
+    } else if (same_string(cap_name, "alder")) {
+        static_capabilities &= ~simsimd_cap_alder_k;
     } else if (same_string(cap_name, "skylake")) {
         static_capabilities &= ~simsimd_cap_skylake_k;
     } else if (same_string(cap_name, "ice")) {
@@ -249,9 +270,14 @@ static PyObject* api_get_capabilities(PyObject* self) {
 
     ADD_CAP(serial);
     ADD_CAP(neon);
+    ADD_CAP(neon_f16);
+    ADD_CAP(neon_bf16);
+    ADD_CAP(neon_i8);
+    ADD_CAP(neon_i8mm);
     ADD_CAP(sve);
     ADD_CAP(sve2);
     ADD_CAP(haswell);
+    ADD_CAP(alder);
     ADD_CAP(skylake);
     ADD_CAP(ice);
     ADD_CAP(genoa);
@@ -458,6 +484,14 @@ cleanup:
     return output;
 }
 
+/// @brief  Executor for the kernels of `simsimd/parallel.h`, spreading their tasks across the OpenMP threads.
+static void openmp_executor(void* executor, simsimd_size_t tasks, simsimd_task_t task, void* context) {
+    (void)executor;
+#pragma omp parallel for schedule(dynamic)
+    for (size_t i = 0; i < tasks; ++i)
+        task(context, i);
+}
+
 static PyObject* impl_cdist(                            //
     PyObject* input_tensor_a, PyObject* input_tensor_b, //
     simsimd_metric_kind_t metric_kind, size_t threads) {
@@ -537,16 +571,37 @@ static PyObject* impl_cdist(                            //
         distances_obj->strides[1] = bytes_per_datatype(distances_obj->datatype);
         output = (PyObject*)distances_obj;
 
-        // Compute the distances
+        // Distances between the rows of the same contiguous matrix are symmetric, so only the upper triangle
+        // is computed and mirrored, and the cosine distance reuses the norm of every row
         simsimd_distance_t* distances = (simsimd_distance_t*)&distances_obj->start[0];
-#pragma omp parallel for collapse(2)
-        for (size_t i = 0; i < parsed_a.count; ++i)
-            for (size_t j = 0; j < parsed_b.count; ++j)
-                metric(                                   //
-                    parsed_a.start + i * parsed_a.stride, //
-                    parsed_b.start + j * parsed_b.stride, //
-                    parsed_a.dimensions,                  //
-                    distances + i * components_per_pair * parsed_b.count + j);
+        int is_symmetric = parsed_a.start == parsed_b.start && parsed_a.count == parsed_b.count &&
+                           parsed_a.stride == parsed_b.stride && !datatype_is_complex &&
+                           parsed_a.stride == parsed_a.dimensions * bytes_per_datatype(datatype);
+        if (is_symmetric && simsimd_pdist_parallel(metric_kind, datatype, static_capabilities, parsed_a.start,
+                                                   parsed_a.count, parsed_a.dimensions, distances, 1,
+                                                   openmp_executor, NULL))
+            goto cleanup;
+
+        // Compute the distances in cache-sized tiles, so that the rows of `b` are reused from L2,
+        // instead of being streamed from memory for every row of `a`
+        size_t a_tile, b_tile;
+        simsimd_cdist_tiles(parsed_a.dimensions * bytes_per_datatype(datatype), parsed_a.count, parsed_b.count,
+                            &a_tile, &b_tile);
+        size_t const b_tiles = (parsed_b.count + b_tile - 1) / b_tile;
+        size_t const tiles = (parsed_a.count + a_tile - 1) / a_tile * b_tiles;
+#pragma omp parallel for schedule(dynamic)
+        for (size_t tile = 0; tile < tiles; ++tile) {
+            size_t const a_first = tile / b_tiles * a_tile, b_first = tile % b_tiles * b_tile;
+            size_t const a_last = a_first + a_tile < parsed_a.count ? a_first + a_tile : parsed_a.count;
+            size_t const b_last = b_first + b_tile < parsed_b.count ? b_first + b_tile : parsed_b.count;
+            for (size_t i = a_first; i < a_last; ++i)
+                for (size_t j = b_first; j < b_last; ++j)
+                    metric(                                   //
+                        parsed_a.start + i * parsed_a.stride, //
+                        parsed_b.start + j * parsed_b.stride, //
+                        parsed_a.dimensions,                  //
+                        distances + (i * parsed_b.count + j) * components_per_pair);
+        }
     }
 
 cleanup:
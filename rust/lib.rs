@@ -89,6 +89,7 @@ extern "C" {
     fn simsimd_uses_neon() -> i32;
     fn simsimd_uses_sve() -> i32;
     fn simsimd_uses_haswell() -> i32;
+    fn simsimd_uses_alder() -> i32;
     fn simsimd_uses_skylake() -> i32;
     fn simsimd_uses_ice() -> i32;
     fn simsimd_uses_genoa() -> i32;
@@ -117,6 +118,10 @@ pub mod capabilties {
         unsafe { crate::simsimd_uses_haswell() != 0 }
     }
 
+    pub fn uses_alder() -> bool {
+        unsafe { crate::simsimd_uses_alder() != 0 }
+    }
+
     pub fn uses_skylake() -> bool {
         unsafe { crate::simsimd_uses_skylake() != 0 }
     }
@@ -559,6 +564,7 @@ mod tests {
     fn test_hardware_features_detection() {
         let uses_arm = capabilties::uses_neon() || capabilties::uses_sve();
         let uses_x86 = capabilties::uses_haswell()
+            || capabilties::uses_alder()
             || capabilties::uses_skylake()
             || capabilties::uses_ice()
             || capabilties::uses_genoa()
@@ -575,6 +581,7 @@ mod tests {
         println!("- uses_neon: {}", capabilties::uses_neon());
         println!("- uses_sve: {}", capabilties::uses_sve());
         println!("- uses_haswell: {}", capabilties::uses_haswell());
+        println!("- uses_alder: {}", capabilties::uses_alder());
         println!("- uses_skylake: {}", capabilties::uses_skylake());
         println!("- uses_ice: {}", capabilties::uses_ice());
         println!("- uses_genoa: {}", capabilties::uses_genoa());
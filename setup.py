@@ -43,8 +43,12 @@ if sys.platform == "linux":
     macros_args.extend(
         [
             get_bool_env_w_name("SIMSIMD_TARGET_NEON", True),
+            get_bool_env_w_name("SIMSIMD_TARGET_NEON_F16", True),
+            get_bool_env_w_name("SIMSIMD_TARGET_NEON_BF16", True),
+            get_bool_env_w_name("SIMSIMD_TARGET_NEON_I8", True),
             get_bool_env_w_name("SIMSIMD_TARGET_SVE", True),
             get_bool_env_w_name("SIMSIMD_TARGET_HASWELL", True),
+            get_bool_env_w_name("SIMSIMD_TARGET_ALDER", True),
             get_bool_env_w_name("SIMSIMD_TARGET_SKYLAKE", True),
             get_bool_env_w_name("SIMSIMD_TARGET_ICE", True),
             get_bool_env_w_name("SIMSIMD_TARGET_GENOA", True),
@@ -64,8 +68,12 @@ if sys.platform == "darwin":
     macros_args.extend(
         [
             get_bool_env_w_name("SIMSIMD_TARGET_NEON", True),
+            get_bool_env_w_name("SIMSIMD_TARGET_NEON_F16", True),
+            get_bool_env_w_name("SIMSIMD_TARGET_NEON_BF16", True),
+            get_bool_env_w_name("SIMSIMD_TARGET_NEON_I8", True),
             get_bool_env_w_name("SIMSIMD_TARGET_SVE", False),
             get_bool_env_w_name("SIMSIMD_TARGET_HASWELL", True),
+            get_bool_env_w_name("SIMSIMD_TARGET_ALDER", False),
             get_bool_env_w_name("SIMSIMD_TARGET_SKYLAKE", False),
             get_bool_env_w_name("SIMSIMD_TARGET_ICE", False),
             get_bool_env_w_name("SIMSIMD_TARGET_GENOA", False),
@@ -86,8 +94,12 @@ if sys.platform == "win32":
     macros_args.extend(
         [
             get_bool_env_w_name("SIMSIMD_TARGET_NEON", True),
+            get_bool_env_w_name("SIMSIMD_TARGET_NEON_F16", False),
+            get_bool_env_w_name("SIMSIMD_TARGET_NEON_BF16", False),
+            get_bool_env_w_name("SIMSIMD_TARGET_NEON_I8", False),
             get_bool_env_w_name("SIMSIMD_TARGET_SVE", False),
             get_bool_env_w_name("SIMSIMD_TARGET_HASWELL", True),
+            get_bool_env_w_name("SIMSIMD_TARGET_ALDER", False),
             get_bool_env_w_name("SIMSIMD_TARGET_SKYLAKE", True),
             get_bool_env_w_name("SIMSIMD_TARGET_ICE", True),
             get_bool_env_w_name("SIMSIMD_TARGET_GENOA", False),
@@ -90,9 +90,14 @@ extension simsimd_capability_t: OptionSet, CustomStringConvertible {
     public var description: String {
         var components: [String] = []
         if contains(.neon) { components.append(".neon") }
+        if contains(.neonF16) { components.append(".neonF16") }
+        if contains(.neonBF16) { components.append(".neonBF16") }
+        if contains(.neonI8) { components.append(".neonI8") }
+        if contains(.neonI8MM) { components.append(".neonI8MM") }
         if contains(.sve) { components.append(".sve") }
         if contains(.sve2) { components.append(".sve2") }
         if contains(.haswell) { components.append(".haswell") }
+        if contains(.alder) { components.append(".alder") }
         if contains(.skylake) { components.append(".skylake") }
         if contains(.ice) { components.append(".ice") }
         if contains(.sapphire) { components.append(".sapphire") }
@@ -104,9 +109,14 @@ extension simsimd_capability_t: OptionSet, CustomStringConvertible {
 
     public static let any = simsimd_cap_any_k
     public static let neon = simsimd_cap_neon_k
+    public static let neonF16 = simsimd_cap_neon_f16_k
+    public static let neonBF16 = simsimd_cap_neon_bf16_k
+    public static let neonI8 = simsimd_cap_neon_i8_k
+    public static let neonI8MM = simsimd_cap_neon_i8mm_k
     public static let sve = simsimd_cap_sve_k
     public static let sve2 = simsimd_cap_sve2_k
     public static let haswell = simsimd_cap_haswell_k
+    public static let alder = simsimd_cap_alder_k
     public static let skylake = simsimd_cap_skylake_k
     public static let ice = simsimd_cap_ice_k
     public static let sapphire = simsimd_cap_sapphire_k